@@ -82,10 +82,10 @@ void AudioSystem::EndFrame()
 //-----------------------------------------------------------------------------------------------
 SoundID AudioSystem::CreateOrGetSound( const std::string& soundFilePath , bool threeDimensional )
 {
-	std::map< std::string, SoundID >::iterator found = m_registeredSoundIDs.find( soundFilePath );
-	if( found != m_registeredSoundIDs.end() )
+	AssetHandle< SoundID > found = m_soundRegistry.Find( soundFilePath.c_str() );
+	if( found.IsValid() )
 	{
-		return found->second;
+		return m_soundRegistry.Get( found );
 	}
 	else
 	{
@@ -97,7 +97,7 @@ SoundID AudioSystem::CreateOrGetSound( const std::string& soundFilePath , bool t
 		if( newSound )
 		{
 			SoundID newSoundID = m_registeredSounds.size();
-			m_registeredSoundIDs[ soundFilePath ] = newSoundID;
+			m_soundRegistry.Add( soundFilePath.c_str(), newSoundID );
 			m_registeredSounds.push_back( newSound );
 			return newSoundID;
 		}
@@ -3,6 +3,7 @@
 #include "Engine/Math/Mat44.hpp"
 //-----------------------------------------------------------------------------------------------
 #include "ThirdParty/fmod/fmod.hpp"
+#include "Engine/Core/AssetRegistry.hpp"
 #include <string>
 #include <vector>
 #include <map>
@@ -50,7 +51,7 @@ public:
 
 protected:
 	FMOD::System*						m_fmodSystem;
-	std::map< std::string, SoundID >	m_registeredSoundIDs;
+	AssetRegistry< SoundID >			m_soundRegistry;
 	std::vector< FMOD::Sound* >			m_registeredSounds;
 	std::vector<SoundPlaybackID> m_3DSoundPlaybacks;
 
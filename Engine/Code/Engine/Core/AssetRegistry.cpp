@@ -0,0 +1,42 @@
+#include "Engine/Core/AssetRegistry.hpp"
+
+static char GetFoldedPathChar(char pathChar)
+{
+	if (pathChar == '\\')
+		return '/';
+
+	if (pathChar >= 'A' && pathChar <= 'Z')
+		return pathChar - 'A' + 'a';
+
+	return pathChar;
+}
+
+AssetPathHash HashAssetPath(char const* filePath)
+{
+	AssetPathHash hash = 14695981039346656037ull;
+	for (char const* pathChar = filePath; *pathChar != '\0'; ++pathChar)
+	{
+		hash ^= static_cast<unsigned char>(GetFoldedPathChar(*pathChar));
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+AssetPathHash HashAssetPath(std::string const& filePath)
+{
+	return HashAssetPath(filePath.c_str());
+}
+
+bool AreAssetPathsEqual(char const* filePathA, char const* filePathB)
+{
+	while (*filePathA != '\0' && *filePathB != '\0')
+	{
+		if (GetFoldedPathChar(*filePathA) != GetFoldedPathChar(*filePathB))
+			return false;
+
+		++filePathA;
+		++filePathB;
+	}
+
+	return *filePathA == *filePathB;
+}
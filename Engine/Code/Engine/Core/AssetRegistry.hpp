@@ -0,0 +1,249 @@
+#pragma once
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+typedef uint64_t AssetPathHash;
+
+//FNV-1a of a file path, ASCII case and '\' vs '/' are folded so Windows spellings of one file hash the same
+AssetPathHash HashAssetPath(char const* filePath);
+AssetPathHash HashAssetPath(std::string const& filePath);
+bool AreAssetPathsEqual(char const* filePathA, char const* filePathB); //with the same folding as the hash
+
+constexpr uint32_t INVALID_ASSET_INDEX = 0xFFFFFFFF;
+
+//Typed slot index into an AssetRegistry<T>. Goes stale (not reused) once its asset is unloaded
+template <typename T>
+struct AssetHandle
+{
+	uint32_t m_index = INVALID_ASSET_INDEX;
+	uint32_t m_generation = 0;
+
+	bool IsValid() const { return m_index != INVALID_ASSET_INDEX; }
+	bool operator==(AssetHandle<T> const& compare) const { return m_index == compare.m_index && m_generation == compare.m_generation; }
+	bool operator!=(AssetHandle<T> const& compare) const { return !(*this == compare); }
+};
+
+//Path hash to slot lookup for one kind of asset, with reference counts and explicit unload.
+//Only the asset value is stored (a pointer or an id), the system that owns the asset type creates and destroys it.
+//Each path is interned once when added, lookups by hash never compare strings. Two paths with the same hash die on Add.
+template <typename T>
+class AssetRegistry
+{
+public:
+	AssetHandle<T>		Find(AssetPathHash pathHash) const;
+	AssetHandle<T>		Find(char const* filePath) const { return Find(HashAssetPath(filePath)); }
+	AssetHandle<T>		Add(char const* filePath, T const& asset); //starts with one reference
+
+	bool				IsLoaded(AssetHandle<T> handle) const;
+	T const&			Get(AssetHandle<T> handle) const; //dies on a stale handle
+	T					GetOrDefault(AssetHandle<T> handle, T const& defaultAsset) const;
+	std::string const&	GetFilePath(AssetHandle<T> handle) const;
+
+	//Releasing the last reference doesn't unload, the owner decides when (see GetUnreferenced)
+	int					AddReference(AssetHandle<T> handle);
+	int					ReleaseReference(AssetHandle<T> handle);
+	int					GetNumReferences(AssetHandle<T> handle) const;
+	void				Pin(AssetHandle<T> handle); //for raw pointer callers that can't release, never reported as unreferenced
+	void				GetUnreferenced(std::vector<AssetHandle<T>>& out_handles) const;
+
+	bool				Unload(AssetHandle<T> handle, T& out_asset); //hands the asset back to be destroyed, false if already stale
+	int					GetNumLoaded() const { return static_cast<int>(m_slotsByPathHash.size()); }
+	void				Clear();
+
+private:
+	struct Slot
+	{
+		T m_asset = T();
+		AssetPathHash m_pathHash = 0;
+		std::string m_filePath;
+		int m_numReferences = 0;
+		uint32_t m_generation = 0;
+		bool m_isLoaded = false;
+		bool m_isPinned = false;
+	};
+
+	Slot const* GetLoadedSlot(AssetHandle<T> handle) const;
+
+private:
+	std::vector<Slot> m_slots;
+	std::vector<uint32_t> m_freeSlots;
+	std::unordered_map<AssetPathHash, uint32_t> m_slotsByPathHash;
+};
+
+template <typename T>
+AssetHandle<T> AssetRegistry<T>::Find(AssetPathHash pathHash) const
+{
+	AssetHandle<T> handle;
+	auto found = m_slotsByPathHash.find(pathHash);
+	if (found == m_slotsByPathHash.end())
+		return handle;
+
+	handle.m_index = found->second;
+	handle.m_generation = m_slots[found->second].m_generation;
+	return handle;
+}
+
+template <typename T>
+AssetHandle<T> AssetRegistry<T>::Add(char const* filePath, T const& asset)
+{
+	AssetPathHash pathHash = HashAssetPath(filePath);
+	auto found = m_slotsByPathHash.find(pathHash);
+	if (found != m_slotsByPathHash.end())
+	{
+		GUARANTEE_OR_DIE(!AreAssetPathsEqual(m_slots[found->second].m_filePath.c_str(), filePath), Stringf("Asset path hash collision between \"%s\" and \"%s\"", m_slots[found->second].m_filePath.c_str(), filePath));
+		ERROR_AND_DIE(Stringf("Asset \"%s\" is already registered, Find it before adding", filePath));
+	}
+
+	uint32_t slotIndex = 0;
+	if (!m_freeSlots.empty())
+	{
+		slotIndex = m_freeSlots.back();
+		m_freeSlots.pop_back();
+	}
+	else
+	{
+		slotIndex = static_cast<uint32_t>(m_slots.size());
+		m_slots.emplace_back();
+	}
+
+	Slot& slot = m_slots[slotIndex];
+	slot.m_asset = asset;
+	slot.m_pathHash = pathHash;
+	slot.m_filePath = filePath;
+	slot.m_numReferences = 1;
+	slot.m_isLoaded = true;
+	slot.m_isPinned = false;
+	m_slotsByPathHash[pathHash] = slotIndex;
+
+	AssetHandle<T> handle;
+	handle.m_index = slotIndex;
+	handle.m_generation = slot.m_generation;
+	return handle;
+}
+
+template <typename T>
+bool AssetRegistry<T>::IsLoaded(AssetHandle<T> handle) const
+{
+	return GetLoadedSlot(handle) != nullptr;
+}
+
+template <typename T>
+T const& AssetRegistry<T>::Get(AssetHandle<T> handle) const
+{
+	Slot const* slot = GetLoadedSlot(handle);
+	GUARANTEE_OR_DIE(slot != nullptr, "Getting an asset through a stale or invalid handle");
+	return slot->m_asset;
+}
+
+template <typename T>
+T AssetRegistry<T>::GetOrDefault(AssetHandle<T> handle, T const& defaultAsset) const
+{
+	Slot const* slot = GetLoadedSlot(handle);
+	return (slot != nullptr) ? slot->m_asset : defaultAsset;
+}
+
+template <typename T>
+std::string const& AssetRegistry<T>::GetFilePath(AssetHandle<T> handle) const
+{
+	Slot const* slot = GetLoadedSlot(handle);
+	GUARANTEE_OR_DIE(slot != nullptr, "Getting an asset path through a stale or invalid handle");
+	return slot->m_filePath;
+}
+
+template <typename T>
+int AssetRegistry<T>::AddReference(AssetHandle<T> handle)
+{
+	Slot* slot = const_cast<Slot*>(GetLoadedSlot(handle));
+	if (slot == nullptr)
+		return 0;
+
+	return ++slot->m_numReferences;
+}
+
+template <typename T>
+int AssetRegistry<T>::ReleaseReference(AssetHandle<T> handle)
+{
+	Slot* slot = const_cast<Slot*>(GetLoadedSlot(handle));
+	if (slot == nullptr)
+		return 0;
+
+	GUARANTEE_OR_DIE(slot->m_numReferences > 0, Stringf("Released more references than were added for \"%s\"", slot->m_filePath.c_str()));
+	return --slot->m_numReferences;
+}
+
+template <typename T>
+int AssetRegistry<T>::GetNumReferences(AssetHandle<T> handle) const
+{
+	Slot const* slot = GetLoadedSlot(handle);
+	return (slot != nullptr) ? slot->m_numReferences : 0;
+}
+
+template <typename T>
+void AssetRegistry<T>::Pin(AssetHandle<T> handle)
+{
+	Slot* slot = const_cast<Slot*>(GetLoadedSlot(handle));
+	if (slot != nullptr)
+	{
+		slot->m_isPinned = true;
+	}
+}
+
+template <typename T>
+void AssetRegistry<T>::GetUnreferenced(std::vector<AssetHandle<T>>& out_handles) const
+{
+	for (uint32_t slotIndex = 0; slotIndex < static_cast<uint32_t>(m_slots.size()); ++slotIndex)
+	{
+		Slot const& slot = m_slots[slotIndex];
+		if (slot.m_isLoaded && !slot.m_isPinned && slot.m_numReferences <= 0)
+		{
+			AssetHandle<T> handle;
+			handle.m_index = slotIndex;
+			handle.m_generation = slot.m_generation;
+			out_handles.push_back(handle);
+		}
+	}
+}
+
+template <typename T>
+bool AssetRegistry<T>::Unload(AssetHandle<T> handle, T& out_asset)
+{
+	Slot* slot = const_cast<Slot*>(GetLoadedSlot(handle));
+	if (slot == nullptr)
+		return false;
+
+	out_asset = slot->m_asset;
+	m_slotsByPathHash.erase(slot->m_pathHash);
+	slot->m_asset = T();
+	slot->m_filePath.clear();
+	slot->m_numReferences = 0;
+	slot->m_isLoaded = false;
+	slot->m_isPinned = false;
+	slot->m_generation++;
+	m_freeSlots.push_back(handle.m_index);
+	return true;
+}
+
+template <typename T>
+void AssetRegistry<T>::Clear()
+{
+	m_slots.clear();
+	m_freeSlots.clear();
+	m_slotsByPathHash.clear();
+}
+
+template <typename T>
+typename AssetRegistry<T>::Slot const* AssetRegistry<T>::GetLoadedSlot(AssetHandle<T> handle) const
+{
+	if (handle.m_index >= static_cast<uint32_t>(m_slots.size()))
+		return nullptr;
+
+	Slot const& slot = m_slots[handle.m_index];
+	if (!slot.m_isLoaded || slot.m_generation != handle.m_generation)
+		return nullptr;
+
+	return &slot;
+}
@@ -0,0 +1,219 @@
+#include "Engine/Core/CookedImage.hpp"
+#include "Engine/Core/AssetRegistry.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include <cstring>
+#include <filesystem>
+
+static_assert(sizeof(CookedImageHeader) == 304, "Cooked image header layout changed, bump COOKED_IMAGE_VERSION");
+
+static uint64_t GetAlignedCookedOffset(uint64_t offset)
+{
+	return ((offset + COOKED_IMAGE_LEVEL_ALIGNMENT - 1) / COOKED_IMAGE_LEVEL_ALIGNMENT) * COOKED_IMAGE_LEVEL_ALIGNMENT;
+}
+
+static uint64_t HashFileBytes(uint8_t const* fileBytes, size_t numBytes)
+{
+	uint64_t hash = 14695981039346656037ull;
+	for (size_t byteNum = 0; byteNum < numBytes; ++byteNum)
+	{
+		hash ^= fileBytes[byteNum];
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+//CookedImage
+//-----------------------------------------------------------------------------------------------
+bool CookedImage::LoadFromFile(std::string const& cookedFilePath)
+{
+	//a missing cook is the normal first run, opening doesn't report it
+	if (!m_mappedFile.Open(cookedFilePath))
+		return false;
+
+	if (m_mappedFile.GetSize() < sizeof(CookedImageHeader))
+	{
+		m_mappedFile.Close();
+		return false;
+	}
+
+	//only bounds are checked, nothing is converted
+	CookedImageHeader const& header = GetHeader();
+	bool isValid = header.m_magic == COOKED_IMAGE_MAGIC && header.m_version == COOKED_IMAGE_VERSION && header.m_fileSize == m_mappedFile.GetSize();
+	isValid = isValid && header.m_numLevels >= 1 && header.m_numLevels <= MAX_COOKED_IMAGE_LEVELS;
+	for (uint32_t levelIndex = 0; isValid && levelIndex < header.m_numLevels; ++levelIndex)
+	{
+		CookedImageLevel const& level = header.m_levels[levelIndex];
+		uint64_t levelSize = (uint64_t)level.m_width * (uint64_t)level.m_height * sizeof(Rgba8);
+		isValid = level.m_width > 0 && level.m_height > 0 && level.m_offset % COOKED_IMAGE_LEVEL_ALIGNMENT == 0 && level.m_offset + levelSize <= header.m_fileSize;
+	}
+
+	if (!isValid)
+	{
+		m_mappedFile.Close();
+	}
+	return isValid;
+}
+
+bool CookedImage::IsFromSource(char const* sourceFilePath, CookedImageSource const& source) const
+{
+	CookedImageSource const& cookedSource = GetHeader().m_source;
+	if (cookedSource.m_size != source.m_size)
+		return false;
+
+	if (cookedSource.m_modifiedTime == source.m_modifiedTime)
+		return true;
+
+	CookedImageSource hashedSource;
+	return GetCookedImageSource(sourceFilePath, hashedSource, true) && hashedSource.m_contentHash == cookedSource.m_contentHash;
+}
+
+CookedImageHeader const& CookedImage::GetHeader() const
+{
+	GUARANTEE_OR_DIE(m_mappedFile.GetSize() >= sizeof(CookedImageHeader), "Reading a cooked image that was never loaded");
+	return *reinterpret_cast<CookedImageHeader const*>(m_mappedFile.GetData());
+}
+
+int CookedImage::GetNumLevels() const
+{
+	return m_mappedFile.IsOpen() ? (int)GetHeader().m_numLevels : 0;
+}
+
+IntVec2 CookedImage::GetLevelDimensions(int levelIndex) const
+{
+	CookedImageLevel const& level = GetHeader().m_levels[levelIndex];
+	return IntVec2(level.m_width, level.m_height);
+}
+
+Rgba8 const* CookedImage::GetLevelTexels(int levelIndex) const
+{
+	return reinterpret_cast<Rgba8 const*>(m_mappedFile.GetData() + GetHeader().m_levels[levelIndex].m_offset);
+}
+
+Image CookedImage::CreateImage(char const* sourceFilePath, int levelIndex) const
+{
+	return Image(GetLevelDimensions(levelIndex), GetLevelTexels(levelIndex), sourceFilePath);
+}
+
+//Cooking
+//-----------------------------------------------------------------------------------------------
+bool GetCookedImageSource(char const* sourceFilePath, CookedImageSource& out_source, bool hashContents)
+{
+	std::error_code errorCode;
+	uint64_t fileSize = std::filesystem::file_size(sourceFilePath, errorCode);
+	if (errorCode)
+		return false;
+
+	std::filesystem::file_time_type modifiedTime = std::filesystem::last_write_time(sourceFilePath, errorCode);
+	if (errorCode)
+		return false;
+
+	out_source.m_size = fileSize;
+	out_source.m_modifiedTime = static_cast<uint64_t>(modifiedTime.time_since_epoch().count());
+	out_source.m_contentHash = 0;
+	if (hashContents)
+	{
+		MappedFile sourceFile;
+		if (!sourceFile.Open(sourceFilePath) || sourceFile.GetSize() != fileSize)
+			return false;
+
+		out_source.m_contentHash = HashFileBytes(sourceFile.GetData(), sourceFile.GetSize());
+	}
+	return true;
+}
+
+std::string GetCookedImageFilePath(char const* cookedImageFolder, char const* sourceFilePath)
+{
+	return Stringf("%s/%016llx.cimg", cookedImageFolder, (unsigned long long)HashAssetPath(sourceFilePath));
+}
+
+bool WriteCookedImage(std::string const& cookedFilePath, Image const& image, std::vector<Image> const& mips, CookedImageSource const& source, uint32_t flags)
+{
+	int numLevels = 1 + (int)mips.size();
+	GUARANTEE_OR_DIE(numLevels <= MAX_COOKED_IMAGE_LEVELS, Stringf("Cooked image \"%s\" has %d levels, the most is %d", cookedFilePath.c_str(), numLevels, MAX_COOKED_IMAGE_LEVELS));
+
+	CookedImageHeader header;
+	header.m_source = source;
+	header.m_flags = flags;
+	header.m_numLevels = numLevels;
+
+	uint64_t fileSize = sizeof(CookedImageHeader);
+	for (int levelIndex = 0; levelIndex < numLevels; ++levelIndex)
+	{
+		Image const& levelImage = (levelIndex == 0) ? image : mips[levelIndex - 1];
+		CookedImageLevel& level = header.m_levels[levelIndex];
+		level.m_offset = GetAlignedCookedOffset(fileSize);
+		level.m_width = levelImage.GetDimensions().x;
+		level.m_height = levelImage.GetDimensions().y;
+		fileSize = level.m_offset + (uint64_t)level.m_width * (uint64_t)level.m_height * sizeof(Rgba8);
+	}
+	header.m_fileSize = fileSize;
+
+	std::vector<uint8_t> fileBytes(fileSize, 0);
+	memcpy(fileBytes.data(), &header, sizeof(CookedImageHeader));
+	for (int levelIndex = 0; levelIndex < numLevels; ++levelIndex)
+	{
+		Image const& levelImage = (levelIndex == 0) ? image : mips[levelIndex - 1];
+		CookedImageLevel const& level = header.m_levels[levelIndex];
+		memcpy(fileBytes.data() + level.m_offset, levelImage.GetRawData(), (size_t)level.m_width * (size_t)level.m_height * sizeof(Rgba8));
+	}
+
+	std::error_code errorCode;
+	std::filesystem::path cookedFolder = std::filesystem::path(cookedFilePath).parent_path();
+	if (!cookedFolder.empty())
+	{
+		std::filesystem::create_directories(cookedFolder, errorCode);
+	}
+	return FileWriteFromBuffer(fileBytes, cookedFilePath);
+}
+
+bool CookImage(char const* sourceFilePath, char const* cookedImageFolder, bool generateMips, MipFilter mipFilter)
+{
+	CookedImageSource source;
+	if (!GetCookedImageSource(sourceFilePath, source, true))
+		return false;
+
+	Image sourceImage(sourceFilePath);
+	std::vector<Image> mips;
+	uint32_t flags = COOKED_IMAGE_FLIPPED_VERTICALLY;
+	if (generateMips)
+	{
+		sourceImage.GenerateMipChain(mips, mipFilter);
+		if ((int)mips.size() >= MAX_COOKED_IMAGE_LEVELS)
+		{
+			mips.erase(mips.begin() + (MAX_COOKED_IMAGE_LEVELS - 1), mips.end());
+		}
+		if (mipFilter == MipFilter::KAISER)
+		{
+			flags |= COOKED_IMAGE_KAISER_MIPS;
+		}
+	}
+
+	return WriteCookedImage(GetCookedImageFilePath(cookedImageFolder, sourceFilePath), sourceImage, mips, source, flags);
+}
+
+Image* LoadImageThroughCookedCache(char const* sourceFilePath, char const* cookedImageFolder)
+{
+	//a missing source goes straight to stb so it fails the way it always has
+	CookedImageSource source;
+	if (!GetCookedImageSource(sourceFilePath, source, false))
+		return new Image(sourceFilePath);
+
+	//scoped so a stale cook is unmapped before it is rewritten, Windows won't replace a mapped file
+	std::string cookedFilePath = GetCookedImageFilePath(cookedImageFolder, sourceFilePath);
+	{
+		CookedImage cookedImage;
+		if (cookedImage.LoadFromFile(cookedFilePath) && (cookedImage.GetHeader().m_flags & COOKED_IMAGE_FLIPPED_VERTICALLY) != 0 && cookedImage.IsFromSource(sourceFilePath, source))
+		{
+			return new Image(cookedImage.GetLevelDimensions(0), cookedImage.GetLevelTexels(0), sourceFilePath);
+		}
+	}
+
+	//a cook that can't be written (read only install) only costs the decode again next run
+	Image* decodedImage = new Image(sourceFilePath);
+	if (GetCookedImageSource(sourceFilePath, source, true))
+	{
+		WriteCookedImage(cookedFilePath, *decodedImage, std::vector<Image>(), source, COOKED_IMAGE_FLIPPED_VERTICALLY);
+	}
+	return decodedImage;
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "Engine/Core/Image.hpp"
+#include "Engine/Core/FileUtils.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+constexpr uint32_t COOKED_IMAGE_MAGIC = 0x474D4943; //"CIMG"
+constexpr uint32_t COOKED_IMAGE_VERSION = 1; //bump whenever the layout or the decode changes, older cooks are then recooked
+constexpr int MAX_COOKED_IMAGE_LEVELS = 16;
+constexpr uint64_t COOKED_IMAGE_LEVEL_ALIGNMENT = 64;
+
+enum CookedImageFlags : uint32_t
+{
+	COOKED_IMAGE_FLIPPED_VERTICALLY	= 1 << 0,
+	COOKED_IMAGE_KAISER_MIPS		= 1 << 1,
+};
+
+//What a cook was made from. It is fresh while the size and timestamp match; if only the timestamp moved
+//(a checkout, a copy) the contents are hashed again before it is recooked
+struct CookedImageSource
+{
+	uint64_t m_contentHash = 0; //FNV-1a of the source file bytes
+	uint64_t m_modifiedTime = 0;
+	uint64_t m_size = 0;
+};
+
+struct CookedImageLevel
+{
+	uint64_t m_offset = 0; //from the start of the file, COOKED_IMAGE_LEVEL_ALIGNMENT aligned
+	int32_t m_width = 0;
+	int32_t m_height = 0;
+};
+
+//Starts every cooked file. Level 0 is the image and the rest its mips, each is tightly packed RGBA8 rows
+//exactly as Image stores them, so a file read (or mapped) into memory is used in place with no decoding
+struct CookedImageHeader
+{
+	uint32_t m_magic = COOKED_IMAGE_MAGIC;
+	uint32_t m_version = COOKED_IMAGE_VERSION;
+	uint64_t m_fileSize = 0;
+	CookedImageSource m_source;
+	uint32_t m_flags = 0;
+	uint32_t m_numLevels = 0;
+	CookedImageLevel m_levels[MAX_COOKED_IMAGE_LEVELS];
+};
+
+//A cooked image file mapped into memory, level texels point straight into the mapping
+class CookedImage
+{
+public:
+	bool			LoadFromFile(std::string const& cookedFilePath); //false if missing, truncated or from another version
+	bool			IsFromSource(char const* sourceFilePath, CookedImageSource const& source) const; //source from GetCookedImageSource without hashing
+
+	CookedImageHeader const& GetHeader() const;
+	int				GetNumLevels() const;
+	IntVec2			GetLevelDimensions(int levelIndex) const;
+	Rgba8 const*	GetLevelTexels(int levelIndex) const;
+	Image			CreateImage(char const* sourceFilePath, int levelIndex = 0) const; //Image name is the source path so textures register under it
+
+private:
+	MappedFile m_mappedFile;
+};
+
+bool			GetCookedImageSource(char const* sourceFilePath, CookedImageSource& out_source, bool hashContents = true);
+std::string		GetCookedImageFilePath(char const* cookedImageFolder, char const* sourceFilePath); //named by the asset path hash
+bool			WriteCookedImage(std::string const& cookedFilePath, Image const& image, std::vector<Image> const& mips, CookedImageSource const& source, uint32_t flags);
+
+//Always decodes the source with stb and writes a fresh cook, false if the source can't be read or the cook can't be written
+bool			CookImage(char const* sourceFilePath, char const* cookedImageFolder, bool generateMips = false, MipFilter mipFilter = MipFilter::BOX);
+
+//Level 0 of a fresh cook, or the stb decode of the source which is then cooked for next time. Caller deletes the image
+Image*			LoadImageThroughCookedCache(char const* sourceFilePath, char const* cookedImageFolder);
@@ -4,6 +4,7 @@
 #include "Engine/Renderer/BitmapFont.hpp"
 //#include "Engine/Renderer/Renderer.hpp"
 #include "Engine/Renderer/RendererDX11.hpp"
+#include "Engine/Renderer/RendererNull.hpp"
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Core/Time.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
@@ -115,6 +116,9 @@ void DevConsole::EndFrame()
 void DevConsole::Render(AABB2 const& screenBounds, Renderer* overrideRenderer) const
 {
 	Renderer* renderer = overrideRenderer ? overrideRenderer : m_config.m_defaultRenderer;
+	if (dynamic_cast<RendererNull*>(renderer) != nullptr)
+		return; //headless, nothing to show
+
 	RendererDX11* rendererDX11 = dynamic_cast<RendererDX11*>(renderer);
 	GUARANTEE_OR_DIE(rendererDX11, "trying to render dev console without DX11");
 
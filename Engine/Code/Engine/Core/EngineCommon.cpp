@@ -5,4 +5,5 @@
 NamedStrings g_gameConfigBlackboard;
 EventSystem* g_eventSystem = nullptr;
 DevConsole* g_devConsole = nullptr;
-InputSystem* g_inputSystem = nullptr;
\ No newline at end of file
+InputSystem* g_inputSystem = nullptr;
+JobSystem* g_jobSystem = nullptr;
\ No newline at end of file
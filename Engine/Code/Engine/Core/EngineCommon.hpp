@@ -9,10 +9,12 @@
 class EventSystem;
 class DevConsole;
 class InputSystem;
+class JobSystem;
 
 extern NamedStrings g_gameConfigBlackboard;
 extern EventSystem* g_eventSystem;
 extern DevConsole* g_devConsole;
 extern InputSystem* g_inputSystem;
+extern JobSystem* g_jobSystem;
 
 
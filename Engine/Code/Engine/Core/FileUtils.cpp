@@ -2,20 +2,51 @@
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/StringUtils.hpp"
 
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
-int FileReadToBuffer(std::vector<uint8_t>& outBuffer, std::string const& fileName)
+
+//fopen_s is MSVC only, elsewhere plain fopen. nullptr if the file can't be opened
+static FILE* OpenFile(std::string const& fileName, char const* mode)
+{
+#if defined(_WIN32)
+    FILE* file = nullptr;
+    if (fopen_s(&file, fileName.c_str(), mode) != 0)
+        return nullptr;
+
+    return file;
+#else
+    return fopen(fileName.c_str(), mode);
+#endif
+}
+
+static bool ReadFileToBuffer(std::vector<uint8_t>& outBuffer, std::string const& fileName, bool reportErrors)
 {
-    FILE* newFile = new FILE;
-    if (fopen_s(&newFile, fileName.c_str(), "rb") != 0)
+    FILE* newFile = OpenFile(fileName, "rb");
+    if (newFile == nullptr)
     {
-        ERROR_RECOVERABLE(Stringf("Could not open file: \"%s\"", fileName.c_str()));
-        return 0;
+        if (reportErrors)
+        {
+            ERROR_RECOVERABLE(Stringf("Could not open file: \"%s\"", fileName.c_str()));
+        }
+        return false;
     }
 
     if (fseek(newFile, 0, SEEK_END) != 0)
     {
-        ERROR_RECOVERABLE(Stringf("File position indicator was not moved on file: \"%s\"", fileName.c_str()));
-        return 0;
+        if (reportErrors)
+        {
+            ERROR_RECOVERABLE(Stringf("File position indicator was not moved on file: \"%s\"", fileName.c_str()));
+        }
+        fclose(newFile);
+        return false;
     }
 
     size_t size = ftell(newFile);
@@ -25,13 +56,22 @@ int FileReadToBuffer(std::vector<uint8_t>& outBuffer, std::string const& fileNam
 
     if (fread(outBuffer.data(), sizeof(uint8_t), size, newFile) != size)
     {
-        ERROR_RECOVERABLE(Stringf("Could not read file: \"%s\"", fileName.c_str()));
-        return 0;
+        if (reportErrors)
+        {
+            ERROR_RECOVERABLE(Stringf("Could not read file: \"%s\"", fileName.c_str()));
+        }
+        fclose(newFile);
+        return false;
     }
 
     fclose(newFile);
     
-    return (int)size;
+    return true;
+}
+
+int FileReadToBuffer(std::vector<uint8_t>& outBuffer, std::string const& fileName)
+{
+    return ReadFileToBuffer(outBuffer, fileName, true) ? (int)outBuffer.size() : 0;
 }
 
 int FileReadToString(std::string& outString, std::string const& fileName)
@@ -43,3 +83,181 @@ int FileReadToString(std::string& outString, std::string const& fileName)
     outString = std::string(outBuffer.begin(), outBuffer.end());
     return success;
 }
+
+bool FileWriteFromBuffer(std::vector<uint8_t> const& buffer, std::string const& fileName)
+{
+    FILE* newFile = OpenFile(fileName, "wb");
+    if (newFile == nullptr)
+    {
+        return false;
+    }
+
+    size_t numBytesWritten = fwrite(buffer.data(), sizeof(uint8_t), buffer.size(), newFile);
+    fclose(newFile);
+
+    return numBytesWritten == buffer.size();
+}
+
+//MappedFile
+//-----------------------------------------------------------------------------------------------
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open(std::string const& fileName)
+{
+    Close();
+
+    //the view keeps the file and mapping alive on both platforms, so no handles are kept
+#if defined(_WIN32)
+    HANDLE fileHandle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize))
+    {
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    //an empty file can't be mapped but is still a valid, empty view
+    m_size = (size_t)fileSize.QuadPart;
+    if (m_size > 0)
+    {
+        HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle != nullptr)
+        {
+            m_data = static_cast<uint8_t const*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+            CloseHandle(mappingHandle);
+        }
+    }
+    CloseHandle(fileHandle);
+#else
+    int fileDescriptor = open(fileName.c_str(), O_RDONLY);
+    if (fileDescriptor < 0)
+        return false;
+
+    struct stat fileStatus;
+    if (fstat(fileDescriptor, &fileStatus) != 0)
+    {
+        close(fileDescriptor);
+        return false;
+    }
+
+    m_size = (size_t)fileStatus.st_size;
+    if (m_size > 0)
+    {
+        void* mappedData = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        m_data = (mappedData != MAP_FAILED) ? static_cast<uint8_t const*>(mappedData) : nullptr;
+    }
+    close(fileDescriptor);
+#endif
+
+    if (m_size > 0 && m_data == nullptr)
+    {
+        m_size = 0;
+        return false;
+    }
+
+    m_isOpen = true;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (m_data != nullptr)
+    {
+#if defined(_WIN32)
+        UnmapViewOfFile(m_data);
+#else
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+    }
+
+    m_data = nullptr;
+    m_size = 0;
+    m_isOpen = false;
+}
+
+//FileChunkReader
+//-----------------------------------------------------------------------------------------------
+FileChunkReader::FileChunkReader(size_t chunkSize)
+{
+    m_buffer.resize((chunkSize > 0) ? chunkSize : 1);
+}
+
+FileChunkReader::~FileChunkReader()
+{
+    Close();
+}
+
+bool FileChunkReader::Open(std::string const& fileName)
+{
+    Close();
+    m_file = OpenFile(fileName, "rb");
+    if (m_file == nullptr)
+        return false;
+
+    //a size we can't trust would end the chunk loop early or late, so it fails the open instead
+    long fileSize = -1;
+    if (fseek(m_file, 0, SEEK_END) == 0)
+    {
+        fileSize = ftell(m_file);
+    }
+
+    if (fileSize < 0 || fseek(m_file, 0, SEEK_SET) != 0)
+    {
+        Close();
+        return false;
+    }
+
+    m_fileSize = static_cast<size_t>(fileSize);
+    return true;
+}
+
+void FileChunkReader::Close()
+{
+    if (m_file != nullptr)
+    {
+        fclose(m_file);
+        m_file = nullptr;
+    }
+
+    m_numBytesInChunk = 0;
+    m_fileSize = 0;
+    m_numBytesRead = 0;
+}
+
+bool FileChunkReader::ReadNextChunk()
+{
+    if (m_file == nullptr)
+        return false;
+
+    m_numBytesInChunk = fread(m_buffer.data(), sizeof(uint8_t), m_buffer.size(), m_file);
+    m_numBytesRead += m_numBytesInChunk;
+    return m_numBytesInChunk > 0;
+}
+
+//FileReadJob
+//-----------------------------------------------------------------------------------------------
+FileReadJob::FileReadJob(std::string const& fileName)
+    :m_fileName(fileName)
+{
+}
+
+void FileReadJob::Execute()
+{
+    //no error dialogs from a worker, the owner decides what a missing file means
+    m_didSucceed = ReadFileToBuffer(m_buffer, m_fileName, false);
+}
+
+FileReadJob* FileReadAsync(JobSystem* jobSystem, std::string const& fileName)
+{
+    GUARANTEE_OR_DIE(jobSystem != nullptr, Stringf("Async read of \"%s\" needs a JobSystem", fileName.c_str()));
+
+    FileReadJob* readJob = new FileReadJob(fileName);
+    jobSystem->QueueJob(readJob);
+    return readJob;
+}
@@ -1,6 +1,80 @@
 #pragma once
+#include "Engine/Core/JobSystem.hpp"
+#include <cstdint>
+#include <cstdio>
 #include <vector>
 #include <string>
+#include <string_view>
 
 int FileReadToBuffer(std::vector<uint8_t>& outBuffer, std::string const& fileName);
 int FileReadToString(std::string& outString, std::string const& fileName);
+bool FileWriteFromBuffer(std::vector<uint8_t> const& buffer, std::string const& fileName); //creates or replaces the file
+
+//Read only view of a whole file mapped into memory (file mapping on Windows, mmap elsewhere), unmapped on Close or destruction.
+//Pages are read in on first touch and never copied to the heap, the view stays valid while the MappedFile lives
+class MappedFile
+{
+public:
+	MappedFile() {}
+	~MappedFile();
+	MappedFile(MappedFile const& copy) = delete;
+	MappedFile& operator=(MappedFile const& copy) = delete;
+
+	bool				Open(std::string const& fileName); //false if missing or it can't be mapped, never reports an error itself
+	void				Close();
+
+	bool				IsOpen() const { return m_isOpen; }
+	uint8_t const*		GetData() const { return m_data; } //nullptr for an empty file
+	size_t				GetSize() const { return m_size; }
+	std::string_view	GetView() const { return std::string_view(reinterpret_cast<char const*>(m_data), m_size); }
+
+private:
+	uint8_t const* m_data = nullptr;
+	size_t m_size = 0;
+	bool m_isOpen = false;
+};
+
+//Reads a file front to back through one buffer that is reused for every chunk, peak memory is the chunk size
+class FileChunkReader
+{
+public:
+	explicit FileChunkReader(size_t chunkSize = 64 * 1024);
+	~FileChunkReader();
+	FileChunkReader(FileChunkReader const& copy) = delete;
+	FileChunkReader& operator=(FileChunkReader const& copy) = delete;
+
+	bool				Open(std::string const& fileName); //false if missing, never reports an error itself
+	void				Close();
+	bool				ReadNextChunk(); //false once the whole file has been read
+
+	std::string_view	GetChunk() const { return std::string_view(reinterpret_cast<char const*>(m_buffer.data()), m_numBytesInChunk); } //valid until the next read
+	size_t				GetFileSize() const { return m_fileSize; }
+	size_t				GetNumBytesRead() const { return m_numBytesRead; }
+
+private:
+	FILE* m_file = nullptr;
+	std::vector<uint8_t> m_buffer;
+	size_t m_numBytesInChunk = 0;
+	size_t m_fileSize = 0;
+	size_t m_numBytesRead = 0;
+};
+
+//Reads a whole file on a JobSystem worker, once IsFinished() the owning thread checks DidSucceed() and takes the bytes
+class FileReadJob : public Job
+{
+public:
+	explicit FileReadJob(std::string const& fileName);
+
+	virtual void Execute() override;
+
+	std::string const&		GetFileName() const { return m_fileName; }
+	bool					DidSucceed() const { return m_didSucceed; }
+	std::vector<uint8_t>&	GetBuffer() { return m_buffer; } //swap it out to keep the bytes past the job
+
+private:
+	std::string m_fileName;
+	std::vector<uint8_t> m_buffer;
+	bool m_didSucceed = false;
+};
+
+FileReadJob* FileReadAsync(JobSystem* jobSystem, std::string const& fileName); //queued on jobSystem, the caller deletes it once finished
@@ -2,46 +2,47 @@
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Math/Vec4.hpp"
+#include "Engine/Math/MathUtils.hpp"
 #define STB_IMAGE_IMPLEMENTATION
 #include "ThirdParty/stb/stb_image.h"
+#include <emmintrin.h>
+#include <cstring>
+#include <algorithm>
 
+//pshufb is SSSE3, every x64 CPU MSVC targets has it, other compilers only use it when told the target does
+#if defined(_MSC_VER) || defined(__SSSE3__)
+#define IMAGE_USE_SSSE3
+#include <tmmintrin.h>
+#endif
 
-Image::Image(char const* imageFilePath)
+Image::Image(char const* imageFilePath, bool flipVertically)
 	:m_imageFilePath(imageFilePath)
 {
 	int bytesPerTexel = 0;
 
-	stbi_set_flip_vertically_on_load(1); //sets uv coords (0,0) to bottom left
+	//stb flips with a second pass over the decoded data, the rows are flipped below while expanding instead
+	stbi_set_flip_vertically_on_load_thread(0);
 	unsigned char* texelData = stbi_load(imageFilePath, &m_dimensions.x, &m_dimensions.y, &bytesPerTexel, 0);
 
 	GUARANTEE_OR_DIE(texelData, Stringf("Failed to load image \"%s\"", imageFilePath));
-	GUARANTEE_OR_DIE(texelData, Stringf("CreateTextureFromData failed for \"%s\" - texelData was null!", imageFilePath));
 	GUARANTEE_OR_DIE(m_dimensions.x > 0 && m_dimensions.y > 0, Stringf("CreateTextureFromData failed for \"%s\" - illegal texture dimensions (%i x %i)", imageFilePath, m_dimensions.x, m_dimensions.y));
 	GUARANTEE_OR_DIE(bytesPerTexel <= 4, Stringf("Image: \"%s\" had \"%i\" bytes per texel", imageFilePath, bytesPerTexel));
 
 	int numTexels = m_dimensions.x * m_dimensions.y;
 	m_rgbaTexels.resize(numTexels);
 
-	int byteIndex = 0;
-	for (int texelNum = 0; texelNum < numTexels; ++texelNum)
+	if (!flipVertically)
 	{
-		m_rgbaTexels[texelNum].r = texelData[byteIndex];
-		byteIndex++;
-		m_rgbaTexels[texelNum].g = texelData[byteIndex];
-		byteIndex++;
-		m_rgbaTexels[texelNum].b = texelData[byteIndex];
-		byteIndex++;
-		if (bytesPerTexel == 4)
-		{
-			m_rgbaTexels[texelNum].a = texelData[byteIndex];
-			byteIndex++;
-		}
-
-		else
+		ExpandTexelsToRgba8(numTexels, texelData, bytesPerTexel, m_rgbaTexels.data());
+	}
+	else
+	{
+		int numBytesPerRow = m_dimensions.x * bytesPerTexel;
+		for (int rowNum = 0; rowNum < m_dimensions.y; ++rowNum)
 		{
-			m_rgbaTexels[texelNum].a = 255;
+			int flippedRowNum = m_dimensions.y - 1 - rowNum;
+			ExpandTexelsToRgba8(m_dimensions.x, texelData + (size_t)rowNum * numBytesPerRow, bytesPerTexel, &m_rgbaTexels[(size_t)flippedRowNum * m_dimensions.x]);
 		}
-
 	}
 	
 	stbi_image_free(texelData);
@@ -52,14 +53,16 @@ Image::Image(IntVec2 size, Rgba8 color)
 {
 	int numTexels = m_dimensions.x * m_dimensions.y;
 	m_rgbaTexels.resize(numTexels);
+	FillTexels(numTexels, color, m_rgbaTexels.data());
+}
 
-	for (int texelNum = 0; texelNum < numTexels; ++texelNum)
-	{
-		m_rgbaTexels[texelNum].r = color.r;
-		m_rgbaTexels[texelNum].g = color.g;
-		m_rgbaTexels[texelNum].b = color.b;
-		m_rgbaTexels[texelNum].a = color.a;
-	}
+Image::Image(IntVec2 size, Rgba8 const* texels, std::string const& imageFilePath)
+	:m_imageFilePath(imageFilePath)
+	,m_dimensions(size)
+{
+	int numTexels = m_dimensions.x * m_dimensions.y;
+	m_rgbaTexels.resize(numTexels);
+	memcpy(m_rgbaTexels.data(), texels, (size_t)numTexels * sizeof(Rgba8));
 }
 
 Image::~Image()
@@ -92,3 +95,253 @@ void Image::SetTexelColor(IntVec2 const& texelCoords, Rgba8 const& newColor)
 	int index = (texelCoords.y * m_dimensions.x) + texelCoords.x;
 	m_rgbaTexels[index] = newColor;
 }
+
+//Mips
+//-----------------------------------------------------------------------------------------------
+static unsigned char GetRoundedTexelChannel(float value)
+{
+	return static_cast<unsigned char>(GetClamped(value + 0.5f, 0.f, 255.f));
+}
+
+//Zeroth order modified Bessel function of the first kind, the series converges in a few terms for the alphas used here
+static float GetBesselI0(float x)
+{
+	float sum = 1.f;
+	float term = 1.f;
+	float halfXSquared = 0.25f * x * x;
+	for (int termNum = 1; termNum < 32; ++termNum)
+	{
+		term *= halfXSquared / static_cast<float>(termNum * termNum);
+		sum += term;
+		if (term < sum * 1e-7f)
+			break;
+	}
+	return sum;
+}
+
+//Sinc at the destination rate times a Kaiser window three destination texels wide, weights for each dest index sum to 1.
+//Tap indexes are clamped to the source here so the filter loops never check edges
+static void GetKaiserMipWeights(int sourceSize, int destSize, std::vector<int>& out_tapIndexes, std::vector<float>& out_weights, int& out_numTaps)
+{
+	constexpr float KAISER_ALPHA = 4.f;
+	constexpr float KAISER_HALF_WIDTH = 1.5f;
+
+	float scale = static_cast<float>(sourceSize) / static_cast<float>(destSize);
+	float radius = KAISER_HALF_WIDTH * scale;
+	out_numTaps = static_cast<int>(ceilf(radius * 2.f)) + 1;
+	out_tapIndexes.resize((size_t)destSize * out_numTaps);
+	out_weights.resize((size_t)destSize * out_numTaps);
+
+	float besselAlpha = GetBesselI0(KAISER_ALPHA);
+	for (int destIndex = 0; destIndex < destSize; ++destIndex)
+	{
+		float center = (static_cast<float>(destIndex) + 0.5f) * scale - 0.5f;
+		int firstTap = static_cast<int>(floorf(center - radius)) + 1;
+		int* tapIndexes = &out_tapIndexes[(size_t)destIndex * out_numTaps];
+		float* weights = &out_weights[(size_t)destIndex * out_numTaps];
+		float totalWeight = 0.f;
+		for (int tapNum = 0; tapNum < out_numTaps; ++tapNum)
+		{
+			float offset = static_cast<float>(firstTap + tapNum) - center;
+			float windowPosition = offset / radius;
+			float weight = 0.f;
+			if (windowPosition > -1.f && windowPosition < 1.f)
+			{
+				float sincX = pi * offset / scale;
+				float sinc = (fabsf(sincX) > 1e-5f) ? sinf(sincX) / sincX : 1.f;
+				weight = sinc * GetBesselI0(KAISER_ALPHA * sqrtf(1.f - windowPosition * windowPosition)) / besselAlpha;
+			}
+			tapIndexes[tapNum] = GetClampedInt(firstTap + tapNum, 0, sourceSize - 1);
+			weights[tapNum] = weight;
+			totalWeight += weight;
+		}
+
+		for (int tapNum = 0; tapNum < out_numTaps; ++tapNum)
+		{
+			weights[tapNum] /= totalWeight;
+		}
+	}
+}
+
+Image Image::CreateNextMip(MipFilter filter) const
+{
+	IntVec2 sourceDims = m_dimensions;
+	IntVec2 mipDims((sourceDims.x > 1) ? sourceDims.x / 2 : 1, (sourceDims.y > 1) ? sourceDims.y / 2 : 1);
+	Image mip(mipDims, Rgba8::WHITE);
+	mip.m_imageFilePath = m_imageFilePath;
+
+	if (filter == MipFilter::BOX)
+	{
+		//odd sizes drop the last row or column, a 1 wide side averages the texel with itself
+		for (int mipY = 0; mipY < mipDims.y; ++mipY)
+		{
+			Rgba8 const* sourceRow0 = &m_rgbaTexels[(size_t)(mipY * 2) * sourceDims.x];
+			Rgba8 const* sourceRow1 = &m_rgbaTexels[(size_t)GetClampedInt(mipY * 2 + 1, 0, sourceDims.y - 1) * sourceDims.x];
+			Rgba8* mipRow = &mip.m_rgbaTexels[(size_t)mipY * mipDims.x];
+			for (int mipX = 0; mipX < mipDims.x; ++mipX)
+			{
+				int x0 = mipX * 2;
+				int x1 = GetClampedInt(x0 + 1, 0, sourceDims.x - 1);
+				mipRow[mipX].r = static_cast<unsigned char>((sourceRow0[x0].r + sourceRow0[x1].r + sourceRow1[x0].r + sourceRow1[x1].r + 2) >> 2);
+				mipRow[mipX].g = static_cast<unsigned char>((sourceRow0[x0].g + sourceRow0[x1].g + sourceRow1[x0].g + sourceRow1[x1].g + 2) >> 2);
+				mipRow[mipX].b = static_cast<unsigned char>((sourceRow0[x0].b + sourceRow0[x1].b + sourceRow1[x0].b + sourceRow1[x1].b + 2) >> 2);
+				mipRow[mipX].a = static_cast<unsigned char>((sourceRow0[x0].a + sourceRow0[x1].a + sourceRow1[x0].a + sourceRow1[x1].a + 2) >> 2);
+			}
+		}
+		return mip;
+	}
+
+	//separable, rows into a float buffer at the mip width and then columns, taps past an edge clamp to it
+	std::vector<int> tapIndexesX;
+	std::vector<float> weightsX;
+	int numTapsX = 0;
+	GetKaiserMipWeights(sourceDims.x, mipDims.x, tapIndexesX, weightsX, numTapsX);
+
+	std::vector<int> tapIndexesY;
+	std::vector<float> weightsY;
+	int numTapsY = 0;
+	GetKaiserMipWeights(sourceDims.y, mipDims.y, tapIndexesY, weightsY, numTapsY);
+
+	std::vector<Vec4> rowFiltered((size_t)mipDims.x * sourceDims.y);
+	for (int sourceY = 0; sourceY < sourceDims.y; ++sourceY)
+	{
+		Rgba8 const* sourceRow = &m_rgbaTexels[(size_t)sourceY * sourceDims.x];
+		for (int mipX = 0; mipX < mipDims.x; ++mipX)
+		{
+			int const* tapIndexes = &tapIndexesX[(size_t)mipX * numTapsX];
+			float const* weights = &weightsX[(size_t)mipX * numTapsX];
+			Vec4 sum;
+			for (int tapNum = 0; tapNum < numTapsX; ++tapNum)
+			{
+				Rgba8 const& texel = sourceRow[tapIndexes[tapNum]];
+				sum.x += weights[tapNum] * static_cast<float>(texel.r);
+				sum.y += weights[tapNum] * static_cast<float>(texel.g);
+				sum.z += weights[tapNum] * static_cast<float>(texel.b);
+				sum.w += weights[tapNum] * static_cast<float>(texel.a);
+			}
+			rowFiltered[(size_t)sourceY * mipDims.x + mipX] = sum;
+		}
+	}
+
+	//whole filtered rows at a time so the column pass reads memory in order
+	std::vector<Vec4> columnSums(mipDims.x);
+	for (int mipY = 0; mipY < mipDims.y; ++mipY)
+	{
+		int const* tapIndexes = &tapIndexesY[(size_t)mipY * numTapsY];
+		float const* weights = &weightsY[(size_t)mipY * numTapsY];
+		std::fill(columnSums.begin(), columnSums.end(), Vec4());
+		for (int tapNum = 0; tapNum < numTapsY; ++tapNum)
+		{
+			float weight = weights[tapNum];
+			Vec4 const* filteredRow = &rowFiltered[(size_t)tapIndexes[tapNum] * mipDims.x];
+			for (int mipX = 0; mipX < mipDims.x; ++mipX)
+			{
+				columnSums[mipX].x += weight * filteredRow[mipX].x;
+				columnSums[mipX].y += weight * filteredRow[mipX].y;
+				columnSums[mipX].z += weight * filteredRow[mipX].z;
+				columnSums[mipX].w += weight * filteredRow[mipX].w;
+			}
+		}
+
+		Rgba8* mipRow = &mip.m_rgbaTexels[(size_t)mipY * mipDims.x];
+		for (int mipX = 0; mipX < mipDims.x; ++mipX)
+		{
+			mipRow[mipX].r = GetRoundedTexelChannel(columnSums[mipX].x);
+			mipRow[mipX].g = GetRoundedTexelChannel(columnSums[mipX].y);
+			mipRow[mipX].b = GetRoundedTexelChannel(columnSums[mipX].z);
+			mipRow[mipX].a = GetRoundedTexelChannel(columnSums[mipX].w);
+		}
+	}
+	return mip;
+}
+
+void Image::GenerateMipChain(std::vector<Image>& out_mips, MipFilter filter) const
+{
+	//each level filters the one above it, the cost is dominated by the first
+	Image const* sourceLevel = this;
+	IntVec2 levelDims = m_dimensions;
+	int numLevels = 0;
+	while (levelDims.x > 1 || levelDims.y > 1)
+	{
+		levelDims = IntVec2((levelDims.x > 1) ? levelDims.x / 2 : 1, (levelDims.y > 1) ? levelDims.y / 2 : 1);
+		numLevels++;
+	}
+
+	out_mips.clear();
+	out_mips.reserve(numLevels);
+	for (int levelNum = 0; levelNum < numLevels; ++levelNum)
+	{
+		out_mips.push_back(sourceLevel->CreateNextMip(filter));
+		sourceLevel = &out_mips.back();
+	}
+}
+
+//Texel conversion
+//-----------------------------------------------------------------------------------------------
+void ExpandTexelsToRgba8Scalar(int numTexels, unsigned char const* texelData, int bytesPerTexel, Rgba8* out_rgbaTexels)
+{
+	for (int texelNum = 0; texelNum < numTexels; ++texelNum)
+	{
+		unsigned char const* texel = texelData + (size_t)texelNum * bytesPerTexel;
+		Rgba8& rgbaTexel = out_rgbaTexels[texelNum];
+		if (bytesPerTexel <= 2)
+		{
+			rgbaTexel.r = texel[0];
+			rgbaTexel.g = texel[0];
+			rgbaTexel.b = texel[0];
+			rgbaTexel.a = (bytesPerTexel == 2) ? texel[1] : 255;
+		}
+		else
+		{
+			rgbaTexel.r = texel[0];
+			rgbaTexel.g = texel[1];
+			rgbaTexel.b = texel[2];
+			rgbaTexel.a = (bytesPerTexel == 4) ? texel[3] : 255;
+		}
+	}
+}
+
+void ExpandTexelsToRgba8(int numTexels, unsigned char const* texelData, int bytesPerTexel, Rgba8* out_rgbaTexels)
+{
+	//Rgba8 is four bytes in RGBA order, the same layout stb writes for 4 channels
+	if (bytesPerTexel == 4)
+	{
+		memcpy(out_rgbaTexels, texelData, (size_t)numTexels * sizeof(Rgba8));
+		return;
+	}
+
+	int texelNum = 0;
+#if defined(IMAGE_USE_SSSE3)
+	if (bytesPerTexel == 3)
+	{
+		//4 RGB texels per 16 byte load, stopping while a full load still stays inside the source
+		__m128i const rgbToRgba = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+		__m128i const opaqueAlpha = _mm_set1_epi32(static_cast<int>(0xFF000000));
+		for (; texelNum + 6 <= numTexels; texelNum += 4)
+		{
+			__m128i rgb = _mm_loadu_si128(reinterpret_cast<__m128i const*>(texelData + (size_t)texelNum * 3));
+			__m128i rgba = _mm_or_si128(_mm_shuffle_epi8(rgb, rgbToRgba), opaqueAlpha);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out_rgbaTexels + texelNum), rgba);
+		}
+	}
+#endif
+
+	ExpandTexelsToRgba8Scalar(numTexels - texelNum, texelData + (size_t)texelNum * bytesPerTexel, bytesPerTexel, out_rgbaTexels + texelNum);
+}
+
+void FillTexels(int numTexels, Rgba8 color, Rgba8* out_rgbaTexels)
+{
+	int packedColor = 0;
+	memcpy(&packedColor, &color.r, sizeof(packedColor));
+	__m128i fourTexels = _mm_set1_epi32(packedColor);
+
+	int texelNum = 0;
+	for (; texelNum + 4 <= numTexels; texelNum += 4)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out_rgbaTexels + texelNum), fourTexels);
+	}
+	for (; texelNum < numTexels; ++texelNum)
+	{
+		out_rgbaTexels[texelNum] = color;
+	}
+}
@@ -4,11 +4,18 @@
 #include <string>
 #include <vector>
 
+enum class MipFilter
+{
+	BOX,	//2x2 average, cheap and soft
+	KAISER,	//Kaiser windowed sinc over 6x6 source texels, keeps more detail but can ring on hard edges
+};
+
 class Image
 {
 public:
-	Image(char const* imageFilePath);
+	Image(char const* imageFilePath, bool flipVertically = true); //flipped so uv (0,0) is the bottom left texel
 	Image(IntVec2 size, Rgba8 color);
+	Image(IntVec2 size, Rgba8 const* texels, std::string const& imageFilePath); //copies already decoded texels, e.g. from a cooked image
 	~Image();
 
 	std::string const& GetImageFilePath() const;
@@ -17,9 +24,18 @@ public:
 	Rgba8 GetTexelColor(IntVec2 const& texelCoords)const;
 	void SetTexelColor(IntVec2 const& texelCoords, Rgba8 const& newColor);
 
+	//Mips are half the size of the level above (rounded down, at least 1) in straight alpha and stored color space
+	Image CreateNextMip(MipFilter filter = MipFilter::BOX) const;
+	void GenerateMipChain(std::vector<Image>& out_mips, MipFilter filter = MipFilter::BOX) const; //every level below this one down to 1x1
+
 private:
 	std::string m_imageFilePath;
 	IntVec2 m_dimensions = IntVec2::ZERO;
 	std::vector<Rgba8> m_rgbaTexels;
 };
 
+//Tightly packed 1 (grey), 2 (grey alpha), 3 (RGB) or 4 channel texels to RGBA8, missing alpha is opaque
+void ExpandTexelsToRgba8(int numTexels, unsigned char const* texelData, int bytesPerTexel, Rgba8* out_rgbaTexels);
+void ExpandTexelsToRgba8Scalar(int numTexels, unsigned char const* texelData, int bytesPerTexel, Rgba8* out_rgbaTexels); //reference for the SIMD RGB path
+void FillTexels(int numTexels, Rgba8 color, Rgba8* out_rgbaTexels);
+
@@ -0,0 +1,36 @@
+#include "Engine/Core/ImageLoadJob.hpp"
+#include "Engine/Core/Image.hpp"
+#include "Engine/Core/CookedImage.hpp"
+
+ImageLoadJob::ImageLoadJob(char const* imageFilePath, std::string const& cookedImageFolder)
+	:m_imageFilePath(imageFilePath)
+	,m_cookedImageFolder(cookedImageFolder)
+{
+}
+
+ImageLoadJob::~ImageLoadJob()
+{
+	delete m_image;
+	m_image = nullptr;
+}
+
+void ImageLoadJob::Execute()
+{
+	if (m_cookedImageFolder.empty())
+	{
+		m_image = new Image(m_imageFilePath.c_str());
+		return;
+	}
+
+	m_image = LoadImageThroughCookedCache(m_imageFilePath.c_str(), m_cookedImageFolder.c_str());
+}
+
+Image* ImageLoadJob::TakeImage()
+{
+	if (!IsFinished())
+		return nullptr;
+
+	Image* image = m_image;
+	m_image = nullptr;
+	return image;
+}
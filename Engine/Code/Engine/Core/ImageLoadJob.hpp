@@ -0,0 +1,23 @@
+#pragma once
+#include "Engine/Core/JobSystem.hpp"
+#include <string>
+
+class Image;
+
+//Reads and decodes an image file on a JobSystem worker, whoever finishes the job takes the image
+class ImageLoadJob : public Job
+{
+public:
+	explicit ImageLoadJob(char const* imageFilePath, std::string const& cookedImageFolder = ""); //see LoadImageThroughCookedCache
+	virtual ~ImageLoadJob();
+
+	virtual void Execute() override;
+
+	std::string const&	GetImageFilePath() const { return m_imageFilePath; }
+	Image*				TakeImage(); //nullptr until finished, caller deletes it
+
+private:
+	std::string m_imageFilePath;
+	std::string m_cookedImageFolder;
+	Image* m_image = nullptr;
+};
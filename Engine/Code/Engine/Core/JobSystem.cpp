@@ -0,0 +1,123 @@
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+JobSystem::JobSystem(JobSystemConfig const& config)
+	:m_config(config)
+{
+}
+
+void JobSystem::Startup()
+{
+	int numWorkers = m_config.m_numWorkers;
+	if (numWorkers < 0)
+	{
+		int numHardwareThreads = static_cast<int>(std::thread::hardware_concurrency());
+		numWorkers = (numHardwareThreads > 1) ? numHardwareThreads - 1 : 1;
+	}
+
+	m_isShuttingDown = false;
+	m_workers.reserve(numWorkers);
+	for (int workerNum = 0; workerNum < numWorkers; ++workerNum)
+	{
+		m_workers.emplace_back(&JobSystem::WorkerMain, this);
+	}
+}
+
+void JobSystem::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		m_isShuttingDown = true;
+	}
+	m_queueCondition.notify_all();
+
+	for (int workerNum = 0; workerNum < static_cast<int>(m_workers.size()); ++workerNum)
+	{
+		m_workers[workerNum].join();
+	}
+	m_workers.clear();
+}
+
+void JobSystem::QueueJob(Job* job)
+{
+	GUARANTEE_OR_DIE(job->GetStatus() != JobStatus::QUEUED && job->GetStatus() != JobStatus::EXECUTING, "Queued a job that is already in flight");
+
+	job->m_status.store(JobStatus::QUEUED, std::memory_order_release);
+	m_numUnfinishedJobs++;
+	{
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		m_queuedJobs.push_back(job);
+	}
+	m_queueCondition.notify_one();
+}
+
+bool JobSystem::TryExecuteQueuedJob()
+{
+	Job* job = nullptr;
+	{
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		if (m_queuedJobs.empty())
+			return false;
+
+		job = m_queuedJobs.front();
+		m_queuedJobs.pop_front();
+	}
+
+	ExecuteJob(job);
+	return true;
+}
+
+void JobSystem::WaitForJob(Job* job)
+{
+	while (!job->IsFinished())
+	{
+		if (!TryExecuteQueuedJob())
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+void JobSystem::WaitForAllJobs()
+{
+	while (m_numUnfinishedJobs.load() > 0)
+	{
+		if (!TryExecuteQueuedJob())
+		{
+			std::this_thread::yield();
+		}
+	}
+}
+
+int JobSystem::GetNumQueuedJobs() const
+{
+	std::lock_guard<std::mutex> lock(m_queueMutex);
+	return static_cast<int>(m_queuedJobs.size());
+}
+
+void JobSystem::WorkerMain()
+{
+	for (;;)
+	{
+		Job* job = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(m_queueMutex);
+			m_queueCondition.wait(lock, [this]() { return m_isShuttingDown || !m_queuedJobs.empty(); });
+			if (m_isShuttingDown)
+				return;
+
+			job = m_queuedJobs.front();
+			m_queuedJobs.pop_front();
+		}
+
+		ExecuteJob(job);
+	}
+}
+
+void JobSystem::ExecuteJob(Job* job)
+{
+	job->m_status.store(JobStatus::EXECUTING, std::memory_order_release);
+	job->Execute();
+	job->m_status.store(JobStatus::FINISHED, std::memory_order_release);
+	m_numUnfinishedJobs--;
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
+enum class JobStatus : int
+{
+	NEW,
+	QUEUED,
+	EXECUTING,
+	FINISHED,
+};
+
+//Work for a JobSystem worker. Execute() runs on some worker (or on the waiting thread, see JobSystem::WaitForJob),
+//anything that has to happen on the owning thread is done there after IsFinished() returns true. The owner deletes the job.
+class Job
+{
+	friend class JobSystem;
+
+public:
+	virtual ~Job() {}
+	virtual void Execute() = 0;
+
+	JobStatus	GetStatus() const { return m_status.load(std::memory_order_acquire); }
+	bool		IsFinished() const { return GetStatus() == JobStatus::FINISHED; }
+
+private:
+	std::atomic<JobStatus> m_status{ JobStatus::NEW };
+};
+
+struct JobSystemConfig
+{
+	int m_numWorkers = -1; //-1 for one less than the hardware threads, 0 runs every job on the thread that waits for it
+};
+
+//Fixed pool of worker threads pulling jobs off one FIFO queue
+class JobSystem
+{
+public:
+	explicit JobSystem(JobSystemConfig const& config);
+	~JobSystem() {}
+
+	void	Startup();
+	void	Shutdown(); //workers stop, jobs still queued stay QUEUED and run if their owner waits on them
+
+	void	QueueJob(Job* job);
+	bool	TryExecuteQueuedJob(); //lets a waiting thread help, false if the queue was empty
+	void	WaitForJob(Job* job); //helps with queued jobs until this one finishes
+	void	WaitForAllJobs();
+
+	int		GetNumWorkers() const { return static_cast<int>(m_workers.size()); }
+	int		GetNumQueuedJobs() const;
+
+private:
+	void	WorkerMain();
+	void	ExecuteJob(Job* job);
+
+private:
+	JobSystemConfig m_config;
+	std::vector<std::thread> m_workers;
+
+	mutable std::mutex m_queueMutex;
+	std::condition_variable m_queueCondition;
+	std::deque<Job*> m_queuedJobs;
+	std::atomic<int> m_numUnfinishedJobs{ 0 };
+	bool m_isShuttingDown = false;
+};
@@ -96,7 +96,9 @@ int NamedStrings::GetValue(std::string const& keyName, int defaultValue, bool de
 		return defaultValue;
 	}
 
-	return atoi(found->second.c_str());
+	int value = 0;
+	ParseNumberFromText(found->second, value);
+	return value;
 }
 
 float NamedStrings::GetValue(std::string const& keyName, float defaultValue, bool defaultLowerCase) const
@@ -114,7 +116,9 @@ float NamedStrings::GetValue(std::string const& keyName, float defaultValue, boo
 	}
 
 
-	return (float)atof(found->second.c_str());
+	float value = 0.f;
+	ParseNumberFromText(found->second, value);
+	return value;
 }
 
 std::string NamedStrings::GetValue(std::string const& keyName, char const* defaultValue, bool defaultLowerCase) const
@@ -205,13 +209,11 @@ EulerAngles NamedStrings::GetValue(std::string const& keyName, EulerAngles const
 		return defaultValue;
 	}
 
-	Strings angleStrings = SplitStringOnDelimiter(found->second, ',');
-	if(angleStrings.size() < 3)
+	float angles[3] = {};
+	if (ParseNumbersFromText(found->second, ',', angles, 3) < 3)
 		return defaultValue;
 
-	EulerAngles newEulerAngles;
-	newEulerAngles.SetFromText(found->second.c_str());
-	return newEulerAngles;
+	return EulerAngles(angles[0], angles[1], angles[2]);
 }
 
 bool NamedStrings::HasKey(std::string const& keyName, bool defaultLowerCase) const
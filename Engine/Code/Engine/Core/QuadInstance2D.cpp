@@ -0,0 +1,30 @@
+#include "Engine/Core/QuadInstance2D.hpp"
+
+QuadInstance2D::QuadInstance2D(AABB2 const& worldBounds, Rgba8 const& tint, AABB2 const& uvs)
+	:m_localBounds(worldBounds)
+	,m_uvs(uvs)
+	,m_tint(tint)
+{
+}
+
+QuadInstance2D::QuadInstance2D(AABB2 const& localBounds, Vec2 const& iBasis, Vec2 const& position, Rgba8 const& tint, AABB2 const& uvs)
+	:m_position(position)
+	,m_iBasis(iBasis)
+	,m_localBounds(localBounds)
+	,m_uvs(uvs)
+	,m_tint(tint)
+{
+}
+
+void QuadInstance2D::GetCornerPositions(Vec2* out_fourCorners) const
+{
+	Vec2 jBasis(-m_iBasis.y, m_iBasis.x);
+	Vec2 mins = m_position + (m_iBasis * m_localBounds.m_mins.x) + (jBasis * m_localBounds.m_mins.y);
+	Vec2 stepI = m_iBasis * (m_localBounds.m_maxs.x - m_localBounds.m_mins.x);
+	Vec2 stepJ = jBasis * (m_localBounds.m_maxs.y - m_localBounds.m_mins.y);
+
+	out_fourCorners[0] = mins;
+	out_fourCorners[1] = mins + stepI;
+	out_fourCorners[2] = mins + stepI + stepJ;
+	out_fourCorners[3] = mins + stepJ;
+}
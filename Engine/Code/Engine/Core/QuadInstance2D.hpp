@@ -0,0 +1,27 @@
+#pragma once
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Core/Rgba8.hpp"
+
+//One transformed 2D quad, expanded to its 4 corners by the instanced quad shader (or AddVertsForQuadInstances2D on the CPU).
+//Corners are m_localBounds placed with the I basis and its 90 degree rotation as J, then offset by m_position,
+//the same as TransformVertexArrayXY3D with a perpendicular basis. A non unit I basis scales the quad uniformly.
+struct QuadInstance2D
+{
+public:
+	Vec2 m_position;
+	Vec2 m_iBasis = Vec2(1.f, 0.f);
+	AABB2 m_localBounds = AABB2(0.f, 0.f, 1.f, 1.f);
+	AABB2 m_uvs = AABB2(0.f, 0.f, 1.f, 1.f);
+	Rgba8 m_tint;
+public:
+	~QuadInstance2D(){}
+	QuadInstance2D(){}
+
+	explicit QuadInstance2D(AABB2 const& worldBounds, Rgba8 const& tint = Rgba8::WHITE, AABB2 const& uvs = AABB2::ZERO_TO_ONE);
+	explicit QuadInstance2D(AABB2 const& localBounds, Vec2 const& iBasis, Vec2 const& position, Rgba8 const& tint = Rgba8::WHITE, AABB2 const& uvs = AABB2::ZERO_TO_ONE);
+
+	void GetCornerPositions(Vec2* out_fourCorners) const; //BL, BR, TR, TL
+};
+
+static_assert(sizeof(QuadInstance2D) == 52, "QuadInstance2D must match the instanced quad input layout");
@@ -76,15 +76,15 @@ Rgba8 Rgba8::GetRandomColor(RandomNumberGenerator* rng)
 
 void Rgba8::SetFromText(char const* text)
 {
-	Strings numsFromText = SplitStringOnDelimiter(text, ',');
-	size_t numValues = numsFromText.size();
-	r = static_cast<unsigned char>(GetClampedInt(atoi(numsFromText[0].c_str()), 0, 255));
-	g = static_cast<unsigned char>(GetClampedInt(atoi(numsFromText[1].c_str()), 0, 255));
-	b = static_cast<unsigned char>(GetClampedInt(atoi(numsFromText[2].c_str()), 0, 255));
+	int numsFromText[4] = {};
+	int numValues = ParseNumbersFromText(text, ',', numsFromText, 4);
+	r = static_cast<unsigned char>(GetClampedInt(numsFromText[0], 0, 255));
+	g = static_cast<unsigned char>(GetClampedInt(numsFromText[1], 0, 255));
+	b = static_cast<unsigned char>(GetClampedInt(numsFromText[2], 0, 255));
 
 	if (numValues > 3)
 	{
-		a = static_cast<unsigned char>(GetClampedInt(atoi(numsFromText[3].c_str()), 0, 255));
+		a = static_cast<unsigned char>(GetClampedInt(numsFromText[3], 0, 255));
 	}
 }
 
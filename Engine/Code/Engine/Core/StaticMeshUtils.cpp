@@ -1,14 +1,654 @@
 #include "Engine/Core/StaticMeshUtils.hpp"
 #include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Math/MathUtils.hpp"
 #include "Engine/Math/Vec3.hpp"
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
 #include <vector>
 
-bool ParseOBJMeshTextBuffer(VertTBNs& verts, std::string const& objFileContents, char const* fileNameForErrorReporting)
+static_assert(sizeof(MeshCacheHeader) == 48, "Mesh cache header layout changed, bump MESH_CACHE_VERSION");
+
+constexpr size_t MIN_OBJ_BYTES_PER_PARSE_JOB = 256 * 1024; //smaller ranges cost more to hand out than to parse
+constexpr int OBJ_NO_INDEX = -1;
+
+//Parsing
+//-----------------------------------------------------------------------------------------------
+//One triangle corner as written in the file. Negative (relative) indexes are resolved while parsing against the counts
+//seen so far in this range, which leaves them relative to the range's first element until the ranges are merged
+struct OBJCorner
+{
+	int m_positionIndex = 0;
+	int m_uvIndex = OBJ_NO_INDEX;
+	int m_normalIndex = OBJ_NO_INDEX;
+	uint8_t m_rangeRelativeMask = 0; //bit 0 position, bit 1 uv, bit 2 normal
+};
+
+//A run of whole lines and everything parsed from it. Errors are kept as text with the byte they were found at so
+//worker threads never report, the thread that merges the ranges does
+struct OBJParseRange
+{
+	std::string_view m_text;
+	std::vector<Vec3> m_positions;
+	std::vector<Vec2> m_uvs;
+	std::vector<Vec3> m_normals;
+	std::vector<OBJCorner> m_corners; //three per triangle
+	std::string m_error;
+	size_t m_errorOffset = 0;
+};
+
+static bool IsOBJSpace(char c)
+{
+	return c == ' ' || c == '\t' || c == '\r';
+}
+
+static char const* SkipOBJSpaces(char const* text, char const* lineEnd)
+{
+	while (text < lineEnd && IsOBJSpace(*text))
+	{
+		++text;
+	}
+	return text;
+}
+
+static bool ParseOBJFloat(char const*& text, char const* lineEnd, float& out_value)
+{
+	text = SkipOBJSpaces(text, lineEnd);
+	if (text < lineEnd && *text == '+')
+	{
+		++text;
+	}
+
+	std::from_chars_result result = std::from_chars(text, lineEnd, out_value);
+	if (result.ec != std::errc())
+		return false;
+
+	text = result.ptr;
+	return true;
+}
+
+//An index as written resolved to 0 based, against elementCount (so far in this range) when negative
+static bool ParseOBJIndex(char const*& text, char const* lineEnd, int elementCount, int& out_index, bool& out_isRangeRelative)
+{
+	int writtenIndex = 0;
+	std::from_chars_result result = std::from_chars(text, lineEnd, writtenIndex);
+	if (result.ec != std::errc() || writtenIndex == 0)
+		return false;
+
+	text = result.ptr;
+	out_isRangeRelative = writtenIndex < 0;
+	out_index = out_isRangeRelative ? elementCount + writtenIndex : writtenIndex - 1;
+	return true;
+}
+
+static bool ParseOBJFaceCorner(char const*& text, char const* lineEnd, OBJParseRange const& range, OBJCorner& out_corner)
+{
+	bool isRangeRelative = false;
+	out_corner = OBJCorner();
+	if (!ParseOBJIndex(text, lineEnd, (int)range.m_positions.size(), out_corner.m_positionIndex, isRangeRelative))
+		return false;
+	out_corner.m_rangeRelativeMask |= isRangeRelative ? 1 : 0;
+
+	//v, v/vt, v//vn or v/vt/vn
+	if (text >= lineEnd || *text != '/')
+		return true;
+	++text;
+	if (text < lineEnd && *text != '/')
+	{
+		if (!ParseOBJIndex(text, lineEnd, (int)range.m_uvs.size(), out_corner.m_uvIndex, isRangeRelative))
+			return false;
+		out_corner.m_rangeRelativeMask |= isRangeRelative ? 2 : 0;
+	}
+
+	if (text >= lineEnd || *text != '/')
+		return true;
+	++text;
+	if (!ParseOBJIndex(text, lineEnd, (int)range.m_normals.size(), out_corner.m_normalIndex, isRangeRelative))
+		return false;
+	out_corner.m_rangeRelativeMask |= isRangeRelative ? 4 : 0;
+	return true;
+}
+
+static bool ParseOBJLine(char const* text, char const* lineEnd, OBJParseRange& range, std::vector<OBJCorner>& polygonCorners)
+{
+	text = SkipOBJSpaces(text, lineEnd);
+	if (lineEnd - text < 2)
+		return true;
+
+	if (text[0] == 'v' && IsOBJSpace(text[1]))
+	{
+		//anything after xyz (w, or the rgb some exporters write) is ignored
+		Vec3 position;
+		text += 1;
+		if (!ParseOBJFloat(text, lineEnd, position.x) || !ParseOBJFloat(text, lineEnd, position.y) || !ParseOBJFloat(text, lineEnd, position.z))
+			return false;
+		range.m_positions.push_back(position);
+	}
+	else if (text[0] == 'v' && text[1] == 't' && lineEnd - text > 2 && IsOBJSpace(text[2]))
+	{
+		//v is optional, w is ignored
+		Vec2 uv;
+		text += 2;
+		if (!ParseOBJFloat(text, lineEnd, uv.x))
+			return false;
+		if (SkipOBJSpaces(text, lineEnd) < lineEnd && !ParseOBJFloat(text, lineEnd, uv.y))
+			return false;
+		range.m_uvs.push_back(uv);
+	}
+	else if (text[0] == 'v' && text[1] == 'n' && lineEnd - text > 2 && IsOBJSpace(text[2]))
+	{
+		Vec3 normal;
+		text += 2;
+		if (!ParseOBJFloat(text, lineEnd, normal.x) || !ParseOBJFloat(text, lineEnd, normal.y) || !ParseOBJFloat(text, lineEnd, normal.z))
+			return false;
+		range.m_normals.push_back(normal);
+	}
+	else if (text[0] == 'f' && IsOBJSpace(text[1]))
+	{
+		polygonCorners.clear();
+		text = SkipOBJSpaces(text + 1, lineEnd);
+		while (text < lineEnd)
+		{
+			OBJCorner corner;
+			if (!ParseOBJFaceCorner(text, lineEnd, range, corner) || (text < lineEnd && !IsOBJSpace(*text)))
+				return false;
+			polygonCorners.push_back(corner);
+			text = SkipOBJSpaces(text, lineEnd);
+		}
+		if (polygonCorners.size() < 3)
+			return false;
+
+		//fan, fine for the convex polygons exporters write
+		for (size_t cornerIndex = 1; cornerIndex + 1 < polygonCorners.size(); ++cornerIndex)
+		{
+			range.m_corners.push_back(polygonCorners[0]);
+			range.m_corners.push_back(polygonCorners[cornerIndex]);
+			range.m_corners.push_back(polygonCorners[cornerIndex + 1]);
+		}
+	}
+	return true;
+}
+
+static void ParseOBJRange(OBJParseRange& range)
+{
+	//roughly one element per 30 bytes of text, a guess that saves most of the regrowth
+	size_t expectedNumElements = range.m_text.size() / 30;
+	range.m_positions.reserve(expectedNumElements / 2);
+	range.m_corners.reserve(expectedNumElements * 3);
+
+	std::vector<OBJCorner> polygonCorners;
+	char const* text = range.m_text.data();
+	char const* textEnd = text + range.m_text.size();
+	while (text < textEnd)
+	{
+		char const* lineEnd = static_cast<char const*>(memchr(text, '\n', textEnd - text));
+		lineEnd = (lineEnd != nullptr) ? lineEnd : textEnd;
+
+		char const* commentStart = static_cast<char const*>(memchr(text, '#', lineEnd - text));
+		if (!ParseOBJLine(text, (commentStart != nullptr) ? commentStart : lineEnd, range, polygonCorners))
+		{
+			range.m_error = std::string(text, (lineEnd > text && lineEnd[-1] == '\r') ? lineEnd - 1 : lineEnd);
+			range.m_errorOffset = text - range.m_text.data();
+			return;
+		}
+		if (lineEnd == textEnd)
+			break;
+		text = lineEnd + 1;
+	}
+}
+
+class OBJParseRangeJob : public Job
+{
+public:
+	explicit OBJParseRangeJob(OBJParseRange& range) : m_range(range) {}
+	virtual void Execute() override { ParseOBJRange(m_range); }
+
+private:
+	OBJParseRange& m_range;
+};
+
+//Cut at line starts into roughly equal ranges, one per worker plus one for the calling thread
+static void SplitOBJText(std::string_view objText, int numRanges, std::vector<OBJParseRange>& out_ranges)
+{
+	out_ranges.resize(numRanges);
+	size_t rangeStart = 0;
+	for (int rangeIndex = 0; rangeIndex < numRanges; ++rangeIndex)
+	{
+		size_t rangeEnd = objText.size();
+		if (rangeIndex + 1 < numRanges)
+		{
+			rangeEnd = objText.find('\n', rangeStart + (objText.size() - rangeStart) / (numRanges - rangeIndex));
+			rangeEnd = (rangeEnd == std::string_view::npos) ? objText.size() : rangeEnd + 1;
+		}
+		out_ranges[rangeIndex].m_text = objText.substr(rangeStart, rangeEnd - rangeStart);
+		rangeStart = rangeEnd;
+	}
+}
+
+//Building
+//-----------------------------------------------------------------------------------------------
+struct OBJVertexKey
+{
+	int m_positionIndex = 0;
+	int m_uvIndex = OBJ_NO_INDEX;
+	int m_normalIndex = OBJ_NO_INDEX;
+
+	bool operator==(OBJVertexKey const& compare) const
+	{
+		return m_positionIndex == compare.m_positionIndex && m_uvIndex == compare.m_uvIndex && m_normalIndex == compare.m_normalIndex;
+	}
+};
+
+static uint32_t HashOBJVertexKey(OBJVertexKey const& key)
+{
+	uint64_t hash = (uint64_t)(uint32_t)key.m_positionIndex * 0x9E3779B97F4A7C15ull;
+	hash ^= ((uint64_t)(uint32_t)key.m_uvIndex + 0x632BE59BD9B4E019ull) * 0xC2B2AE3D27D4EB4Full;
+	hash ^= ((uint64_t)(uint32_t)key.m_normalIndex + 0x165667B19E3779F9ull) * 0x94D049BB133111EBull;
+	return (uint32_t)(hash ^ (hash >> 29) ^ (hash >> 47));
+}
+
+//Open addressing, linear probing, slots hold an index into the unique keys so a rehash never moves them
+class OBJVertexTable
+{
+public:
+	explicit OBJVertexTable(size_t expectedNumVertexes)
+	{
+		Rehash(expectedNumVertexes * 2);
+	}
+
+	unsigned int FindOrAdd(OBJVertexKey const& key)
+	{
+		if ((m_keys.size() + 1) * 2 > m_slots.size())
+		{
+			Rehash(m_slots.size() * 2);
+		}
+
+		size_t slotIndex = HashOBJVertexKey(key) & m_slotMask;
+		while (m_slots[slotIndex] != EMPTY_SLOT)
+		{
+			if (m_keys[m_slots[slotIndex]] == key)
+				return m_slots[slotIndex];
+			slotIndex = (slotIndex + 1) & m_slotMask;
+		}
+
+		m_slots[slotIndex] = (unsigned int)m_keys.size();
+		m_keys.push_back(key);
+		return m_slots[slotIndex];
+	}
+
+	std::vector<OBJVertexKey> const& GetKeys() const { return m_keys; }
+
+private:
+	void Rehash(size_t minNumSlots)
+	{
+		size_t numSlots = 1024;
+		while (numSlots < minNumSlots)
+		{
+			numSlots *= 2;
+		}
+
+		m_slots.assign(numSlots, EMPTY_SLOT);
+		m_slotMask = numSlots - 1;
+		for (unsigned int keyIndex = 0; keyIndex < (unsigned int)m_keys.size(); ++keyIndex)
+		{
+			size_t slotIndex = HashOBJVertexKey(m_keys[keyIndex]) & m_slotMask;
+			while (m_slots[slotIndex] != EMPTY_SLOT)
+			{
+				slotIndex = (slotIndex + 1) & m_slotMask;
+			}
+			m_slots[slotIndex] = keyIndex;
+		}
+	}
+
+private:
+	static constexpr unsigned int EMPTY_SLOT = 0xFFFFFFFF;
+	std::vector<unsigned int> m_slots;
+	std::vector<OBJVertexKey> m_keys;
+	size_t m_slotMask = 0;
+};
+
+static int GetOBJLineNumber(std::string_view objText, size_t byteOffset)
+{
+	int lineNumber = 1;
+	for (size_t byteIndex = 0; byteIndex < byteOffset; ++byteIndex)
+	{
+		lineNumber += (objText[byteIndex] == '\n') ? 1 : 0;
+	}
+	return lineNumber;
+}
+
+static bool ResolveOBJIndex(int index, bool isRangeRelative, int rangeBase, int numElements, int& out_index)
+{
+	if (index == OBJ_NO_INDEX && !isRangeRelative)
+		return true;
+
+	out_index = isRangeRelative ? rangeBase + index : index;
+	return out_index >= 0 && out_index < numElements;
+}
+
+static Vec3 GetAnyPerpendicular(Vec3 const& normal)
+{
+	Vec3 axis = (fabsf(normal.x) < 0.9f) ? Vec3(1.f, 0.f, 0.f) : Vec3(0.f, 1.f, 0.f);
+	return (axis - normal * DotProduct3D(normal, axis)).GetNormalized();
+}
+
+//Normals where the file had none and a tangent basis from the uvs, both summed over the triangles around each vertex
+static void GenerateOBJNormalsAndTangents(VertTBNs& verts, std::vector<unsigned int> const& indexes, std::vector<bool> const& needsNormal)
+{
+	for (size_t triangleStart = 0; triangleStart + 2 < indexes.size(); triangleStart += 3)
+	{
+		Vertex_PCUTBN& vert0 = verts[indexes[triangleStart]];
+		Vertex_PCUTBN& vert1 = verts[indexes[triangleStart + 1]];
+		Vertex_PCUTBN& vert2 = verts[indexes[triangleStart + 2]];
+
+		Vec3 edge1 = vert1.m_position - vert0.m_position;
+		Vec3 edge2 = vert2.m_position - vert0.m_position;
+		Vec3 areaWeightedNormal = CrossProduct3D(edge1, edge2);
+		for (int cornerIndex = 0; cornerIndex < 3; ++cornerIndex)
+		{
+			unsigned int vertIndex = indexes[triangleStart + cornerIndex];
+			if (needsNormal[vertIndex])
+			{
+				verts[vertIndex].m_normal += areaWeightedNormal;
+			}
+		}
+
+		Vec2 deltaUV1 = vert1.m_uvTexCoords - vert0.m_uvTexCoords;
+		Vec2 deltaUV2 = vert2.m_uvTexCoords - vert0.m_uvTexCoords;
+		float determinant = deltaUV1.x * deltaUV2.y - deltaUV2.x * deltaUV1.y;
+		if (determinant == 0.f)
+			continue;
+
+		float inverseDeterminant = 1.f / determinant;
+		Vec3 tangent = (edge1 * deltaUV2.y - edge2 * deltaUV1.y) * inverseDeterminant;
+		Vec3 biTangent = (edge2 * deltaUV1.x - edge1 * deltaUV2.x) * inverseDeterminant;
+		vert0.m_tangent += tangent;
+		vert1.m_tangent += tangent;
+		vert2.m_tangent += tangent;
+		vert0.m_biTangent += biTangent;
+		vert1.m_biTangent += biTangent;
+		vert2.m_biTangent += biTangent;
+	}
+
+	//Gram-Schmidt against the normal, bitangent keeps the uv handedness so mirrored uvs still light correctly
+	for (Vertex_PCUTBN& vert : verts)
+	{
+		vert.m_normal = vert.m_normal.GetNormalized();
+		Vec3 tangent = vert.m_tangent - vert.m_normal * DotProduct3D(vert.m_normal, vert.m_tangent);
+		vert.m_tangent = (tangent.GetLengthSquared() > 0.f) ? tangent.GetNormalized() : GetAnyPerpendicular(vert.m_normal);
+
+		Vec3 biTangent = CrossProduct3D(vert.m_normal, vert.m_tangent);
+		vert.m_biTangent = (DotProduct3D(biTangent, vert.m_biTangent) < 0.f) ? -biTangent : biTangent;
+	}
+}
+
+static bool BuildOBJMesh(VertTBNs& verts, std::vector<unsigned int>& indexes, std::vector<OBJParseRange> const& ranges, std::string_view objText, char const* fileNameForErrorReporting)
 {
-	Strings lineArgs;
-	
+	int numPositions = 0;
+	int numUVs = 0;
+	int numNormals = 0;
+	size_t numCorners = 0;
+	for (OBJParseRange const& range : ranges)
+	{
+		if (!range.m_error.empty())
+		{
+			size_t errorOffset = (range.m_text.data() - objText.data()) + range.m_errorOffset;
+			ERROR_RECOVERABLE(Stringf("OBJ \"%s\" line %d can't be read: \"%s\"", fileNameForErrorReporting, GetOBJLineNumber(objText, errorOffset), range.m_error.c_str()));
+			return false;
+		}
+		numPositions += (int)range.m_positions.size();
+		numUVs += (int)range.m_uvs.size();
+		numNormals += (int)range.m_normals.size();
+		numCorners += range.m_corners.size();
+	}
+
 	std::vector<Vec3> positions;
-	std::vector<Vec3> normals;
 	std::vector<Vec2> uvs;
-	return false;
+	std::vector<Vec3> normals;
+	positions.reserve(numPositions);
+	uvs.reserve(numUVs);
+	normals.reserve(numNormals);
+	for (OBJParseRange const& range : ranges)
+	{
+		positions.insert(positions.end(), range.m_positions.begin(), range.m_positions.end());
+		uvs.insert(uvs.end(), range.m_uvs.begin(), range.m_uvs.end());
+		normals.insert(normals.end(), range.m_normals.begin(), range.m_normals.end());
+	}
+
+	//corners that share a position, uv and normal become one vertex
+	std::vector<unsigned int> meshIndexes;
+	meshIndexes.reserve(numCorners);
+	OBJVertexTable vertexTable(positions.size());
+	int positionBase = 0;
+	int uvBase = 0;
+	int normalBase = 0;
+	for (OBJParseRange const& range : ranges)
+	{
+		for (OBJCorner const& corner : range.m_corners)
+		{
+			OBJVertexKey key;
+			bool isValid = ResolveOBJIndex(corner.m_positionIndex, (corner.m_rangeRelativeMask & 1) != 0, positionBase, numPositions, key.m_positionIndex);
+			isValid = isValid && ResolveOBJIndex(corner.m_uvIndex, (corner.m_rangeRelativeMask & 2) != 0, uvBase, numUVs, key.m_uvIndex);
+			isValid = isValid && ResolveOBJIndex(corner.m_normalIndex, (corner.m_rangeRelativeMask & 4) != 0, normalBase, numNormals, key.m_normalIndex);
+			if (!isValid)
+			{
+				ERROR_RECOVERABLE(Stringf("OBJ \"%s\" has a face indexing past its %d positions, %d uvs and %d normals", fileNameForErrorReporting, numPositions, numUVs, numNormals));
+				return false;
+			}
+			meshIndexes.push_back(vertexTable.FindOrAdd(key));
+		}
+		positionBase += (int)range.m_positions.size();
+		uvBase += (int)range.m_uvs.size();
+		normalBase += (int)range.m_normals.size();
+	}
+
+	std::vector<OBJVertexKey> const& keys = vertexTable.GetKeys();
+	VertTBNs meshVerts;
+	meshVerts.reserve(keys.size());
+	std::vector<bool> needsNormal(keys.size(), false);
+	for (size_t keyIndex = 0; keyIndex < keys.size(); ++keyIndex)
+	{
+		OBJVertexKey const& key = keys[keyIndex];
+		Vec2 uv = (key.m_uvIndex != OBJ_NO_INDEX) ? uvs[key.m_uvIndex] : Vec2();
+		Vec3 normal = (key.m_normalIndex != OBJ_NO_INDEX) ? normals[key.m_normalIndex] : Vec3();
+		needsNormal[keyIndex] = key.m_normalIndex == OBJ_NO_INDEX;
+		meshVerts.push_back(Vertex_PCUTBN(positions[key.m_positionIndex], Rgba8::WHITE, Vec3(), Vec3(), normal, uv));
+	}
+	GenerateOBJNormalsAndTangents(meshVerts, meshIndexes, needsNormal);
+
+	unsigned int startIndex = (unsigned int)verts.size();
+	verts.insert(verts.end(), meshVerts.begin(), meshVerts.end());
+	indexes.reserve(indexes.size() + meshIndexes.size());
+	for (unsigned int meshIndex : meshIndexes)
+	{
+		indexes.push_back(startIndex + meshIndex);
+	}
+	return true;
+}
+
+//Mesh cache
+//-----------------------------------------------------------------------------------------------
+static bool GetOBJSourceStamp(std::string const& objFilePath, uint64_t& out_size, uint64_t& out_modifiedTime)
+{
+	std::error_code errorCode;
+	out_size = std::filesystem::file_size(objFilePath, errorCode);
+	if (errorCode)
+		return false;
+
+	std::filesystem::file_time_type modifiedTime = std::filesystem::last_write_time(objFilePath, errorCode);
+	out_modifiedTime = static_cast<uint64_t>(modifiedTime.time_since_epoch().count());
+	return !errorCode;
+}
+
+static bool LoadMeshCacheFile(VertTBNs& verts, std::vector<unsigned int>& indexes, std::string const& meshCacheFilePath, uint64_t sourceSize, uint64_t sourceModifiedTime)
+{
+	MappedFile meshCacheFile;
+	if (!meshCacheFile.Open(meshCacheFilePath) || meshCacheFile.GetSize() < sizeof(MeshCacheHeader))
+		return false;
+
+	MeshCacheHeader const& header = *reinterpret_cast<MeshCacheHeader const*>(meshCacheFile.GetData());
+	uint64_t vertexBytes = (uint64_t)header.m_numVertexes * sizeof(Vertex_PCUTBN);
+	uint64_t indexBytes = (uint64_t)header.m_numIndexes * sizeof(unsigned int);
+	bool isValid = header.m_magic == MESH_CACHE_MAGIC && header.m_version == MESH_CACHE_VERSION && header.m_vertexSize == sizeof(Vertex_PCUTBN);
+	isValid = isValid && header.m_fileSize == meshCacheFile.GetSize() && header.m_fileSize == sizeof(MeshCacheHeader) + vertexBytes + indexBytes;
+	isValid = isValid && header.m_sourceSize == sourceSize && header.m_sourceModifiedTime == sourceModifiedTime;
+	if (!isValid)
+		return false;
+
+	size_t startVertex = verts.size();
+	verts.resize(startVertex + header.m_numVertexes);
+	memcpy(verts.data() + startVertex, meshCacheFile.GetData() + sizeof(MeshCacheHeader), (size_t)vertexBytes);
+
+	size_t startIndex = indexes.size();
+	indexes.resize(startIndex + header.m_numIndexes);
+	memcpy(indexes.data() + startIndex, meshCacheFile.GetData() + sizeof(MeshCacheHeader) + vertexBytes, (size_t)indexBytes);
+	for (size_t indexIndex = startIndex; startVertex != 0 && indexIndex < indexes.size(); ++indexIndex)
+	{
+		indexes[indexIndex] += (unsigned int)startVertex;
+	}
+	return true;
+}
+
+std::string GetMeshCacheFilePath(std::string const& objFilePath)
+{
+	return std::filesystem::path(objFilePath).replace_extension(".mesh").string();
+}
+
+bool WriteMeshCacheFile(std::string const& meshCacheFilePath, VertTBNs const& verts, std::vector<unsigned int> const& indexes, uint64_t sourceSize, uint64_t sourceModifiedTime)
+{
+	MeshCacheHeader header;
+	header.m_numVertexes = (uint32_t)verts.size();
+	header.m_numIndexes = (uint32_t)indexes.size();
+	header.m_sourceSize = sourceSize;
+	header.m_sourceModifiedTime = sourceModifiedTime;
+	size_t vertexBytes = verts.size() * sizeof(Vertex_PCUTBN);
+	size_t indexBytes = indexes.size() * sizeof(unsigned int);
+	header.m_fileSize = sizeof(MeshCacheHeader) + vertexBytes + indexBytes;
+
+	std::vector<uint8_t> fileBytes((size_t)header.m_fileSize);
+	memcpy(fileBytes.data(), &header, sizeof(MeshCacheHeader));
+	memcpy(fileBytes.data() + sizeof(MeshCacheHeader), verts.data(), vertexBytes);
+	memcpy(fileBytes.data() + sizeof(MeshCacheHeader) + vertexBytes, indexes.data(), indexBytes);
+	return FileWriteFromBuffer(fileBytes, meshCacheFilePath);
+}
+
+//OBJ
+//-----------------------------------------------------------------------------------------------
+bool ParseOBJData(std::string& out_objFileContents, std::string const& objFilePath)
+{
+	return FileReadToString(out_objFileContents, objFilePath) > 0;
+}
+
+bool ParseOBJMeshTextBuffer(VertTBNs& verts, std::vector<unsigned int>& indexes, std::string_view objFileContents, char const* fileNameForErrorReporting, JobSystem* jobSystem)
+{
+	//FileReadToString keeps its null terminator in the string, it would otherwise end a last line that has no newline
+	while (!objFileContents.empty() && objFileContents.back() == '\0')
+	{
+		objFileContents.remove_suffix(1);
+	}
+
+	int numRanges = 1;
+	if (jobSystem != nullptr && jobSystem->GetNumWorkers() > 0)
+	{
+		numRanges = GetClampedInt((int)(objFileContents.size() / MIN_OBJ_BYTES_PER_PARSE_JOB), 1, jobSystem->GetNumWorkers() + 1);
+	}
+
+	std::vector<OBJParseRange> ranges;
+	SplitOBJText(objFileContents, numRanges, ranges);
+
+	//first range on this thread while the workers take the rest
+	std::vector<OBJParseRangeJob*> jobs;
+	for (int rangeIndex = 1; rangeIndex < numRanges; ++rangeIndex)
+	{
+		jobs.push_back(new OBJParseRangeJob(ranges[rangeIndex]));
+		jobSystem->QueueJob(jobs.back());
+	}
+	ParseOBJRange(ranges[0]);
+	for (OBJParseRangeJob* job : jobs)
+	{
+		jobSystem->WaitForJob(job);
+		delete job;
+	}
+
+	return BuildOBJMesh(verts, indexes, ranges, objFileContents, fileNameForErrorReporting);
+}
+
+bool ParseOBJMeshTextBuffer(VertTBNs& verts, std::string const& objFileContents, char const* fileNameForErrorReporting)
+{
+	VertTBNs meshVerts;
+	std::vector<unsigned int> meshIndexes;
+	if (!ParseOBJMeshTextBuffer(meshVerts, meshIndexes, objFileContents, fileNameForErrorReporting))
+		return false;
+
+	verts.reserve(verts.size() + meshIndexes.size());
+	for (unsigned int meshIndex : meshIndexes)
+	{
+		verts.push_back(meshVerts[meshIndex]);
+	}
+	return true;
+}
+
+bool LoadOBJMeshFile(VertTBNs& verts, std::vector<unsigned int>& indexes, std::string const& objFilePath, JobSystem* jobSystem, bool useMeshCache)
+{
+	uint64_t sourceSize = 0;
+	uint64_t sourceModifiedTime = 0;
+	if (!GetOBJSourceStamp(objFilePath, sourceSize, sourceModifiedTime))
+	{
+		ERROR_RECOVERABLE(Stringf("Could not find OBJ file \"%s\"", objFilePath.c_str()));
+		return false;
+	}
+
+	std::string meshCacheFilePath = GetMeshCacheFilePath(objFilePath);
+	if (useMeshCache && LoadMeshCacheFile(verts, indexes, meshCacheFilePath, sourceSize, sourceModifiedTime))
+		return true;
+
+	//parsed straight out of the mapping, the text is never copied
+	VertTBNs meshVerts;
+	std::vector<unsigned int> meshIndexes;
+	{
+		MappedFile objFile;
+		if (!objFile.Open(objFilePath))
+		{
+			ERROR_RECOVERABLE(Stringf("Could not read OBJ file \"%s\"", objFilePath.c_str()));
+			return false;
+		}
+
+		if (!ParseOBJMeshTextBuffer(meshVerts, meshIndexes, objFile.GetView(), objFilePath.c_str(), jobSystem))
+			return false;
+	}
+
+	//a cache that can't be written (read only install) only costs the parse again next run
+	if (useMeshCache)
+	{
+		WriteMeshCacheFile(meshCacheFilePath, meshVerts, meshIndexes, sourceSize, sourceModifiedTime);
+	}
+
+	unsigned int startIndex = (unsigned int)verts.size();
+	verts.insert(verts.end(), meshVerts.begin(), meshVerts.end());
+	indexes.reserve(indexes.size() + meshIndexes.size());
+	for (unsigned int meshIndex : meshIndexes)
+	{
+		indexes.push_back(startIndex + meshIndex);
+	}
+	return true;
+}
+
+bool LoadOBJMeshFile(VertTBNs& verts, std::string const& objFilePath)
+{
+	VertTBNs meshVerts;
+	std::vector<unsigned int> meshIndexes;
+	if (!LoadOBJMeshFile(meshVerts, meshIndexes, objFilePath, g_jobSystem))
+		return false;
+
+	verts.reserve(verts.size() + meshIndexes.size());
+	for (unsigned int meshIndex : meshIndexes)
+	{
+		verts.push_back(meshVerts[meshIndex]);
+	}
+	return true;
 }
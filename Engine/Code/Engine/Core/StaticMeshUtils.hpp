@@ -1,8 +1,39 @@
 #pragma once
 #include "Engine/Core/VertexUtils.hpp"
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
+
+class JobSystem;
+
+constexpr uint32_t MESH_CACHE_MAGIC = 0x4853454D; //"MESH"
+constexpr uint32_t MESH_CACHE_VERSION = 1; //bump whenever the layout or the OBJ parse changes, older caches are then rebuilt
+
+//Starts a .mesh file cached next to its .obj. The vertexes follow the header and then the indexes, both exactly as
+//they are in memory, so a mapped file is copied out with no parsing. Fresh while the .obj size and timestamp match
+struct MeshCacheHeader
+{
+	uint32_t m_magic = MESH_CACHE_MAGIC;
+	uint32_t m_version = MESH_CACHE_VERSION;
+	uint32_t m_vertexSize = sizeof(Vertex_PCUTBN);
+	uint32_t m_numVertexes = 0;
+	uint32_t m_numIndexes = 0;
+	uint32_t m_padding = 0;
+	uint64_t m_sourceSize = 0;
+	uint64_t m_sourceModifiedTime = 0;
+	uint64_t m_fileSize = 0;
+};
 
 bool ParseOBJData(std::string& out_objFileContents, std::string const& objFilePath);
-bool LoadOBJMeshFile(VertTBNs& verts, std::string const& objFilePath);
+bool LoadOBJMeshFile(VertTBNs& verts, std::string const& objFilePath); //unindexed, three verts per triangle
 bool ParseOBJMeshTextBuffer(VertTBNs& verts, std::string const& objFileContents, char const* fileNameForErrorReporting = "DefaultOBJName");
 
+//Indexed. v, vt, vn and f lines are read (any polygon, fan triangulated, negative indexes allowed) and the rest skipped.
+//Corners sharing a position, uv and normal become one vertex. Corners without a normal get the area weighted normal of
+//the faces around them, tangents come from the uvs. With a JobSystem, large files are parsed in line ranges on its workers
+bool ParseOBJMeshTextBuffer(VertTBNs& verts, std::vector<unsigned int>& indexes, std::string_view objFileContents, char const* fileNameForErrorReporting, JobSystem* jobSystem = nullptr);
+bool LoadOBJMeshFile(VertTBNs& verts, std::vector<unsigned int>& indexes, std::string const& objFilePath, JobSystem* jobSystem = nullptr, bool useMeshCache = true);
+
+std::string GetMeshCacheFilePath(std::string const& objFilePath); //the .obj path with a .mesh extension
+bool WriteMeshCacheFile(std::string const& meshCacheFilePath, VertTBNs const& verts, std::vector<unsigned int> const& indexes, uint64_t sourceSize, uint64_t sourceModifiedTime);
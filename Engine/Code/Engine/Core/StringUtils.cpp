@@ -2,6 +2,7 @@
 #include "Engine/Math/IntVec2.hpp"
 #include "Engine/Math/Vec3.hpp"
 #include <stdarg.h>
+#include <charconv>
 
 
 //-----------------------------------------------------------------------------------------------
@@ -291,7 +292,142 @@ int GetIndexOfLastChar(std::string const& inputString, char charToFind)
 	return (int)index;
 }
 
+//String views
+//-----------------------------------------------------------------------------------------------
+std::string_view GetTrimmedWhiteSpace(std::string_view text)
+{
+	size_t startIndex = 0;
+	while (startIndex < text.size() && isspace(static_cast<unsigned char>(text[startIndex])))
+	{
+		startIndex++;
+	}
+
+	size_t endIndex = text.size();
+	while (endIndex > startIndex && isspace(static_cast<unsigned char>(text[endIndex - 1])))
+	{
+		endIndex--;
+	}
+
+	return text.substr(startIndex, endIndex - startIndex);
+}
+
+StringViewSplitter::StringViewSplitter(std::string_view text, char delimiterToSplitOn, bool cutOutLeadingAndTrailingWhiteSpace)
+	: m_text(text)
+	, m_delimiter(delimiterToSplitOn)
+	, m_cutOutWhiteSpace(cutOutLeadingAndTrailingWhiteSpace)
+	, m_isFinished(text.empty())
+{
+}
+
+bool StringViewSplitter::GetNextPiece(std::string_view& out_piece)
+{
+	while (!m_isFinished)
+	{
+		std::string_view piece;
+		size_t delimiterPos = m_text.find(m_delimiter, m_position);
+		if (delimiterPos == std::string_view::npos)
+		{
+			piece = m_text.substr(m_position);
+			m_isFinished = true;
+		}
+		else
+		{
+			piece = m_text.substr(m_position, delimiterPos - m_position);
+			m_position = delimiterPos + 1;
+		}
+
+		if (m_cutOutWhiteSpace)
+		{
+			piece = GetTrimmedWhiteSpace(piece);
+			if (piece.empty())
+				continue;
+		}
+
+		out_piece = piece;
+		return true;
+	}
+	return false;
+}
+
+StringViewSplitIterator StringViewSplitter::begin() const
+{
+	return StringViewSplitIterator(*this, false);
+}
+
+StringViewSplitIterator StringViewSplitter::end() const
+{
+	return StringViewSplitIterator(*this, true);
+}
 
+StringViewSplitIterator::StringViewSplitIterator(StringViewSplitter const& splitter, bool isAtEnd)
+	: m_splitter(splitter)
+	, m_isAtEnd(isAtEnd)
+{
+	if (!m_isAtEnd)
+	{
+		++(*this);
+	}
+}
+
+StringViewSplitIterator& StringViewSplitIterator::operator++()
+{
+	m_isAtEnd = !m_splitter.GetNextPiece(m_piece);
+	return *this;
+}
+
+//Numbers
+//-----------------------------------------------------------------------------------------------
+template <typename T_Number>
+static bool ParseNumberFromTextWithFromChars(std::string_view text, T_Number& out_value)
+{
+	text = GetTrimmedWhiteSpace(text);
+	if (!text.empty() && text[0] == '+')
+	{
+		text.remove_prefix(1);
+	}
 
+	T_Number value = 0;
+	std::from_chars_result result = std::from_chars(text.data(), text.data() + text.size(), value);
+	if (result.ec != std::errc())
+		return false;
 
+	out_value = value;
+	return true;
+}
 
+template <typename T_Number>
+static int ParseNumbersFromTextWithFromChars(std::string_view text, char delimiterToSplitOn, T_Number* out_values, int maxNumValues)
+{
+	int numPieces = 0;
+	std::string_view piece;
+	StringViewSplitter splitter(text, delimiterToSplitOn);
+	while (splitter.GetNextPiece(piece))
+	{
+		if (numPieces < maxNumValues)
+		{
+			ParseNumberFromTextWithFromChars(piece, out_values[numPieces]);
+		}
+		numPieces++;
+	}
+	return numPieces;
+}
+
+bool ParseNumberFromText(std::string_view text, int& out_value)
+{
+	return ParseNumberFromTextWithFromChars(text, out_value);
+}
+
+bool ParseNumberFromText(std::string_view text, float& out_value)
+{
+	return ParseNumberFromTextWithFromChars(text, out_value);
+}
+
+int ParseNumbersFromText(std::string_view text, char delimiterToSplitOn, int* out_values, int maxNumValues)
+{
+	return ParseNumbersFromTextWithFromChars(text, delimiterToSplitOn, out_values, maxNumValues);
+}
+
+int ParseNumbersFromText(std::string_view text, char delimiterToSplitOn, float* out_values, int maxNumValues)
+{
+	return ParseNumbersFromTextWithFromChars(text, delimiterToSplitOn, out_values, maxNumValues);
+}
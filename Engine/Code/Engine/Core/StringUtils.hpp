@@ -1,6 +1,7 @@
 #pragma once
 //-----------------------------------------------------------------------------------------------
 #include <string>
+#include <string_view>
 #include <vector>
 
 struct Vec3;
@@ -22,6 +23,56 @@ std::string GetLowercase(std::string const& inputString);
 std::string GetUpperCase(std::string const& inputString);
 int GetIndexOfLastChar(std::string const& inputString, char charToFind);
 
+//Zero allocation versions of the above, every view points into the original text so it has to outlive them
+std::string_view GetTrimmedWhiteSpace(std::string_view text);
+
+class StringViewSplitIterator;
+
+//Walks the pieces between delimiters the way SplitStringOnDelimiter returns them (trimmed pieces that end up empty are skipped),
+//either with GetNextPiece or in a range for: for (std::string_view piece : StringViewSplitter(text, ','))
+class StringViewSplitter
+{
+public:
+	StringViewSplitter(std::string_view text, char delimiterToSplitOn, bool cutOutLeadingAndTrailingWhiteSpace = true);
+
+	bool		GetNextPiece(std::string_view& out_piece); //false once every piece has been returned
+	StringViewSplitIterator begin() const;
+	StringViewSplitIterator end() const;
+
+private:
+	std::string_view m_text;
+	size_t m_position = 0;
+	char m_delimiter = ',';
+	bool m_cutOutWhiteSpace = true;
+	bool m_isFinished = false;
+};
+
+//Holds its own copy of the splitter, so begin() on a temporary is fine
+class StringViewSplitIterator
+{
+public:
+	StringViewSplitIterator(StringViewSplitter const& splitter, bool isAtEnd);
+
+	std::string_view			operator*() const { return m_piece; }
+	StringViewSplitIterator&	operator++();
+	bool						operator!=(StringViewSplitIterator const& compare) const { return m_isAtEnd != compare.m_isAtEnd; }
+
+private:
+	StringViewSplitter m_splitter;
+	std::string_view m_piece;
+	bool m_isAtEnd = true;
+};
+
+//std::from_chars with surrounding white space and a leading '+' allowed, false (out_value untouched) if the text doesn't start with a number.
+//Like atoi/atof anything after the number is ignored
+bool ParseNumberFromText(std::string_view text, int& out_value);
+bool ParseNumberFromText(std::string_view text, float& out_value);
+
+//Each piece of a delimited list into out_values until maxNumValues, a piece that isn't a number leaves its value untouched.
+//Returns the number of pieces found
+int ParseNumbersFromText(std::string_view text, char delimiterToSplitOn, int* out_values, int maxNumValues);
+int ParseNumbersFromText(std::string_view text, char delimiterToSplitOn, float* out_values, int maxNumValues);
+
 
 
 
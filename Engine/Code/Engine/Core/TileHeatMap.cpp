@@ -6,6 +6,7 @@
 #include "Engine/Math/FloatRange.hpp"
 #include "Engine/Core/Rgba8.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Core/Vertex_PCU2D.hpp"
 
 TileHeatMap::TileHeatMap(IntVec2 const& dimensions, float defaultValue)
 	:m_dimensions(dimensions)
@@ -30,11 +31,13 @@ void TileHeatMap::SetAllValues(float value)
 	{
 		m_values[valueIndex] = value;
 	}
+	++m_version;
 }
 
 void TileHeatMap::SetValue(int index, float value)
 {
 	m_values[index] = value;
+	++m_version;
 }
 
 
@@ -46,6 +49,7 @@ float TileHeatMap::GetValue(int index) const
 void TileHeatMap::AddValue(int index, float value)
 {
 	m_values[index] += value;
+	++m_version;
 }
 
 FloatRange const TileHeatMap::GetRangeOfValues(float specialValueToIgnore) const
@@ -66,6 +70,22 @@ FloatRange const TileHeatMap::GetRangeOfValues(float specialValueToIgnore) const
 }
 
 void TileHeatMap::AddVertsForDebugDraw(std::vector<Vertex_PCU>& verts, AABB2 const& totalBounds, FloatRange const& valueRange, Rgba8 const& lowColor, Rgba8 const& highColor)
+{
+	AddVertsForDebugDraw(verts, totalBounds, IntVec2(0, 0), m_dimensions, valueRange, lowColor, highColor);
+}
+
+void TileHeatMap::AddVertsForDebugDraw(std::vector<Vertex_PCU>& verts, AABB2 const& totalBounds, FloatRange const& valueRange, float specialValue, Rgba8 const& lowColor, Rgba8 const& highColor, Rgba8 const& specialValueColor)
+{
+	AddVertsForDebugDraw(verts, totalBounds, IntVec2(0, 0), m_dimensions, valueRange, specialValue, lowColor, highColor, specialValueColor);
+}
+
+void TileHeatMap::AddVertsForDebugDraw(std::vector<Vertex_PCU>& verts, AABB2 const& totalBounds, float specialValue, Rgba8 const& lowColor, Rgba8 const& highColor, Rgba8 const& specialValueColor)
+{
+	FloatRange valueRange = GetRangeOfValues(specialValue);
+	AddVertsForDebugDraw(verts, totalBounds, IntVec2(0, 0), m_dimensions, valueRange, specialValue, lowColor, highColor, specialValueColor);
+}
+
+void TileHeatMap::AddVertsForDebugDraw(std::vector<Vertex_PCU>& verts, AABB2 const& totalBounds, IntVec2 const& tileMins, IntVec2 const& tileMaxs, FloatRange const& valueRange, Rgba8 const& lowColor, Rgba8 const& highColor)
 {
 	float totalWidth = totalBounds.m_maxs.x - totalBounds.m_mins.x;
 	float totalHeight = totalBounds.m_maxs.y - totalBounds.m_mins.y;
@@ -75,9 +95,9 @@ void TileHeatMap::AddVertsForDebugDraw(std::vector<Vertex_PCU>& verts, AABB2 con
 	int currentTileIndex;
 	Rgba8 currentColor;
 
-	for (int rowIndex = 0; rowIndex < m_dimensions.y; ++rowIndex)
+	for (int rowIndex = tileMins.y; rowIndex < tileMaxs.y; ++rowIndex)
 	{
-		for (int columnIndex = 0; columnIndex < m_dimensions.x; ++columnIndex)
+		for (int columnIndex = tileMins.x; columnIndex < tileMaxs.x; ++columnIndex)
 		{
 			currentTileIndex = (rowIndex * m_dimensions.x) + columnIndex;
 			float rowIndexF = (float)rowIndex;
@@ -90,7 +110,7 @@ void TileHeatMap::AddVertsForDebugDraw(std::vector<Vertex_PCU>& verts, AABB2 con
 	}
 }
 
-void TileHeatMap::AddVertsForDebugDraw(std::vector<Vertex_PCU>& verts, AABB2 const& totalBounds, FloatRange const& valueRange, float specialValue, Rgba8 const& lowColor, Rgba8 const& highColor, Rgba8 const& specialValueColor)
+void TileHeatMap::AddVertsForDebugDraw(std::vector<Vertex_PCU>& verts, AABB2 const& totalBounds, IntVec2 const& tileMins, IntVec2 const& tileMaxs, FloatRange const& valueRange, float specialValue, Rgba8 const& lowColor, Rgba8 const& highColor, Rgba8 const& specialValueColor)
 {
 	float totalWidth = totalBounds.m_maxs.x - totalBounds.m_mins.x;
 	float totalHeight = totalBounds.m_maxs.y - totalBounds.m_mins.y;
@@ -100,9 +120,9 @@ void TileHeatMap::AddVertsForDebugDraw(std::vector<Vertex_PCU>& verts, AABB2 con
 	int currentTileIndex;
 	Rgba8 currentColor;
 
-	for (int rowIndex = 0; rowIndex < m_dimensions.y; ++rowIndex)
+	for (int rowIndex = tileMins.y; rowIndex < tileMaxs.y; ++rowIndex)
 	{
-		for (int columnIndex = 0; columnIndex < m_dimensions.x; ++columnIndex)
+		for (int columnIndex = tileMins.x; columnIndex < tileMaxs.x; ++columnIndex)
 		{
 			currentTileIndex = (rowIndex * m_dimensions.x) + columnIndex;
 			if (m_values[currentTileIndex] == specialValue)
@@ -124,22 +144,36 @@ void TileHeatMap::AddVertsForDebugDraw(std::vector<Vertex_PCU>& verts, AABB2 con
 	}
 }
 
-void TileHeatMap::AddVertsForDebugDraw(std::vector<Vertex_PCU>& verts, AABB2 const& totalBounds, float specialValue, Rgba8 const& lowColor, Rgba8 const& highColor, Rgba8 const& specialValueColor)
+void TileHeatMap::AddVertsForDebugDraw(std::vector<Vertex_PCU2D>& verts, AABB2 const& totalBounds, IntVec2 const& tileMins, IntVec2 const& tileMaxs, FloatRange const& valueRange, Rgba8 const& lowColor, Rgba8 const& highColor) const
 {
-	float totalWidth = totalBounds.m_maxs.x - totalBounds.m_mins.x;
-	float totalHeight = totalBounds.m_maxs.y - totalBounds.m_mins.y;
+	float xDims = (totalBounds.m_maxs.x - totalBounds.m_mins.x) / m_dimensions.x;
+	float yDims = (totalBounds.m_maxs.y - totalBounds.m_mins.y) / m_dimensions.y;
 
-	float xDims = totalWidth / m_dimensions.x;
-	float yDims = totalHeight / m_dimensions.y;
-	int currentTileIndex;
+	for (int rowIndex = tileMins.y; rowIndex < tileMaxs.y; ++rowIndex)
+	{
+		for (int columnIndex = tileMins.x; columnIndex < tileMaxs.x; ++columnIndex)
+		{
+			int currentTileIndex = (rowIndex * m_dimensions.x) + columnIndex;
+			float rowIndexF = (float)rowIndex;
+			float columnIndexF = (float)columnIndex;
+			AABB2 tileBounds(columnIndexF * xDims, rowIndexF * yDims, (columnIndexF + 1.f) * xDims, (rowIndexF + 1.f) * yDims);
+			float valueFraction = RangeMapClamped(m_values[currentTileIndex], valueRange.m_min, valueRange.m_max, 0.f, 1.f);
+			AddVertsForAABB2D(verts, tileBounds, Rgba8::ColorLerp(lowColor, highColor, valueFraction));
+		}
+	}
+}
+
+void TileHeatMap::AddVertsForDebugDraw(std::vector<Vertex_PCU2D>& verts, AABB2 const& totalBounds, IntVec2 const& tileMins, IntVec2 const& tileMaxs, FloatRange const& valueRange, float specialValue, Rgba8 const& lowColor, Rgba8 const& highColor, Rgba8 const& specialValueColor) const
+{
+	float xDims = (totalBounds.m_maxs.x - totalBounds.m_mins.x) / m_dimensions.x;
+	float yDims = (totalBounds.m_maxs.y - totalBounds.m_mins.y) / m_dimensions.y;
 	Rgba8 currentColor;
-	FloatRange valueRange = GetRangeOfValues(specialValue);
 
-	for (int rowIndex = 0; rowIndex < m_dimensions.y; ++rowIndex)
+	for (int rowIndex = tileMins.y; rowIndex < tileMaxs.y; ++rowIndex)
 	{
-		for (int columnIndex = 0; columnIndex < m_dimensions.x; ++columnIndex)
+		for (int columnIndex = tileMins.x; columnIndex < tileMaxs.x; ++columnIndex)
 		{
-			currentTileIndex = (rowIndex * m_dimensions.x) + columnIndex;
+			int currentTileIndex = (rowIndex * m_dimensions.x) + columnIndex;
 			if (m_values[currentTileIndex] == specialValue)
 			{
 				currentColor = specialValueColor;
@@ -4,6 +4,7 @@
 #include <vector>
 
 struct Vertex_PCU;
+struct Vertex_PCU2D;
 struct AABB2;
 struct FloatRange;
 struct Rgba8;
@@ -17,6 +18,8 @@ public:
 	void SetValue(int index, float value);
 	float GetValue(int index) const;
 	void AddValue(int index, float value);
+	void MarkValuesChanged() { ++m_version; } //for code that writes m_values directly
+	unsigned int GetVersion() const { return m_version; } //changes whenever a value might have, cached debug meshes compare it
 
 	FloatRange const GetRangeOfValues(float specialValueToIgnore) const;
 
@@ -24,10 +27,20 @@ public:
 	void AddVertsForDebugDraw(std::vector<Vertex_PCU>& verts, AABB2 const& totalBounds, FloatRange const& valueRange, float specialValue, Rgba8 const& lowColor = Rgba8::BLACK, Rgba8 const& highColor = Rgba8::WHITE, Rgba8 const& specialValueColor = Rgba8::BLUE);
 	void AddVertsForDebugDraw(std::vector<Vertex_PCU>& verts, AABB2 const& totalBounds, float specialValue, Rgba8 const& lowColor = Rgba8::BLACK, Rgba8 const& highColor = Rgba8::WHITE, Rgba8 const& specialValueColor = Rgba8::BLUE);
 
+	//only adds verts for tiles in [tileMins, tileMaxs), for drawing the part of the map that is on screen
+	void AddVertsForDebugDraw(std::vector<Vertex_PCU>& verts, AABB2 const& totalBounds, IntVec2 const& tileMins, IntVec2 const& tileMaxs, FloatRange const& valueRange, Rgba8 const& lowColor = Rgba8::BLACK, Rgba8 const& highColor = Rgba8::WHITE);
+	void AddVertsForDebugDraw(std::vector<Vertex_PCU>& verts, AABB2 const& totalBounds, IntVec2 const& tileMins, IntVec2 const& tileMaxs, FloatRange const& valueRange, float specialValue, Rgba8 const& lowColor = Rgba8::BLACK, Rgba8 const& highColor = Rgba8::WHITE, Rgba8 const& specialValueColor = Rgba8::BLUE);
+
+	//4 vert quads for meshes that are cached between frames
+	void AddVertsForDebugDraw(std::vector<Vertex_PCU2D>& verts, AABB2 const& totalBounds, IntVec2 const& tileMins, IntVec2 const& tileMaxs, FloatRange const& valueRange, Rgba8 const& lowColor = Rgba8::BLACK, Rgba8 const& highColor = Rgba8::WHITE) const;
+	void AddVertsForDebugDraw(std::vector<Vertex_PCU2D>& verts, AABB2 const& totalBounds, IntVec2 const& tileMins, IntVec2 const& tileMaxs, FloatRange const& valueRange, float specialValue, Rgba8 const& lowColor = Rgba8::BLACK, Rgba8 const& highColor = Rgba8::WHITE, Rgba8 const& specialValueColor = Rgba8::BLUE) const;
+
 public:
 	float* m_values = nullptr;
 	IntVec2 m_dimensions;
 
+private:
+	unsigned int m_version = 0;
 
 };
 
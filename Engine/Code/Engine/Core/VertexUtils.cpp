@@ -15,18 +15,54 @@
 #include "Engine/Renderer/DebugRender.hpp"
 #include "Engine/Core/StringUtils.hpp"
 #include <vector>
+#include <xmmintrin.h>
 
 void TransformVertexArrayXY3D(int numVerts, Vertex_PCU* verts, float uniformScaleXY, float rotationDegreesAboutZ, Vec2 const& translationXY)
 {
-	// for loop through points in array
-	for (int vertIndex = 0; vertIndex < numVerts; ++vertIndex)
+	//scale then rotate is the same as an I J basis, so the trig happens once instead of per vert
+	float scaledCos = uniformScaleXY * CosDegrees(rotationDegreesAboutZ);
+	float scaledSin = uniformScaleXY * SinDegrees(rotationDegreesAboutZ);
+	TransformVertexArrayXY3D(numVerts, verts, Vec2(scaledCos, scaledSin), Vec2(-scaledSin, scaledCos), translationXY);
+}
+
+void TransformVertexArrayXY3D(int numVerts, Vertex_PCU* verts, Vec2 const& vectorFwrd, Vec2 const& vectorLeft, Vec2 const& translationXY)
+{
+	__m128 iBasisX = _mm_set1_ps(vectorFwrd.x);
+	__m128 iBasisY = _mm_set1_ps(vectorFwrd.y);
+	__m128 jBasisX = _mm_set1_ps(vectorLeft.x);
+	__m128 jBasisY = _mm_set1_ps(vectorLeft.y);
+	__m128 translationX = _mm_set1_ps(translationXY.x);
+	__m128 translationY = _mm_set1_ps(translationXY.y);
+
+	int vertIndex = 0;
+	for (; vertIndex + 4 <= numVerts; vertIndex += 4)
 	{
-		Vec3& pos = verts[vertIndex].m_position;
-		TransformPositionXY3D(pos, uniformScaleXY, rotationDegreesAboutZ, translationXY);
+		//gather the XY pairs of four verts, then split them into X and Y lanes
+		__m64* posA = reinterpret_cast<__m64*>(&verts[vertIndex].m_position);
+		__m64* posB = reinterpret_cast<__m64*>(&verts[vertIndex + 1].m_position);
+		__m64* posC = reinterpret_cast<__m64*>(&verts[vertIndex + 2].m_position);
+		__m64* posD = reinterpret_cast<__m64*>(&verts[vertIndex + 3].m_position);
+		__m128 pairsAB = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), posA), posB);
+		__m128 pairsCD = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), posC), posD);
+		__m128 posX = _mm_shuffle_ps(pairsAB, pairsCD, _MM_SHUFFLE(2, 0, 2, 0));
+		__m128 posY = _mm_shuffle_ps(pairsAB, pairsCD, _MM_SHUFFLE(3, 1, 3, 1));
+
+		//same order as TransformPositionXY3D: translation + x * I + y * J
+		__m128 newX = _mm_add_ps(_mm_add_ps(translationX, _mm_mul_ps(posX, iBasisX)), _mm_mul_ps(posY, jBasisX));
+		__m128 newY = _mm_add_ps(_mm_add_ps(translationY, _mm_mul_ps(posX, iBasisY)), _mm_mul_ps(posY, jBasisY));
+
+		__m128 newPairsAB = _mm_unpacklo_ps(newX, newY);
+		__m128 newPairsCD = _mm_unpackhi_ps(newX, newY);
+		_mm_storel_pi(posA, newPairsAB);
+		_mm_storeh_pi(posB, newPairsAB);
+		_mm_storel_pi(posC, newPairsCD);
+		_mm_storeh_pi(posD, newPairsCD);
 	}
+
+	TransformVertexArrayXY3DScalar(numVerts - vertIndex, verts + vertIndex, vectorFwrd, vectorLeft, translationXY);
 }
 
-void TransformVertexArrayXY3D(int numVerts, Vertex_PCU* verts, Vec2 const& vectorFwrd, Vec2 const& vectorLeft, Vec2 const& translationXY)
+void TransformVertexArrayXY3DScalar(int numVerts, Vertex_PCU* verts, Vec2 const& vectorFwrd, Vec2 const& vectorLeft, Vec2 const& translationXY)
 {
 	// for loop through points in array
 	for (int vertIndex = 0; vertIndex < numVerts; ++vertIndex)
@@ -38,20 +74,19 @@ void TransformVertexArrayXY3D(int numVerts, Vertex_PCU* verts, Vec2 const& vecto
 
 void TransformVertexArrayXY3D(Verts& verts, Vec2 const& vectorFwrd, Vec2 const& vectorLeft, Vec2 const& translationXY)
 {
-	for (int vertIndex = 0; vertIndex < (int)(verts.size()); ++vertIndex)
-	{
-		Vec3& pos = verts[vertIndex].m_position;
-		TransformPositionXY3D(pos, vectorFwrd, vectorLeft, translationXY);
-	}
+	if (verts.empty())
+		return;
+
+	TransformVertexArrayXY3D((int)verts.size(), verts.data(), vectorFwrd, vectorLeft, translationXY);
 }
 
 void TransformVertexArrayXY3D(Verts& verts, Vec2 const& vectorFwrd, Vec2 const& vectorLeft, Vec2 const& translationXY, IntRange const& vertsToChangeIndexRange)
 {
-	for (int vertIndex = vertsToChangeIndexRange.m_min; vertIndex < vertsToChangeIndexRange.m_max + 1; ++vertIndex)
-	{
-		Vec3& pos = verts[vertIndex].m_position;
-		TransformPositionXY3D(pos, vectorFwrd, vectorLeft, translationXY);
-	}
+	int numVerts = vertsToChangeIndexRange.m_max + 1 - vertsToChangeIndexRange.m_min;
+	if (numVerts <= 0)
+		return;
+
+	TransformVertexArrayXY3D(numVerts, &verts[vertsToChangeIndexRange.m_min], vectorFwrd, vectorLeft, translationXY);
 }
 
 void TransformVertexArray3D(Verts& verts, Mat44 const& transform)
@@ -93,48 +128,77 @@ void ChangeColorsOfVertexArray(int numVerts, Vertex_PCU* verts, Rgba8 const& col
 	}
 }
 
+//Unit circle tables
+//-----------------------------------------------------------------------------------------------
+struct UnitCircleTables
+{
+	UnitCircleTables()
+	{
+		//table for N slices starts at m_firstPoints[N] and holds N + 1 points so the last slice can read its end without wrapping
+		for (int numSlices = 1; numSlices <= MAX_UNIT_CIRCLE_TABLE_SLICES; ++numSlices)
+		{
+			m_firstPoints[numSlices] = (int)m_points.size();
+			float degreesPerSlice = 360.f / (float)numSlices;
+			for (int sliceNum = 0; sliceNum <= numSlices; ++sliceNum)
+			{
+				float degrees = degreesPerSlice * (float)sliceNum;
+				m_points.push_back(Vec2(CosDegrees(degrees), SinDegrees(degrees)));
+			}
+		}
+	}
+
+	std::vector<Vec2> m_points;
+	int m_firstPoints[MAX_UNIT_CIRCLE_TABLE_SLICES + 1] = {};
+};
+
+Vec2 const* GetUnitCircleTable(int numSlices)
+{
+	if (numSlices < 1 || numSlices > MAX_UNIT_CIRCLE_TABLE_SLICES)
+		return nullptr;
+
+	static UnitCircleTables const s_unitCircleTables;
+	return &s_unitCircleTables.m_points[s_unitCircleTables.m_firstPoints[numSlices]];
+}
+
+Vec2 GetUnitCirclePoint(int numSlices, int sliceNum)
+{
+	Vec2 const* table = GetUnitCircleTable(numSlices);
+	if (table != nullptr && sliceNum >= 0 && sliceNum <= numSlices)
+		return table[sliceNum];
+
+	float degrees = (360.f / (float)numSlices) * (float)sliceNum;
+	return Vec2(CosDegrees(degrees), SinDegrees(degrees));
+}
+
+//Add verts for 2D shapes
+//-----------------------------------------------------------------------------------------------
 void AddVertsForDisc2D(Verts& verts, Vec2 const& discCenter, float const& discRadius, Rgba8 const& color, int numSlices)
 {
-	const float DEGREES_PER_SLICE = 360.f / numSlices;
+	if (numSlices <= 0)
+		return;
+
+	Vec2 const* unitCircle = GetUnitCircleTable(numSlices);
+	int firstVertIndex = (int)verts.size();
+	verts.resize(firstVertIndex + 3 * numSlices);
+	Vertex_PCU* sliceVerts = &verts[firstVertIndex];
 
-	float sliceEndTheta = 0.f;
+	Vec2 sliceEndOuterPos = discCenter + Vec2(discRadius, 0.f);
 	for (int sliceNum = 0; sliceNum < numSlices; ++sliceNum)
 	{
-		float sliceStartTheta = sliceEndTheta;
-		sliceEndTheta = sliceStartTheta + DEGREES_PER_SLICE;
-
-		Vec2 sliceStartDisp = Vec2::MakeFromPolarDegrees(sliceStartTheta, discRadius);
-		Vec2 sliceEndDisp = Vec2::MakeFromPolarDegrees(sliceEndTheta, discRadius);
-		Vec2 sliceStartOuterPos = discCenter + sliceStartDisp;
-		Vec2 sliceEndOuterPos = discCenter + sliceEndDisp;
+		Vec2 sliceStartOuterPos = sliceEndOuterPos;
+		Vec2 sliceEndDir = (unitCircle != nullptr) ? unitCircle[sliceNum + 1] : GetUnitCirclePoint(numSlices, sliceNum + 1);
+		sliceEndOuterPos = discCenter + (sliceEndDir * discRadius);
 
 		//TODO: ADD UV COORDS
-		verts.push_back(Vertex_PCU(discCenter, color));
-		verts.push_back(Vertex_PCU(sliceStartOuterPos, color));
-		verts.push_back(Vertex_PCU(sliceEndOuterPos, color));
+		*sliceVerts++ = Vertex_PCU(discCenter, color);
+		*sliceVerts++ = Vertex_PCU(sliceStartOuterPos, color);
+		*sliceVerts++ = Vertex_PCU(sliceEndOuterPos, color);
 	}
 }
 
 void AddVertsForDisc2D(Verts& verts, Disc2 const& disc, Rgba8 const& color)
 {
-	constexpr int NUM_SLICES = 32;
-	constexpr float DEGREES_PER_SLICE = 360.f / (float)(NUM_SLICES);
-	float sliceEndTheta = 0.f;
-	for (int sliceNum = 0; sliceNum < NUM_SLICES; ++sliceNum)
-	{
-		float sliceStartTheta = sliceEndTheta;
-		sliceEndTheta = sliceStartTheta + DEGREES_PER_SLICE;
-
-		Vec2 sliceStartDisp = Vec2::MakeFromPolarDegrees(sliceStartTheta, disc.m_radius);
-		Vec2 sliceEndDisp = Vec2::MakeFromPolarDegrees(sliceEndTheta, disc.m_radius);
-		Vec2 sliceStartOuterPos = disc.m_center + sliceStartDisp;
-		Vec2 sliceEndOuterPos = disc.m_center + sliceEndDisp;
-
-		//#TODO: ADD UV COORDS
-		verts.push_back(Vertex_PCU(disc.m_center, color));
-		verts.push_back(Vertex_PCU(sliceStartOuterPos, color));
-		verts.push_back(Vertex_PCU(sliceEndOuterPos, color));
-	}
+	AddVertsForDisc2D(verts, disc.m_center, disc.m_radius, color, 32);
 }
 
 void AddVertsForAABB2D(Verts& verts, AABB2 const& alignedBox, Rgba8 const& color, Vec2 const& uvMins, Vec2 const& uvMaxs)
@@ -203,6 +267,69 @@ void AddVertsForOBB2D(Verts& verts, Vec2 const& center, Vec2 const& iBasisNormal
 	verts.push_back(Vertex_PCU(TL, color, Vec2::ZERO_TO_ONE));
 }
 
+void AddVertsForAABB2D(Vert2Ds& verts, AABB2 const& alignedBox, Rgba8 const& color, AABB2 const& uvs)
+{
+	verts.push_back(Vertex_PCU2D(alignedBox.m_mins, color, uvs.m_mins));
+	verts.push_back(Vertex_PCU2D(Vec2(alignedBox.m_maxs.x, alignedBox.m_mins.y), color, Vec2(uvs.m_maxs.x, uvs.m_mins.y)));
+	verts.push_back(Vertex_PCU2D(alignedBox.m_maxs, color, uvs.m_maxs));
+	verts.push_back(Vertex_PCU2D(Vec2(alignedBox.m_mins.x, alignedBox.m_maxs.y), color, Vec2(uvs.m_mins.x, uvs.m_maxs.y)));
+}
+
+void AddVertsForOBB2D(Vert2Ds& verts, OBB2 const& orientedBox, Rgba8 const& color, AABB2 const& uvs)
+{
+	Vec2 cornerPoints[4];
+	orientedBox.GetCornerPoints(cornerPoints);
+
+	verts.push_back(Vertex_PCU2D(cornerPoints[0], color, uvs.m_mins));
+	verts.push_back(Vertex_PCU2D(cornerPoints[1], color, Vec2(uvs.m_maxs.x, uvs.m_mins.y)));
+	verts.push_back(Vertex_PCU2D(cornerPoints[2], color, uvs.m_maxs));
+	verts.push_back(Vertex_PCU2D(cornerPoints[3], color, Vec2(uvs.m_mins.x, uvs.m_maxs.y)));
+}
+
+void AddVertsForOBB2D(Vert2Ds& verts, Vec2 const& center, Vec2 const& iBasisNormal, Vec2 const& halfDimensionsIJ, Rgba8 const& color)
+{
+	AddVertsForOBB2D(verts, OBB2(center, iBasisNormal, halfDimensionsIJ), color);
+}
+
+void AddIndexesForQuads2D(std::vector<unsigned int>& indexes, int numQuads, unsigned int firstVertex)
+{
+	indexes.reserve(indexes.size() + numQuads * NUM_INDEXES_PER_QUAD_2D);
+	for (int quadNum = 0; quadNum < numQuads; ++quadNum)
+	{
+		unsigned int BL = firstVertex + quadNum * NUM_VERTS_PER_QUAD_2D;
+		indexes.push_back(BL);
+		indexes.push_back(BL + 1);
+		indexes.push_back(BL + 2);
+		indexes.push_back(BL);
+		indexes.push_back(BL + 2);
+		indexes.push_back(BL + 3);
+	}
+}
+
+void AddVertsForQuadInstances2D(Verts& verts, int numInstances, QuadInstance2D const* instances)
+{
+	verts.reserve(verts.size() + numInstances * 6);
+	Vec2 corners[4];
+	for (int instanceNum = 0; instanceNum < numInstances; ++instanceNum)
+	{
+		QuadInstance2D const& instance = instances[instanceNum];
+		instance.GetCornerPositions(corners);
+		Vec2 uvBR(instance.m_uvs.m_maxs.x, instance.m_uvs.m_mins.y);
+		Vec2 uvTL(instance.m_uvs.m_mins.x, instance.m_uvs.m_maxs.y);
+
+		verts.push_back(Vertex_PCU(corners[0], instance.m_tint, instance.m_uvs.m_mins));
+		verts.push_back(Vertex_PCU(corners[1], instance.m_tint, uvBR));
+		verts.push_back(Vertex_PCU(corners[2], instance.m_tint, instance.m_uvs.m_maxs));
+		verts.push_back(Vertex_PCU(corners[0], instance.m_tint, instance.m_uvs.m_mins));
+		verts.push_back(Vertex_PCU(corners[2], instance.m_tint, instance.m_uvs.m_maxs));
+		verts.push_back(Vertex_PCU(corners[3], instance.m_tint, uvTL));
+	}
+}
+
+void AddVertsForQuadInstances2D(Verts& verts, std::vector<QuadInstance2D> const& instances)
+{
+	AddVertsForQuadInstances2D(verts, (int)instances.size(), instances.data());
+}
 
 void AddVertsForCapsule2D(Verts& verts, Vec2 const& boneStart, Vec2 const& boneEnd, float const& radius, Rgba8 const& color)
 {
@@ -226,43 +353,33 @@ void AddVertsForCapsule2D(Verts& verts, Vec2 const& boneStart, Vec2 const& boneE
 	verts.push_back(Vertex_PCU(SR, color));
 	verts.push_back(Vertex_PCU(EL, color));
 
-	//precalculate for drawing end caps
+	//each cap is half of a 32 slice unit circle, rotated so it starts at the bone's right side
 	constexpr int NUM_SLICES = 16;
-	constexpr float DEGREES_PER_SLICE = 180.f / (float)(NUM_SLICES);
+	Vec2 const* unitCircle = GetUnitCircleTable(NUM_SLICES * 2);
+	Vec2 capFwrdStep = (fwrdStep == Vec2::ZERO) ? Vec2(radius, 0.f) : fwrdStep; //no bone, the caps still make a full disc
+	Vec2 capRightStep = Vec2(capFwrdStep.y, -capFwrdStep.x);
 
-	float boneFwrdOrientationTheta = fwrdStep.GetOrientationDegrees();
-	float endCapStartTheta = boneFwrdOrientationTheta - 90.f;
-	float endCapSliceEndTheta = endCapStartTheta;
-
-	float startCapStartTheta = endCapStartTheta + 180.f;
-	float startCapSliceEndTheta = startCapStartTheta;
+	int firstVertIndex = (int)verts.size();
+	verts.resize(firstVertIndex + 6 * NUM_SLICES);
+	Vertex_PCU* capVerts = &verts[firstVertIndex];
 
 	//Add verts for both caps
+	Vec2 sliceEndDisp = capRightStep;
 	for (int sliceNum = 0; sliceNum < NUM_SLICES; ++sliceNum)
 	{
-		//end Cap
-		float sliceStartTheta = endCapSliceEndTheta;
-		endCapSliceEndTheta = sliceStartTheta + DEGREES_PER_SLICE;
-		Vec2 sliceStartDisp = Vec2::MakeFromPolarDegrees(sliceStartTheta, radius);
-		Vec2 sliceEndDisp = Vec2::MakeFromPolarDegrees(endCapSliceEndTheta, radius);
-		Vec2 sliceStartOuterPos = boneEnd + sliceStartDisp;
-		Vec2 sliceEndOuterPos = boneEnd + sliceEndDisp;
+		Vec2 sliceStartDisp = sliceEndDisp;
+		Vec2 unitPoint = unitCircle[sliceNum + 1];
+		sliceEndDisp = (capRightStep * unitPoint.x) + (capFwrdStep * unitPoint.y);
 
-		verts.push_back(Vertex_PCU(boneEnd, color));
-		verts.push_back(Vertex_PCU(sliceStartOuterPos, color));
-		verts.push_back(Vertex_PCU(sliceEndOuterPos, color));
+		//end Cap
+		*capVerts++ = Vertex_PCU(boneEnd, color);
+		*capVerts++ = Vertex_PCU(boneEnd + sliceStartDisp, color);
+		*capVerts++ = Vertex_PCU(boneEnd + sliceEndDisp, color);
 
 		//start Cap
-		sliceStartTheta = startCapSliceEndTheta;
-		startCapSliceEndTheta = sliceStartTheta + DEGREES_PER_SLICE;
-		sliceStartDisp = Vec2::MakeFromPolarDegrees(sliceStartTheta, radius);
-		sliceEndDisp = Vec2::MakeFromPolarDegrees(startCapSliceEndTheta, radius);
-		sliceStartOuterPos = boneStart + sliceStartDisp;
-		sliceEndOuterPos = boneStart + sliceEndDisp;
-
-		verts.push_back(Vertex_PCU(boneStart, color));
-		verts.push_back(Vertex_PCU(sliceStartOuterPos, color));
-		verts.push_back(Vertex_PCU(sliceEndOuterPos, color));
+		*capVerts++ = Vertex_PCU(boneStart, color);
+		*capVerts++ = Vertex_PCU(boneStart - sliceStartDisp, color);
+		*capVerts++ = Vertex_PCU(boneStart - sliceEndDisp, color);
 	}
 }
 
@@ -288,68 +405,7 @@ void AddVertsForAABB2DFrame(Verts& verts, AABB2 const& alignedBox, float thickne
 
 void AddVertsForCapsule2D(Verts& verts, Capsule2 const& capsule, Rgba8 const& color)
 {
-	//#TODO: ADD UV COORDS
-
-	Vec2 boneStart = capsule.m_start;
-	Vec2 boneEnd = capsule.m_end;
-	float radius = capsule.m_radius;
-
-	Vec2 fwrdStep = boneEnd - boneStart;
-	fwrdStep.SetLength(radius);
-	Vec2 leftStep = fwrdStep.GetRotated90Degrees();
-
-	Vec2 EL = boneEnd + leftStep;
-	Vec2 ER = boneEnd - leftStep;
-	Vec2 SR = boneStart - leftStep;
-	Vec2 SL = boneStart + leftStep;
-
-	//draw 2 triangles to make the middle rectangle
-	verts.push_back(Vertex_PCU(SR, color));
-	verts.push_back(Vertex_PCU(ER, color));
-	verts.push_back(Vertex_PCU(EL, color));
-
-	verts.push_back(Vertex_PCU(SL, color));
-	verts.push_back(Vertex_PCU(SR, color));
-	verts.push_back(Vertex_PCU(EL, color));
-
-	//precalculate for drawing end caps
-	constexpr int NUM_SLICES = 16;
-	constexpr float DEGREES_PER_SLICE = 180.f / (float)(NUM_SLICES);
-
-	float boneFwrdOrientationTheta = fwrdStep.GetOrientationDegrees();
-	float endCapStartTheta = boneFwrdOrientationTheta - 90.f;
-	float endCapSliceEndTheta = endCapStartTheta;
-
-	float startCapStartTheta = endCapStartTheta + 180.f;
-	float startCapSliceEndTheta = startCapStartTheta;
-
-	//Add verts for both caps
-	for (int sliceNum = 0; sliceNum < NUM_SLICES; ++sliceNum)
-	{
-		//end Cap
-		float sliceStartTheta = endCapSliceEndTheta;
-		endCapSliceEndTheta = sliceStartTheta + DEGREES_PER_SLICE;
-		Vec2 sliceStartDisp = Vec2::MakeFromPolarDegrees(sliceStartTheta, radius);
-		Vec2 sliceEndDisp = Vec2::MakeFromPolarDegrees(endCapSliceEndTheta, radius);
-		Vec2 sliceStartOuterPos = boneEnd + sliceStartDisp;
-		Vec2 sliceEndOuterPos = boneEnd + sliceEndDisp;
-
-		verts.push_back(Vertex_PCU(boneEnd, color));
-		verts.push_back(Vertex_PCU(sliceStartOuterPos, color));
-		verts.push_back(Vertex_PCU(sliceEndOuterPos, color));
-
-		//start Cap
-		sliceStartTheta = startCapSliceEndTheta;
-		startCapSliceEndTheta = sliceStartTheta + DEGREES_PER_SLICE;
-		sliceStartDisp = Vec2::MakeFromPolarDegrees(sliceStartTheta, radius);
-		sliceEndDisp = Vec2::MakeFromPolarDegrees(startCapSliceEndTheta, radius);
-		sliceStartOuterPos = boneStart + sliceStartDisp;
-		sliceEndOuterPos = boneStart + sliceEndDisp;
-
-		verts.push_back(Vertex_PCU(boneStart, color));
-		verts.push_back(Vertex_PCU(sliceStartOuterPos, color));
-		verts.push_back(Vertex_PCU(sliceEndOuterPos, color));
-	}
+	AddVertsForCapsule2D(verts, capsule.m_start, capsule.m_end, capsule.m_radius, color);
 }
 
 void AddVertsForTriangle2D(Verts& verts, Vec2 const& triPointACounterClockwise, Vec2 const& triPointBCounterClockwise, Vec2 const& triPointCCounterClockwise, Rgba8 const& color)
@@ -480,17 +536,18 @@ void AddVertsForRing2D(Verts& verts, Vec2 const& center, float radius, float thi
 	float innerRadius = radius - halfThickness;
 	float outerRadius = radius + halfThickness;
 	constexpr int NUM_SIDES = 32;
-	constexpr float DEGREES_PER_SIDE = 360.f / (float)(NUM_SIDES);
+	Vec2 const* unitCircle = GetUnitCircleTable(NUM_SIDES);
+	int firstVertIndex = (int)verts.size();
+	verts.resize(firstVertIndex + 6 * NUM_SIDES);
+	Vertex_PCU* sideVerts = &verts[firstVertIndex];
 
 	for (int sideNum = 0; sideNum < NUM_SIDES; ++sideNum)
 	{
 		//compute angle related terms
-		float startDegrees = DEGREES_PER_SIDE * (float)(sideNum);
-		float endDegrees = DEGREES_PER_SIDE * (float)(sideNum + 1);
-		float cosStart = CosDegrees(startDegrees);
-		float sinStart = SinDegrees(startDegrees);
-		float cosEnd = CosDegrees(endDegrees);
-		float sinEnd = SinDegrees(endDegrees);
+		float cosStart = unitCircle[sideNum].x;
+		float sinStart = unitCircle[sideNum].y;
+		float cosEnd = unitCircle[sideNum + 1].x;
+		float sinEnd = unitCircle[sideNum + 1].y;
 
 		//compute inner and outer positions
 		Vec3 innerStartPos(center.x + innerRadius * cosStart, center.y + innerRadius * sinStart, 0.0f);
@@ -498,12 +555,12 @@ void AddVertsForRing2D(Verts& verts, Vec2 const& center, float radius, float thi
 		Vec3 outerEndPos(center.x + outerRadius * cosEnd, center.y + outerRadius * sinEnd, 0.f);
 		Vec3 innerEndPos(center.x + innerRadius * cosEnd, center.y + innerRadius * sinEnd, 0.f);
 
-		verts.push_back(Vertex_PCU(innerEndPos, color, Vec2::ZERO));
-		verts.push_back(Vertex_PCU(innerStartPos, color, Vec2::ZERO));
-		verts.push_back(Vertex_PCU(outerStartPos, color, Vec2::ZERO));
-		verts.push_back(Vertex_PCU(innerEndPos, color, Vec2::ZERO));
-		verts.push_back(Vertex_PCU(outerStartPos, color, Vec2::ZERO));
-		verts.push_back(Vertex_PCU(outerEndPos, color, Vec2::ZERO));
+		*sideVerts++ = Vertex_PCU(innerEndPos, color, Vec2::ZERO);
+		*sideVerts++ = Vertex_PCU(innerStartPos, color, Vec2::ZERO);
+		*sideVerts++ = Vertex_PCU(outerStartPos, color, Vec2::ZERO);
+		*sideVerts++ = Vertex_PCU(innerEndPos, color, Vec2::ZERO);
+		*sideVerts++ = Vertex_PCU(outerStartPos, color, Vec2::ZERO);
+		*sideVerts++ = Vertex_PCU(outerEndPos, color, Vec2::ZERO);
 	}
 }
 
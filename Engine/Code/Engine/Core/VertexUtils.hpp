@@ -6,6 +6,8 @@
 #include "Engine/Core/Rgba8.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
 #include "Engine/Core/Vertex_PCUTBN.hpp"
+#include "Engine/Core/Vertex_PCU2D.hpp"
+#include "Engine/Core/QuadInstance2D.hpp"
 #include <vector>
 struct IntRange;
 struct Disc2;
@@ -18,11 +20,14 @@ struct OBB3;
 
 typedef std::vector<Vertex_PCU> Verts;
 typedef std::vector<Vertex_PCUTBN> VertTBNs;
+typedef std::vector<Vertex_PCU2D> Vert2Ds;
 
+//XY transforms run four verts per SSE step with a scalar tail, the trig for the scale/rotation overload is done once per call
 void TransformVertexArrayXY3D(int numVerts, Vertex_PCU* verts, float uniformScaleXY, float rotationDegreesAboutZ, Vec2 const& translationXY);
 
 //uses I J coordinate system
 void TransformVertexArrayXY3D(int numVerts, Vertex_PCU* verts, Vec2 const& vectorFwrd, Vec2 const& vectorLeft, Vec2 const& translationXY);
+void TransformVertexArrayXY3DScalar(int numVerts, Vertex_PCU* verts, Vec2 const& vectorFwrd, Vec2 const& vectorLeft, Vec2 const& translationXY); //reference, same operation order so results are identical
 void TransformVertexArrayXY3D(Verts& verts, Vec2 const& vectorFwrd, Vec2 const& vectorLeft, Vec2 const& translationXY);
 void TransformVertexArrayXY3D(Verts& verts, Vec2 const& vectorFwrd, Vec2 const& vectorLeft, Vec2 const& translationXY, IntRange const& vertsToChangeIndexRange);
 void TransformVertexArray3D(Verts& verts, Mat44 const& transform);
@@ -31,6 +36,14 @@ void TransformVertexArray3D(VertTBNs& verts, Mat44 const& transform, IntRange co
 
 void ChangeColorsOfVertexArray(int numVerts, Vertex_PCU* verts, Rgba8 const& color);
 
+//Unit circle tables
+//-------------------------------------------------------------------------------
+constexpr int MAX_UNIT_CIRCLE_TABLE_SLICES = 64;
+
+//numSlices + 1 points (cos, sin) of sliceNum * 360 / numSlices, built once and shared. nullptr above MAX_UNIT_CIRCLE_TABLE_SLICES
+Vec2 const* GetUnitCircleTable(int numSlices);
+Vec2 GetUnitCirclePoint(int numSlices, int sliceNum); //falls back to trig for slice counts without a table
+
 //Add verts for 2D shapes
 //-------------------------------------------------------------------------------
 void AddVertsForDisc2D(Verts& verts, Vec2 const& discCenter, float const& discRadius, Rgba8 const& color, int numSlices = 32);
@@ -43,6 +56,16 @@ void AddVertsForAABB2DFrame(Verts& verts, AABB2 const& alignedBox, float thickne
 void AddVertsForOBB2D(Verts& verts, OBB2 const& orientedBox, Rgba8 const& color);
 void AddVertsForOBB2D(Verts& verts, Vec2 const& center, Vec2 const& iBasisNormal, Vec2 const& halfDimensionsIJ, Rgba8 const& color);
 
+//Indexed 2D quads, 4 verts each (BL, BR, TR, TL) instead of 6
+void AddVertsForAABB2D(Vert2Ds& verts, AABB2 const& alignedBox, Rgba8 const& color = Rgba8::WHITE, AABB2 const& uvs = AABB2::ZERO_TO_ONE);
+void AddVertsForOBB2D(Vert2Ds& verts, OBB2 const& orientedBox, Rgba8 const& color, AABB2 const& uvs = AABB2::ZERO_TO_ONE);
+void AddVertsForOBB2D(Vert2Ds& verts, Vec2 const& center, Vec2 const& iBasisNormal, Vec2 const& halfDimensionsIJ, Rgba8 const& color);
+void AddIndexesForQuads2D(std::vector<unsigned int>& indexes, int numQuads, unsigned int firstVertex = 0); //0 1 2, 0 2 3 per quad
+
+//CPU reference for the instanced quad shader, 6 verts per instance in the same order as AddVertsForAABB2D
+void AddVertsForQuadInstances2D(Verts& verts, int numInstances, QuadInstance2D const* instances);
+void AddVertsForQuadInstances2D(Verts& verts, std::vector<QuadInstance2D> const& instances);
+
 void AddVertsForCapsule2D(Verts& verts, Vec2 const& boneStart, Vec2 const& boneEnd, float const& radius, Rgba8 const& color);
 void AddVertsForCapsule2D(Verts& verts, Capsule2 const& capsule, Rgba8 const& color);
 
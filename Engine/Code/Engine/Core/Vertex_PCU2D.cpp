@@ -0,0 +1,20 @@
+#include "Engine/Core/Vertex_PCU2D.hpp"
+#include "Engine/Math/MathUtils.hpp"
+
+Vertex_PCU2D::Vertex_PCU2D(Vec2 const& position, Rgba8 const& color, Vec2 const& uvTexCoords)
+	:m_position(position)
+	,m_color(color)
+{
+	SetUVTexCoords(uvTexCoords);
+}
+
+void Vertex_PCU2D::SetUVTexCoords(Vec2 const& uvTexCoords)
+{
+	m_uvTexCoords[0] = static_cast<unsigned short>(GetClampedZeroToOne(uvTexCoords.x) * 65535.f + 0.5f);
+	m_uvTexCoords[1] = static_cast<unsigned short>(GetClampedZeroToOne(uvTexCoords.y) * 65535.f + 0.5f);
+}
+
+Vec2 Vertex_PCU2D::GetUVTexCoords() const
+{
+	return Vec2(static_cast<float>(m_uvTexCoords[0]) / 65535.f, static_cast<float>(m_uvTexCoords[1]) / 65535.f);
+}
@@ -0,0 +1,27 @@
+#pragma once
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Core/Rgba8.hpp"
+
+//Compact 16 byte vertex for 2D quads: float2 position, unorm8 color, unorm16 uvs.
+//Uvs are stored as fractions of 65535 so they have to stay inside [0, 1], no wrapping.
+//Quads are 4 verts (BL, BR, TR, TL) drawn through the renderer's shared quad index buffer.
+struct Vertex_PCU2D
+{
+public:
+	Vec2 m_position;
+	Rgba8 m_color;
+	unsigned short m_uvTexCoords[2] = {};
+public:
+	~Vertex_PCU2D(){}
+	Vertex_PCU2D(){}
+
+	explicit Vertex_PCU2D(Vec2 const& position, Rgba8 const& color, Vec2 const& uvTexCoords = Vec2(0.f, 0.f));
+
+	void SetUVTexCoords(Vec2 const& uvTexCoords);
+	Vec2 GetUVTexCoords() const;
+};
+
+static_assert(sizeof(Vertex_PCU2D) == 16, "Vertex_PCU2D must match the 16 byte input layout");
+
+constexpr int NUM_VERTS_PER_QUAD_2D = 4;
+constexpr int NUM_INDEXES_PER_QUAD_2D = 6;
@@ -15,7 +15,9 @@ int ParseXmlAttribute(XmlElement const& element, char const* attributeName, int
 		return defaultValue;
 	}
 
-	return atoi(value);
+	int intValue = 0;
+	ParseNumberFromText(value, intValue);
+	return intValue;
 }
 
 char ParseXmlAttribute(XmlElement const& element, char const* attributeName, char defaultValue)
@@ -61,7 +63,9 @@ float ParseXmlAttribute(XmlElement const& element, char const* attributeName, fl
 		return defaultValue;
 	}
 
-	return (float)atof(value);
+	float floatValue = 0.f;
+	ParseNumberFromText(value, floatValue);
+	return floatValue;
 }
 
 Rgba8 ParseXmlAttribute(XmlElement const& element, char const* attributeName, Rgba8 const& defaultValue)
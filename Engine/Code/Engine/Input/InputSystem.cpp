@@ -73,6 +73,13 @@ void InputSystem::BeginFrame()
 		m_xBoxControllers[xboxControllerIndex].UpdateStatus();
 	}
 
+	//no window to track the cursor in, e.g. ENGINE_NULL_RENDERER builds
+	if (Window::s_mainWindow == nullptr)
+	{
+		m_cursorState.m_cursorClientDelta = IntVec2::ZERO;
+		return;
+	}
+
 	//Cursor point last frame
 	IntVec2 clientPosLastFrame = m_cursorState.m_cursorClientPosition;
 
@@ -163,6 +170,10 @@ void InputSystem::SetWheelDelta(float delta)
 void InputSystem::SetCursorMode(CursorMode cursorMode)
 {
 	m_cursorState.m_cursorMode = cursorMode;
+	if (Window::s_mainWindow == nullptr)
+	{
+		return;
+	}
 
 	if (cursorMode == CursorMode::POINTER)
 	{
@@ -200,6 +211,11 @@ Vec2 InputSystem::GetCursorClientPosition() const
 
 Vec2 InputSystem::GetCursorNormalizedPosition() const
 {
+	if (Window::s_mainWindow == nullptr)
+	{
+		return Vec2::ZERO;
+	}
+
 	return Window::s_mainWindow->GetNormalizedMouseUV();
 }
 
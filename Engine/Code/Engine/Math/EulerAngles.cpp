@@ -92,10 +92,11 @@ Vec3 EulerAngles::Get_KUp() const
 
 void EulerAngles::SetFromText(char const* text)
 {
-	Strings numsFromText = SplitStringOnDelimiter(text, ',');
-	m_yawDegrees = (float)(atof(numsFromText[0].c_str()));
-	m_pitchDegrees = (float)(atof(numsFromText[1].c_str()));
-	m_rollDegrees = (float)(atof(numsFromText[2].c_str()));
+	float numsFromText[3] = {};
+	ParseNumbersFromText(text, ',', numsFromText, 3);
+	m_yawDegrees = numsFromText[0];
+	m_pitchDegrees = numsFromText[1];
+	m_rollDegrees = numsFromText[2];
 }
 
 const EulerAngles EulerAngles::operator*(float uniformScale) const
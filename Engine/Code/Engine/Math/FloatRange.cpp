@@ -64,9 +64,10 @@ float FloatRange::GetRandomValueInRange(RandomNumberGenerator* randomNumberGener
 
 void FloatRange::SetFromText(char const* text)
 {
-	Strings numsFromText = SplitStringOnDelimiter(text, '~');
-	m_min = (float)(atof(numsFromText[0].c_str()));
-	m_max = (float)(atof(numsFromText[1].c_str()));
+	float numsFromText[2] = {};
+	ParseNumbersFromText(text, '~', numsFromText, 2);
+	m_min = numsFromText[0];
+	m_max = numsFromText[1];
 }
 
 void FloatRange::StretchToIncludeValue(float value)
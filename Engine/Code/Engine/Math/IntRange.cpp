@@ -24,9 +24,10 @@ bool const IntRange::IsOverlapping(IntRange const& range) const
 
 void IntRange::SetFromText(char const* text)
 {
-	Strings numsFromText = SplitStringOnDelimiter(text, ',');
-	m_min = atoi(numsFromText[0].c_str());
-	m_max = atoi(numsFromText[1].c_str());
+	int numsFromText[2] = {};
+	ParseNumbersFromText(text, ',', numsFromText, 2);
+	m_min = numsFromText[0];
+	m_max = numsFromText[1];
 }
 
 bool IntRange::operator==(const IntRange& compare) const
@@ -87,9 +87,10 @@ IntVec2 const IntVec2::GetRotatedMinus90Degrees() const
 
 void IntVec2::SetFromText(char const* text)
 {
-	Strings numsFromText = SplitStringOnDelimiter(text, ',');
-	x = atoi(numsFromText[0].c_str());
-	y = atoi(numsFromText[1].c_str());
+	int numsFromText[2] = {};
+	ParseNumbersFromText(text, ',', numsFromText, 2);
+	x = numsFromText[0];
+	y = numsFromText[1];
 }
 
 //Mutators (non-const methods)
@@ -18,6 +18,7 @@
 #include "Engine/Math/OBB3.hpp"
 #include "Engine/Math/Plane3D.hpp"
 #include <math.h>
+#include <xmmintrin.h>
 
 
 
@@ -1125,6 +1126,254 @@ bool PushDiscOutOfFixedAABB2D(Vec2& mobileDiscCenter, float discRadius, AABB2 co
     return true;
 }
 
+//Batch overlap, same <= test as DoDiscsOverlap so it finds exactly the disc a scalar scan would
+int GetFirstOverlappingDiscIndexBatch2D(Vec2 const& center, float radius, float const* centersX, float const* centersY, float const* radii, int startIndex, int endIndex)
+{
+	__m128 centerX = _mm_set1_ps(center.x);
+	__m128 centerY = _mm_set1_ps(center.y);
+	__m128 radiusA = _mm_set1_ps(radius);
+
+	int discIndex = startIndex;
+	for (; discIndex + 4 <= endIndex; discIndex += 4)
+	{
+		__m128 dispX = _mm_sub_ps(_mm_loadu_ps(centersX + discIndex), centerX);
+		__m128 dispY = _mm_sub_ps(_mm_loadu_ps(centersY + discIndex), centerY);
+		__m128 distSquared = _mm_add_ps(_mm_mul_ps(dispX, dispX), _mm_mul_ps(dispY, dispY));
+		__m128 radiiSum = _mm_add_ps(radiusA, _mm_loadu_ps(radii + discIndex));
+		int laneMask = _mm_movemask_ps(_mm_cmple_ps(distSquared, _mm_mul_ps(radiiSum, radiiSum)));
+		if (laneMask == 0)
+			continue;
+
+		for (int lane = 0; lane < 4; ++lane)
+		{
+			if (laneMask & (1 << lane))
+				return discIndex + lane;
+		}
+	}
+
+	for (; discIndex < endIndex; ++discIndex)
+	{
+		if (DoDiscsOverlap(center, radius, Vec2(centersX[discIndex], centersY[discIndex]), radii[discIndex]))
+			return discIndex;
+	}
+
+	return -1;
+}
+
+//Batch push functions
+//overlapping lanes count as pushed even when their centers coincide, but only move when they don't, matching Vec2::SetLength on a zero vector
+static int GetNumSetLanes(__m128 laneMask)
+{
+	int laneBits = _mm_movemask_ps(laneMask);
+	return (laneBits & 1) + ((laneBits >> 1) & 1) + ((laneBits >> 2) & 1) + ((laneBits >> 3) & 1);
+}
+
+static int PushDiscLanesOutOfFixedDiscLanes(__m128& mobileX, __m128& mobileY, __m128 mobileRadius, __m128 fixedX, __m128 fixedY, __m128 fixedRadius)
+{
+	__m128 dispX = _mm_sub_ps(mobileX, fixedX);
+	__m128 dispY = _mm_sub_ps(mobileY, fixedY);
+	__m128 distSquared = _mm_add_ps(_mm_mul_ps(dispX, dispX), _mm_mul_ps(dispY, dispY));
+	__m128 radiiSum = _mm_add_ps(fixedRadius, mobileRadius);
+	__m128 overlapMask = _mm_cmplt_ps(distSquared, _mm_mul_ps(radiiSum, radiiSum));
+	__m128 pushMask = _mm_and_ps(overlapMask, _mm_cmpgt_ps(distSquared, _mm_setzero_ps()));
+	if (_mm_movemask_ps(pushMask) != 0)
+	{
+		__m128 scale = _mm_div_ps(radiiSum, _mm_sqrt_ps(distSquared));
+		__m128 pushedX = _mm_add_ps(fixedX, _mm_mul_ps(dispX, scale));
+		__m128 pushedY = _mm_add_ps(fixedY, _mm_mul_ps(dispY, scale));
+		mobileX = _mm_or_ps(_mm_and_ps(pushMask, pushedX), _mm_andnot_ps(pushMask, mobileX));
+		mobileY = _mm_or_ps(_mm_and_ps(pushMask, pushedY), _mm_andnot_ps(pushMask, mobileY));
+	}
+
+	return GetNumSetLanes(overlapMask);
+}
+
+static int PushDiscLanesOutOfFixedAABBLanes(__m128& mobileX, __m128& mobileY, __m128 radius, __m128 minsX, __m128 minsY, __m128 maxsX, __m128 maxsY)
+{
+	__m128 dispX = _mm_sub_ps(mobileX, _mm_min_ps(_mm_max_ps(mobileX, minsX), maxsX));
+	__m128 dispY = _mm_sub_ps(mobileY, _mm_min_ps(_mm_max_ps(mobileY, minsY), maxsY));
+	__m128 distSquared = _mm_add_ps(_mm_mul_ps(dispX, dispX), _mm_mul_ps(dispY, dispY));
+	__m128 overlapMask = _mm_cmplt_ps(distSquared, _mm_mul_ps(radius, radius));
+	__m128 pushMask = _mm_and_ps(overlapMask, _mm_cmpgt_ps(distSquared, _mm_setzero_ps()));
+	if (_mm_movemask_ps(pushMask) != 0)
+	{
+		__m128 distance = _mm_sqrt_ps(distSquared);
+		__m128 scale = _mm_div_ps(_mm_sub_ps(radius, distance), distance);
+		mobileX = _mm_add_ps(mobileX, _mm_and_ps(pushMask, _mm_mul_ps(dispX, scale)));
+		mobileY = _mm_add_ps(mobileY, _mm_and_ps(pushMask, _mm_mul_ps(dispY, scale)));
+	}
+
+	return GetNumSetLanes(overlapMask);
+}
+
+int PushDiscsOutOfEachOtherBatch2D(float* discACentersX, float* discACentersY, float const* discARadii, float* discBCentersX, float* discBCentersY, float const* discBRadii, int numPairs)
+{
+	__m128 zero = _mm_setzero_ps();
+	__m128 half = _mm_set1_ps(0.5f);
+
+	int numPushed = 0;
+	int pairIndex = 0;
+	for (; pairIndex + 4 <= numPairs; pairIndex += 4)
+	{
+		__m128 aX = _mm_loadu_ps(discACentersX + pairIndex);
+		__m128 aY = _mm_loadu_ps(discACentersY + pairIndex);
+		__m128 bX = _mm_loadu_ps(discBCentersX + pairIndex);
+		__m128 bY = _mm_loadu_ps(discBCentersY + pairIndex);
+		__m128 dispX = _mm_sub_ps(bX, aX);
+		__m128 dispY = _mm_sub_ps(bY, aY);
+		__m128 distSquared = _mm_add_ps(_mm_mul_ps(dispX, dispX), _mm_mul_ps(dispY, dispY));
+		__m128 radiiSum = _mm_add_ps(_mm_loadu_ps(discARadii + pairIndex), _mm_loadu_ps(discBRadii + pairIndex));
+		__m128 overlapMask = _mm_cmplt_ps(distSquared, _mm_mul_ps(radiiSum, radiiSum));
+		__m128 pushMask = _mm_and_ps(overlapMask, _mm_cmpgt_ps(distSquared, zero));
+		numPushed += GetNumSetLanes(overlapMask);
+		if (_mm_movemask_ps(pushMask) == 0)
+			continue;
+
+		__m128 distance = _mm_sqrt_ps(distSquared);
+		__m128 scale = _mm_div_ps(_mm_mul_ps(_mm_sub_ps(radiiSum, distance), half), distance);
+		__m128 correctionX = _mm_and_ps(pushMask, _mm_mul_ps(dispX, scale));
+		__m128 correctionY = _mm_and_ps(pushMask, _mm_mul_ps(dispY, scale));
+
+		_mm_storeu_ps(discACentersX + pairIndex, _mm_sub_ps(aX, correctionX));
+		_mm_storeu_ps(discACentersY + pairIndex, _mm_sub_ps(aY, correctionY));
+		_mm_storeu_ps(discBCentersX + pairIndex, _mm_add_ps(bX, correctionX));
+		_mm_storeu_ps(discBCentersY + pairIndex, _mm_add_ps(bY, correctionY));
+	}
+
+	for (; pairIndex < numPairs; ++pairIndex)
+	{
+		Vec2 discACenter(discACentersX[pairIndex], discACentersY[pairIndex]);
+		Vec2 discBCenter(discBCentersX[pairIndex], discBCentersY[pairIndex]);
+		if (PushDiscsOutOfEachOther2D(discACenter, discARadii[pairIndex], discBCenter, discBRadii[pairIndex]))
+		{
+			discACentersX[pairIndex] = discACenter.x;
+			discACentersY[pairIndex] = discACenter.y;
+			discBCentersX[pairIndex] = discBCenter.x;
+			discBCentersY[pairIndex] = discBCenter.y;
+			numPushed++;
+		}
+	}
+
+	return numPushed;
+}
+
+int PushDiscsOutOfFixedDiscBatch2D(float* mobileCentersX, float* mobileCentersY, float const* mobileRadii, int numDiscs, Vec2 const& fixedDiscCenter, float fixedDiscRadius)
+{
+	__m128 fixedX = _mm_set1_ps(fixedDiscCenter.x);
+	__m128 fixedY = _mm_set1_ps(fixedDiscCenter.y);
+	__m128 fixedRadius = _mm_set1_ps(fixedDiscRadius);
+
+	int numPushed = 0;
+	int discIndex = 0;
+	for (; discIndex + 4 <= numDiscs; discIndex += 4)
+	{
+		__m128 mobileX = _mm_loadu_ps(mobileCentersX + discIndex);
+		__m128 mobileY = _mm_loadu_ps(mobileCentersY + discIndex);
+		numPushed += PushDiscLanesOutOfFixedDiscLanes(mobileX, mobileY, _mm_loadu_ps(mobileRadii + discIndex), fixedX, fixedY, fixedRadius);
+		_mm_storeu_ps(mobileCentersX + discIndex, mobileX);
+		_mm_storeu_ps(mobileCentersY + discIndex, mobileY);
+	}
+
+	for (; discIndex < numDiscs; ++discIndex)
+	{
+		Vec2 mobileCenter(mobileCentersX[discIndex], mobileCentersY[discIndex]);
+		if (PushDiscOutOfFixedDisc2D(mobileCenter, mobileRadii[discIndex], fixedDiscCenter, fixedDiscRadius))
+		{
+			mobileCentersX[discIndex] = mobileCenter.x;
+			mobileCentersY[discIndex] = mobileCenter.y;
+			numPushed++;
+		}
+	}
+
+	return numPushed;
+}
+
+int PushDiscsOutOfFixedDiscsBatch2D(float* mobileCentersX, float* mobileCentersY, float const* mobileRadii, float const* fixedCentersX, float const* fixedCentersY, float const* fixedRadii, int numPairs)
+{
+	int numPushed = 0;
+	int pairIndex = 0;
+	for (; pairIndex + 4 <= numPairs; pairIndex += 4)
+	{
+		__m128 mobileX = _mm_loadu_ps(mobileCentersX + pairIndex);
+		__m128 mobileY = _mm_loadu_ps(mobileCentersY + pairIndex);
+		numPushed += PushDiscLanesOutOfFixedDiscLanes(mobileX, mobileY, _mm_loadu_ps(mobileRadii + pairIndex), _mm_loadu_ps(fixedCentersX + pairIndex), _mm_loadu_ps(fixedCentersY + pairIndex), _mm_loadu_ps(fixedRadii + pairIndex));
+		_mm_storeu_ps(mobileCentersX + pairIndex, mobileX);
+		_mm_storeu_ps(mobileCentersY + pairIndex, mobileY);
+	}
+
+	for (; pairIndex < numPairs; ++pairIndex)
+	{
+		Vec2 mobileCenter(mobileCentersX[pairIndex], mobileCentersY[pairIndex]);
+		if (PushDiscOutOfFixedDisc2D(mobileCenter, mobileRadii[pairIndex], Vec2(fixedCentersX[pairIndex], fixedCentersY[pairIndex]), fixedRadii[pairIndex]))
+		{
+			mobileCentersX[pairIndex] = mobileCenter.x;
+			mobileCentersY[pairIndex] = mobileCenter.y;
+			numPushed++;
+		}
+	}
+
+	return numPushed;
+}
+
+int PushDiscsOutOfFixedAABBBatch2D(float* mobileCentersX, float* mobileCentersY, float const* mobileRadii, int numDiscs, AABB2 const& fixedBox)
+{
+	__m128 minsX = _mm_set1_ps(fixedBox.m_mins.x);
+	__m128 minsY = _mm_set1_ps(fixedBox.m_mins.y);
+	__m128 maxsX = _mm_set1_ps(fixedBox.m_maxs.x);
+	__m128 maxsY = _mm_set1_ps(fixedBox.m_maxs.y);
+
+	int numPushed = 0;
+	int discIndex = 0;
+	for (; discIndex + 4 <= numDiscs; discIndex += 4)
+	{
+		__m128 mobileX = _mm_loadu_ps(mobileCentersX + discIndex);
+		__m128 mobileY = _mm_loadu_ps(mobileCentersY + discIndex);
+		numPushed += PushDiscLanesOutOfFixedAABBLanes(mobileX, mobileY, _mm_loadu_ps(mobileRadii + discIndex), minsX, minsY, maxsX, maxsY);
+		_mm_storeu_ps(mobileCentersX + discIndex, mobileX);
+		_mm_storeu_ps(mobileCentersY + discIndex, mobileY);
+	}
+
+	for (; discIndex < numDiscs; ++discIndex)
+	{
+		Vec2 mobileCenter(mobileCentersX[discIndex], mobileCentersY[discIndex]);
+		if (PushDiscOutOfFixedAABB2D(mobileCenter, mobileRadii[discIndex], fixedBox))
+		{
+			mobileCentersX[discIndex] = mobileCenter.x;
+			mobileCentersY[discIndex] = mobileCenter.y;
+			numPushed++;
+		}
+	}
+
+	return numPushed;
+}
+
+int PushDiscsOutOfFixedAABBsBatch2D(float* mobileCentersX, float* mobileCentersY, float const* mobileRadii, float const* boxMinsX, float const* boxMinsY, float const* boxMaxsX, float const* boxMaxsY, int numPairs)
+{
+	int numPushed = 0;
+	int pairIndex = 0;
+	for (; pairIndex + 4 <= numPairs; pairIndex += 4)
+	{
+		__m128 mobileX = _mm_loadu_ps(mobileCentersX + pairIndex);
+		__m128 mobileY = _mm_loadu_ps(mobileCentersY + pairIndex);
+		numPushed += PushDiscLanesOutOfFixedAABBLanes(mobileX, mobileY, _mm_loadu_ps(mobileRadii + pairIndex), _mm_loadu_ps(boxMinsX + pairIndex), _mm_loadu_ps(boxMinsY + pairIndex), _mm_loadu_ps(boxMaxsX + pairIndex), _mm_loadu_ps(boxMaxsY + pairIndex));
+		_mm_storeu_ps(mobileCentersX + pairIndex, mobileX);
+		_mm_storeu_ps(mobileCentersY + pairIndex, mobileY);
+	}
+
+	for (; pairIndex < numPairs; ++pairIndex)
+	{
+		Vec2 mobileCenter(mobileCentersX[pairIndex], mobileCentersY[pairIndex]);
+		if (PushDiscOutOfFixedAABB2D(mobileCenter, mobileRadii[pairIndex], AABB2(boxMinsX[pairIndex], boxMinsY[pairIndex], boxMaxsX[pairIndex], boxMaxsY[pairIndex])))
+		{
+			mobileCentersX[pairIndex] = mobileCenter.x;
+			mobileCentersY[pairIndex] = mobileCenter.y;
+			numPushed++;
+		}
+	}
+
+	return numPushed;
+}
+
 bool BounceDiscOutOfFixedPoint2D(Vec2& mobileDiscCenter, float mobileDiscRadius, Vec2& mobileDiscVelocity, Vec2 const& fixedPoint, float combinedElasticity)
 {
 	Vec2 displacement = mobileDiscCenter - fixedPoint;
@@ -188,6 +188,17 @@ bool PushDiscOutOfFixedDisc2D(Vec2& mobileDiscCenter, float mobileDiscRadius, Ve
 bool PushDiscsOutOfEachOther2D(Vec2& discACenter, float discARadius, Vec2& discBCenter, float discBRadius);
 bool PushDiscOutOfFixedAABB2D(Vec2& mobileDiscCenter, float discRadius, AABB2 const& fixedBox);
 
+//Batch (structure-of-arrays) overlap scan: four discs per SSE lane with a scalar tail, -1 if none in [startIndex, endIndex) overlap
+int GetFirstOverlappingDiscIndexBatch2D(Vec2 const& center, float radius, float const* centersX, float const* centersY, float const* radii, int startIndex, int endIndex);
+
+//Batch push-outs, same math and return count as the scalar push functions. One-vs-N forms push every disc out of one obstacle,
+//N-pairs forms push lane i out of obstacle i; a disc may only appear once per call
+int PushDiscsOutOfEachOtherBatch2D(float* discACentersX, float* discACentersY, float const* discARadii, float* discBCentersX, float* discBCentersY, float const* discBRadii, int numPairs);
+int PushDiscsOutOfFixedDiscBatch2D(float* mobileCentersX, float* mobileCentersY, float const* mobileRadii, int numDiscs, Vec2 const& fixedDiscCenter, float fixedDiscRadius);
+int PushDiscsOutOfFixedDiscsBatch2D(float* mobileCentersX, float* mobileCentersY, float const* mobileRadii, float const* fixedCentersX, float const* fixedCentersY, float const* fixedRadii, int numPairs);
+int PushDiscsOutOfFixedAABBBatch2D(float* mobileCentersX, float* mobileCentersY, float const* mobileRadii, int numDiscs, AABB2 const& fixedBox);
+int PushDiscsOutOfFixedAABBsBatch2D(float* mobileCentersX, float* mobileCentersY, float const* mobileRadii, float const* boxMinsX, float const* boxMinsY, float const* boxMaxsX, float const* boxMaxsY, int numPairs);
+
 bool BounceDiscOutOfFixedPoint2D(Vec2& mobileDiscCenter, float mobileDiscRadius, Vec2& mobileDiscVelocity, Vec2 const& fixedPointCenter, float combinedElasticity);
 bool BounceDiscsOutOfEachOther2D(Vec2& discACenter, float discARadius, Vec2& discAVelocity, Vec2& discBCenter, float discBRadius, Vec2& discBVelocity, float combinedElasticity);
 bool BounceDiscOutOfFixedDisc2D(Vec2& mobileDiscCenter, float mobileDiscRadius, Vec2& mobileDiscVelocity, Vec2 const& fixedDiscCenter, float fixedDiscRadius, float combinedElasticity);
@@ -154,9 +154,10 @@ Vec2 const Vec2::GetReflected(Vec2 const& normalOfSurfaceToReflectOffOf) const
 
 void Vec2::SetFromText(char const* text)
 {
-	Strings numsFromText = SplitStringOnDelimiter(text, ',');
-	x = (float)(atof(numsFromText[0].c_str()));
-	y = (float)(atof(numsFromText[1].c_str()));
+	float numsFromText[2] = {};
+	ParseNumbersFromText(text, ',', numsFromText, 2);
+	x = numsFromText[0];
+	y = numsFromText[1];
 }
 
 void Vec2::SetOrientationRadians(float newOrientationRadians)
@@ -155,10 +155,11 @@ Vec2 const Vec3::GetXY() const
 
 void Vec3::SetFromText(char const* text)
 {
-	Strings numsFromText = SplitStringOnDelimiter(text, ',');
-	x = (float)(atof(numsFromText[0].c_str()));
-	y = (float)(atof(numsFromText[1].c_str()));
-	z = (float)(atof(numsFromText[2].c_str()));
+	float numsFromText[3] = {};
+	ParseNumbersFromText(text, ',', numsFromText, 3);
+	x = numsFromText[0];
+	y = numsFromText[1];
+	z = numsFromText[2];
 }
 
 void Vec3::SetLength(float newLength)
@@ -30,11 +30,12 @@ Vec4::Vec4(Rgba8 const& color)
 
 void Vec4::SetFromText(char const* text)
 {
-	Strings numsFromText = SplitStringOnDelimiter(text, ',');
-	x = (float)(atof(numsFromText[0].c_str()));
-	y = (float)(atof(numsFromText[1].c_str()));
-	z = (float)(atof(numsFromText[2].c_str()));
-	w = (float)(atof(numsFromText[4].c_str()));
+	float numsFromText[4] = {};
+	ParseNumbersFromText(text, ',', numsFromText, 4);
+	x = numsFromText[0];
+	y = numsFromText[1];
+	z = numsFromText[2];
+	w = numsFromText[3];
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -51,7 +51,108 @@ void BitmapFont::AddVertsForCenteredText2D(std::vector<Vertex_PCU>& vertexArray,
 	}
 }
 
+void BitmapFont::AddVertsForText2D(std::vector<Vertex_PCU2D>& vertexArray, Vec2 const& textMins, float cellHeight, std::string const& text, Rgba8 const& tint, float cellAspectScale)
+{
+	float letterWidth = cellHeight * cellAspectScale;
+	for (int letterNum = 0; letterNum < (int)(text.size()); ++letterNum)
+	{
+		float xOffset = letterNum * letterWidth;
+		AABB2 letterBounds(textMins.x + xOffset, textMins.y, (textMins.x + xOffset + letterWidth), (textMins.y + cellHeight));
+		AddVertsForAABB2D(vertexArray, letterBounds, tint, GetUVsForLetter(text[letterNum]));
+	}
+}
+
+void BitmapFont::AddVertsForCenteredText2D(std::vector<Vertex_PCU2D>& vertexArray, Vec2 const& textCenter, float cellHeight, std::string const& text, Rgba8 const& tint, float cellAspectScale)
+{
+	float textWidth = GetTextWidth(cellHeight, text, cellAspectScale);
+	Vec2 textMins(textCenter.x - (textWidth * 0.5f), textCenter.y - (cellHeight * 0.5f));
+	AddVertsForText2D(vertexArray, textMins, cellHeight, text, tint, cellAspectScale);
+}
+
 float BitmapFont::AddVertsForTextInBox2D(std::vector<Vertex_PCU>& vertexArray, std::string const& text, AABB2 const& box, float cellHeight, Rgba8 const& tint, float cellAspectScale, Vec2 const& alignment, TextBoxMode mode, int maxGlyphsToDraw)
+{
+	Vec2 boxDimensions = box.m_maxs - box.m_mins;
+	TextLayoutCacheEntry const* layout = FindOrAddTextLayout(text, boxDimensions, cellHeight, cellAspectScale, alignment, mode, maxGlyphsToDraw);
+	if (layout == nullptr)
+	{
+		return LayOutTextInBox2D(vertexArray, text, box, cellHeight, tint, cellAspectScale, alignment, mode, maxGlyphsToDraw);
+	}
+
+	int firstVertex = (int)vertexArray.size();
+	vertexArray.insert(vertexArray.end(), layout->m_verts.begin(), layout->m_verts.end());
+	for (int vertNum = firstVertex; vertNum < (int)vertexArray.size(); ++vertNum)
+	{
+		Vertex_PCU& vert = vertexArray[vertNum];
+		vert.m_position.x += box.m_mins.x;
+		vert.m_position.y += box.m_mins.y;
+		vert.m_color = tint;
+	}
+
+	return layout->m_correctedCellHeight;
+}
+
+TextLayoutCacheEntry const* BitmapFont::FindOrAddTextLayout(std::string const& text, Vec2 const& boxDimensions, float cellHeight, float cellAspectScale, Vec2 const& alignment, TextBoxMode mode, int maxGlyphsToDraw)
+{
+	//FNV-1a over the text and the raw bytes of every layout setting
+	uint64_t hash = 14695981039346656037ull;
+	auto hashBytes = [&hash](void const* data, size_t numBytes)
+		{
+			unsigned char const* bytes = static_cast<unsigned char const*>(data);
+			for (size_t byteNum = 0; byteNum < numBytes; ++byteNum)
+			{
+				hash = (hash ^ bytes[byteNum]) * 1099511628211ull;
+			}
+		};
+	hashBytes(text.data(), text.size());
+	hashBytes(&boxDimensions, sizeof(boxDimensions));
+	hashBytes(&cellHeight, sizeof(cellHeight));
+	hashBytes(&cellAspectScale, sizeof(cellAspectScale));
+	hashBytes(&alignment, sizeof(alignment));
+	hashBytes(&mode, sizeof(mode));
+	hashBytes(&maxGlyphsToDraw, sizeof(maxGlyphsToDraw));
+
+	auto found = m_textLayoutIndexesByHash.find(hash);
+	if (found != m_textLayoutIndexesByHash.end())
+	{
+		TextLayoutCacheEntry const& entry = m_textLayouts[found->second];
+		bool isSameLayout = entry.m_text == text && entry.m_boxDimensions == boxDimensions && entry.m_cellHeight == cellHeight && entry.m_cellAspectScale == cellAspectScale
+			&& entry.m_alignment == alignment && entry.m_mode == mode && entry.m_maxGlyphsToDraw == maxGlyphsToDraw;
+
+		//a hash collision is laid out uncached rather than evicting the entry
+		if (!isSameLayout)
+			return nullptr;
+
+		m_numTextLayoutCacheHits++;
+		return &entry;
+	}
+
+	if ((int)m_textLayouts.size() >= MAX_CACHED_TEXT_LAYOUTS)
+	{
+		ClearTextLayoutCache();
+	}
+
+	m_numTextLayoutCacheMisses++;
+	m_textLayoutIndexesByHash[hash] = (int)m_textLayouts.size();
+	m_textLayouts.emplace_back();
+	TextLayoutCacheEntry& entry = m_textLayouts.back();
+	entry.m_text = text;
+	entry.m_boxDimensions = boxDimensions;
+	entry.m_alignment = alignment;
+	entry.m_cellHeight = cellHeight;
+	entry.m_cellAspectScale = cellAspectScale;
+	entry.m_mode = mode;
+	entry.m_maxGlyphsToDraw = maxGlyphsToDraw;
+	entry.m_correctedCellHeight = LayOutTextInBox2D(entry.m_verts, text, AABB2(Vec2::ZERO, boxDimensions), cellHeight, Rgba8::WHITE, cellAspectScale, alignment, mode, maxGlyphsToDraw);
+	return &entry;
+}
+
+void BitmapFont::ClearTextLayoutCache()
+{
+	m_textLayoutIndexesByHash.clear();
+	m_textLayouts.clear();
+}
+
+float BitmapFont::LayOutTextInBox2D(std::vector<Vertex_PCU>& vertexArray, std::string const& text, AABB2 const& box, float cellHeight, Rgba8 const& tint, float cellAspectScale, Vec2 const& alignment, TextBoxMode mode, int maxGlyphsToDraw)
 {
     float letterWidth = cellHeight * cellAspectScale;
     float boxWidth = box.m_maxs.x - box.m_mins.x;
@@ -1,12 +1,15 @@
 #pragma once
 #include "Engine/Renderer/SpriteSheet.hpp"
 #include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Math/Vec2.hpp"
 #include <vector>
 #include <string>
+#include <unordered_map>
+#include <cstdint>
 
 class Texture;
-struct Vertex_PCU;
-struct Vec2;
+struct Vertex_PCU2D;
 struct IntVec2;
 struct AABB2;
 
@@ -16,11 +19,29 @@ enum TextBoxMode : int
 	OVERRUN,
 	NUM_TEXT_BOX_MODES,
 };
+
+//One laid out AddVertsForTextInBox2D call, untinted and relative to the box mins so moving the box still hits the cache
+struct TextLayoutCacheEntry
+{
+	std::string m_text;
+	Vec2 m_boxDimensions;
+	Vec2 m_alignment;
+	float m_cellHeight = 0.f;
+	float m_cellAspectScale = 1.f;
+	TextBoxMode m_mode = SHRINK_TO_FIT;
+	int m_maxGlyphsToDraw = 0;
+
+	float m_correctedCellHeight = 0.f;
+	std::vector<Vertex_PCU> m_verts;
+};
+
+constexpr int MAX_CACHED_TEXT_LAYOUTS = 2048; //the whole cache is dropped when it fills up
 class BitmapFont
 {
 	friend class Renderer;
 	friend class RendererDX11;
 	friend class RendererDX12;
+	friend class RendererNull;
 
 private:
 	BitmapFont(char const* fontFilePathNameWithNoExtension, Texture& fontTexture, IntVec2 const& layout);
@@ -30,18 +51,32 @@ public:
 
 	void AddVertsForText2D(std::vector<Vertex_PCU>& vertexArray, Vec2 const& textMins, float cellHeight, std::string const& text, Rgba8 const& tint = Rgba8::WHITE, float cellAspectScale = 1.f);
 	void AddVertsForCenteredText2D(std::vector<Vertex_PCU>& vertexArray, Vec2 const& textCenter, float cellHeight, std::string const& text, Rgba8 const& tint = Rgba8::WHITE, float cellAspectScale = 1.f);
+	void AddVertsForText2D(std::vector<Vertex_PCU2D>& vertexArray, Vec2 const& textMins, float cellHeight, std::string const& text, Rgba8 const& tint = Rgba8::WHITE, float cellAspectScale = 1.f);
+	void AddVertsForCenteredText2D(std::vector<Vertex_PCU2D>& vertexArray, Vec2 const& textCenter, float cellHeight, std::string const& text, Rgba8 const& tint = Rgba8::WHITE, float cellAspectScale = 1.f);
+	//Cached: the layout for the same text, box size, cell height, alignment and mode is built once and copied after that
 	float AddVertsForTextInBox2D(std::vector<Vertex_PCU>& vertexArray, std::string const& text, AABB2 const& box, float cellHeight, Rgba8 const& tint = Rgba8::WHITE, float cellAspectScale = 1.f, Vec2 const& alignment = Vec2(0.5f, 0.5f), TextBoxMode mode = TextBoxMode::SHRINK_TO_FIT, int maxGlyphsToDraw = 99999999);
 	void AddVertsForText3DAtOriginXForward(std::vector<Vertex_PCU>& vertexArray, float cellHeight, std::string const& text, Rgba8 const& tint = Rgba8::WHITE, float cellAspectScale = 1.f, Vec2 const& alignment = Vec2(0.5f, 0.5f), int maxGlyphsToDraw = 99999999);
 	static float GetTextWidth(float cellHeight, std::string const& text, float cellAspectScale = 1.f);
 	AABB2 const GetUVsForLetter(char const& letter) const;
 	float GetFontAspect() const;
 
+	void ClearTextLayoutCache();
+	int GetNumTextLayoutCacheHits() const { return m_numTextLayoutCacheHits; }
+	int GetNumTextLayoutCacheMisses() const { return m_numTextLayoutCacheMisses; }
+
 protected:
 	float GetGlyphAspect(int glyphUnicode) const;
+	float LayOutTextInBox2D(std::vector<Vertex_PCU>& vertexArray, std::string const& text, AABB2 const& box, float cellHeight, Rgba8 const& tint, float cellAspectScale, Vec2 const& alignment, TextBoxMode mode, int maxGlyphsToDraw);
+	TextLayoutCacheEntry const* FindOrAddTextLayout(std::string const& text, Vec2 const& boxDimensions, float cellHeight, float cellAspectScale, Vec2 const& alignment, TextBoxMode mode, int maxGlyphsToDraw);
 
 protected:
 	std::string m_fontFilePathNameWithNoExtension;
 	SpriteSheet m_fontGlyphsSpriteSheet;
 	float m_fontDefaultAspect = 1.0f;
+
+	std::unordered_map<uint64_t, int> m_textLayoutIndexesByHash;
+	std::vector<TextLayoutCacheEntry> m_textLayouts;
+	int m_numTextLayoutCacheHits = 0;
+	int m_numTextLayoutCacheMisses = 0;
 };
 
@@ -3,12 +3,14 @@
 #include "Engine/Core/Clock.hpp"
 #include "Engine/Core/Timer.hpp"
 #include "Engine/Renderer/RendererDX11.hpp"
+#include "Engine/Renderer/RendererNull.hpp"
 #include "Engine/Renderer/Camera.hpp"
 #include "Engine/Core/VertexUtils.hpp"
 #include "Engine/Renderer/BitmapFont.hpp"
 #include "Engine/Math/MathUtils.hpp"
 #include <vector>
 #include <queue>
+#include <algorithm>
 
 DebugRenderConfig s_debugRenderConfig;
 
@@ -36,8 +38,22 @@ struct DebugScreenObject
 	float m_duration;
 	Timer m_timer;
 	int m_numInstances = 0;
+
+	//stacked message text, only formatted again when the count or stacking changes
+	std::string m_displayText;
+	int m_displayTextNumInstances = -1;
+	bool m_isDisplayTextStacked = false;
 };
 
+//Every frame each object's verts are colored (and transformed if needed) into the stream for its
+//(render mode, textured, rasterizer mode) group, then each group is one draw. Groups keep their capacity between frames.
+//Inside a group objects draw in the order they were added. Groups draw in a fixed order, so an alpha blended object can
+//now land under one added before it if the two are in different groups (e.g. text and lines, or solid and wireframe)
+constexpr int NUM_DEBUG_RENDER_MODES = 3;
+constexpr int NUM_DEBUG_TEXTURE_GROUPS = 2; //untextured, font
+Verts s_worldDrawGroups[NUM_DEBUG_RENDER_MODES][NUM_DEBUG_TEXTURE_GROUPS][(int)RasterizerMode::COUNT];
+Verts s_screenDrawVerts;
+
 std::vector<DebugObject> s_debugObjects;
 
 std::vector<DebugScreenObject> s_debugScreenObjects;
@@ -88,43 +104,112 @@ void DebugRenderStackMessages(bool stack)
 	s_stackMessages = stack;
 }
 
+//Expiry
+//-----------------------------------------------------------------------------------------------
+static bool IsDebugObjectExpired(Timer& timer, float duration)
+{
+	return timer.Tick() || duration == 0.f;
+}
+
+//Erase-remove so survivors keep the order they were added in. Alpha blended objects in one draw group
+//blend in that order, which is the order the old one draw per object path used
+template <typename T_DebugObject>
+static void RemoveExpiredDebugObjects(std::vector<T_DebugObject>& objects)
+{
+	auto isExpired = [](T_DebugObject& object) { return IsDebugObjectExpired(object.m_timer, object.m_duration); };
+	objects.erase(std::remove_if(objects.begin(), objects.end(), isExpired), objects.end());
+}
+
 void DebugRenderBeginFrame()
 {
-	for (int objectNum = 0; objectNum < (int)s_debugObjects.size(); ++objectNum)
-	{
-		DebugObject& object = s_debugObjects[objectNum];
+	RemoveExpiredDebugObjects(s_debugObjects);
+	RemoveExpiredDebugObjects(s_debugScreenObjects);
+	RemoveExpiredDebugObjects(s_messageObjects);
+}
 
-		if (object.m_timer.Tick() || object.m_duration == 0.f)
-		{
-			s_debugObjects.erase(s_debugObjects.begin() + objectNum);
-			objectNum--;
-		}
-	}
+void DebugRenderEndFrame()
+{
+}
 
-	for (int screenObjectNum = 0; screenObjectNum < (int)s_debugScreenObjects.size(); ++screenObjectNum)
-	{
-		DebugScreenObject& screenObject = s_debugScreenObjects[screenObjectNum];
+//Render
+//-----------------------------------------------------------------------------------------------
+static Rgba8 MultiplyDebugColors(Rgba8 const& colorA, Rgba8 const& colorB)
+{
+	return Rgba8((unsigned char)((colorA.r * colorB.r + 127) / 255), (unsigned char)((colorA.g * colorB.g + 127) / 255),
+		(unsigned char)((colorA.b * colorB.b + 127) / 255), (unsigned char)((colorA.a * colorB.a + 127) / 255));
+}
 
-		if (screenObject.m_timer.Tick() || screenObject.m_duration == 0.f)
-		{
-			s_debugScreenObjects.erase(s_debugScreenObjects.begin() + screenObjectNum);
-			screenObjectNum--;
-		}
+//the shader multiplies vertex color by model color, this does the same on the CPU so the draw can use white
+static void AppendColoredDebugVerts(Verts& out_verts, Verts const& verts, Rgba8 const& color)
+{
+	int firstVertex = (int)out_verts.size();
+	out_verts.insert(out_verts.end(), verts.begin(), verts.end());
+	if (color == Rgba8::WHITE)
+		return;
+
+	for (int vertNum = firstVertex; vertNum < (int)out_verts.size(); ++vertNum)
+	{
+		out_verts[vertNum].m_color = MultiplyDebugColors(out_verts[vertNum].m_color, color);
 	}
+}
 
-	for (int messageObjectNum = 0; messageObjectNum < (int)s_messageObjects.size(); ++messageObjectNum)
+static void AppendTransformedDebugVerts(Verts& out_verts, Verts const& verts, Rgba8 const& color, Mat44 const& transform)
+{
+	int firstVertex = (int)out_verts.size();
+	AppendColoredDebugVerts(out_verts, verts, color);
+	for (int vertNum = firstVertex; vertNum < (int)out_verts.size(); ++vertNum)
 	{
-		DebugScreenObject& messageObject = s_messageObjects[messageObjectNum];
-		if (messageObject.m_timer.Tick() || messageObject.m_duration == 0.f)
-		{
-			s_messageObjects.erase(s_messageObjects.begin() + messageObjectNum);
-			messageObjectNum--;
-		}
+		out_verts[vertNum].m_position = transform.TransformPosition3D(out_verts[vertNum].m_position);
 	}
 }
 
-void DebugRenderEndFrame()
+static void DrawDebugWorldGroups(RendererDX11* renderer, DebugRenderMode renderMode, BitmapFont* font)
 {
+	for (int textureGroup = 0; textureGroup < NUM_DEBUG_TEXTURE_GROUPS; ++textureGroup)
+	{
+		for (int rasterizerMode = 0; rasterizerMode < (int)RasterizerMode::COUNT; ++rasterizerMode)
+		{
+			Verts const& verts = s_worldDrawGroups[(int)renderMode][textureGroup][rasterizerMode];
+			if (verts.empty())
+				continue;
+
+			bool isText = (textureGroup == 1);
+			renderer->SetRasterizerMode((RasterizerMode)rasterizerMode);
+			renderer->SetSamplerMode(isText ? SamplerMode::POINT_CLAMP : SamplerMode::BILINEAR_WRAP);
+			renderer->BindTexture(isText ? &font->GetTexture() : nullptr);
+			renderer->BindShader(nullptr);
+
+			switch (renderMode)
+			{
+			case DebugRenderMode::ALWAYS:
+				renderer->SetDepthMode(DepthMode::DISABLED);
+				renderer->SetBlendMode(BlendMode::ALPHA);
+				break;
+
+			case DebugRenderMode::USE_DEPTH:
+				renderer->SetDepthMode(DepthMode::READ_WRITE_LESS_EQUAL);
+				renderer->SetBlendMode(BlendMode::ALPHA);
+				break;
+
+			case DebugRenderMode::X_RAY:
+				//Transparent pass
+				renderer->SetDepthMode(DepthMode::READ_ONLY_ALWAYS);
+				renderer->SetBlendMode(BlendMode::ALPHA);
+				renderer->SetModelConstants(Mat44::IDENTITY, Rgba8(255, 255, 255, 100));
+				renderer->DrawVertexArray(verts);
+
+				renderer->SetDepthMode(DepthMode::READ_WRITE_LESS_EQUAL);
+				renderer->SetBlendMode(BlendMode::OPAQUE);
+				break;
+
+			default:
+				break;
+			}
+
+			renderer->SetModelConstants(Mat44::IDENTITY, Rgba8::WHITE);
+			renderer->DrawVertexArray(verts);
+		}
+	}
 }
 
 void DebugRenderWorld(Camera const& camera)
@@ -133,97 +218,94 @@ void DebugRenderWorld(Camera const& camera)
 		return;
 
 	Renderer* renderer = s_debugRenderConfig.m_renderer;
+	if (dynamic_cast<RendererNull*>(renderer) != nullptr)
+		return;
+
 	RendererDX11* rendererDX11 = dynamic_cast<RendererDX11*>(renderer);
 	GUARANTEE_OR_DIE(rendererDX11, "trying to render without DX11");
-	rendererDX11->BeginCamera(camera);
-	rendererDX11->BeginRendererEvent("DRAW - Debug World Objects");
+
+	for (int renderMode = 0; renderMode < NUM_DEBUG_RENDER_MODES; ++renderMode)
+	{
+		for (int textureGroup = 0; textureGroup < NUM_DEBUG_TEXTURE_GROUPS; ++textureGroup)
+		{
+			for (int rasterizerMode = 0; rasterizerMode < (int)RasterizerMode::COUNT; ++rasterizerMode)
+			{
+				s_worldDrawGroups[renderMode][textureGroup][rasterizerMode].clear();
+			}
+		}
+	}
+
+	Mat44 cameraTransform = Mat44::MakeTranslation3D(camera.GetPosition());
+	cameraTransform.Append(camera.GetOrientation().GetAsMatrix_IFwd_JLeft_KUp());
 
 	for (int objectNum = 0; objectNum < (int)s_debugObjects.size(); ++objectNum)
 	{
 		DebugObject& object = s_debugObjects[objectNum];
 		Rgba8 color = Rgba8::ColorLerp(object.m_startColor, object.m_endColor, object.m_timer.GetElapsedFraction());
-		Rgba8 transparentColor(color.r, color.g, color.b, 100);
-		Mat44 transform = object.m_transform;
+		Verts& groupVerts = s_worldDrawGroups[(int)object.m_renderMode][object.m_worldText ? 1 : 0][(int)object.m_rasterizerMode];
 
-		switch (object.m_renderMode)
+		//only text has a model transform, everything else was built in world space
+		if (object.m_billboardToCamera)
 		{
-		case DebugRenderMode::ALWAYS:
-			
-			rendererDX11->SetDepthMode(DepthMode::DISABLED);
-			rendererDX11->SetBlendMode(BlendMode::ALPHA);
-			break;
-		case DebugRenderMode::USE_DEPTH:
-			rendererDX11->SetDepthMode(DepthMode::READ_WRITE_LESS_EQUAL);
-			rendererDX11->SetBlendMode(BlendMode::ALPHA);
-			break;
-
-		case DebugRenderMode::X_RAY:
-			//Transparent pass
-			if (object.m_billboardToCamera)
-			{
-				Mat44 cameraTransform;
-				cameraTransform.MakeTranslation3D(camera.GetPosition());
-				Mat44 rotation = camera.GetOrientation().GetAsMatrix_IFwd_JLeft_KUp();
-				cameraTransform.Append(rotation);
-				Vec3 objectPos = object.m_transform.GetTranslation3D();
-				transform = GetBillboardTransform(object.m_billboardType, cameraTransform, objectPos);
-			}
-
-			rendererDX11->SetDepthMode(DepthMode::READ_ONLY_ALWAYS);
-			rendererDX11->SetBlendMode(BlendMode::ALPHA);
-			rendererDX11->SetSamplerMode(SamplerMode::BILINEAR_WRAP);
-			rendererDX11->SetRasterizerMode(object.m_rasterizerMode);
-			rendererDX11->SetModelConstants(transform, transparentColor);
-			rendererDX11->BindShader(nullptr);
-			rendererDX11->BindTexture(nullptr);
-			rendererDX11->DrawVertexArray(object.m_verts);
-
-			rendererDX11->SetDepthMode(DepthMode::READ_WRITE_LESS_EQUAL);
-			rendererDX11->SetBlendMode(BlendMode::OPAQUE);
-			break;
-		default:
-			break;
+			Mat44 transform = GetBillboardTransform(object.m_billboardType, cameraTransform, object.m_transform.GetTranslation3D());
+			AppendTransformedDebugVerts(groupVerts, object.m_verts, color, transform);
 		}
 
-		if (object.m_billboardToCamera)
+		else if (object.m_worldText)
 		{
-			Mat44 cameraTransform = Mat44::MakeTranslation3D(camera.GetPosition());
-			Mat44 rotation = camera.GetOrientation().GetAsMatrix_IFwd_JLeft_KUp();
-			cameraTransform.Append(rotation);
-			Vec3 objectPos = object.m_transform.GetTranslation3D();
-			transform = GetBillboardTransform(object.m_billboardType, cameraTransform, objectPos);
+			AppendTransformedDebugVerts(groupVerts, object.m_verts, color, object.m_transform);
 		}
-		rendererDX11->SetRasterizerMode(object.m_rasterizerMode);
-		rendererDX11->SetSamplerMode(SamplerMode::BILINEAR_WRAP);
-		rendererDX11->SetModelConstants(transform, color);
-		rendererDX11->BindTexture(nullptr);
-		if (object.m_worldText)
+
+		else
 		{
-			BitmapFont* font = rendererDX11->CreatOrGetBitMapFontFromFile(s_debugRenderConfig.m_fontName.c_str());
-			rendererDX11->BindTexture(&font->GetTexture());
-			rendererDX11->SetSamplerMode(SamplerMode::POINT_CLAMP);
+			AppendColoredDebugVerts(groupVerts, object.m_verts, color);
 		}
-		rendererDX11->BindShader(nullptr);
-		rendererDX11->DrawVertexArray(object.m_verts);
 	}
 
+	rendererDX11->BeginCamera(camera);
+	rendererDX11->BeginRendererEvent("DRAW - Debug World Objects");
+	BitmapFont* font = rendererDX11->CreatOrGetBitMapFontFromFile(s_debugRenderConfig.m_fontName.c_str());
+
+	//ALWAYS last so it ends up on top of everything
+	DrawDebugWorldGroups(rendererDX11, DebugRenderMode::USE_DEPTH, font);
+	DrawDebugWorldGroups(rendererDX11, DebugRenderMode::X_RAY, font);
+	DrawDebugWorldGroups(rendererDX11, DebugRenderMode::ALWAYS, font);
+
+	rendererDX11->SetModelConstants();
 	rendererDX11->EndRendererEvent();
 	rendererDX11->EndCamera(camera);
 }
 
+static std::string const& GetMessageDisplayText(DebugScreenObject& messageObject)
+{
+	if (!s_stackMessages)
+		return messageObject.m_text;
+
+	if (messageObject.m_displayTextNumInstances != messageObject.m_numInstances || !messageObject.m_isDisplayTextStacked)
+	{
+		messageObject.m_displayText = Stringf("%s (%i)", messageObject.m_text.c_str(), messageObject.m_numInstances);
+		messageObject.m_displayTextNumInstances = messageObject.m_numInstances;
+		messageObject.m_isDisplayTextStacked = true;
+	}
+
+	return messageObject.m_displayText;
+}
+
 void DebugRenderScreen(Camera const& camera)
 {
 	if (!s_isVisible)
 		return;
 
 	Renderer* renderer = s_debugRenderConfig.m_renderer;
+	if (dynamic_cast<RendererNull*>(renderer) != nullptr)
+		return;
+
 	RendererDX11* rendererDX11 = dynamic_cast<RendererDX11*>(renderer);
 	GUARANTEE_OR_DIE(rendererDX11, "trying to render without DX11");
-
-	rendererDX11->BeginCamera(camera);
-	rendererDX11->BeginRendererEvent("DRAW - Debug Screen Objects");
 	BitmapFont* font = rendererDX11->CreatOrGetBitMapFontFromFile(s_debugRenderConfig.m_fontName.c_str());
 
+	//screen text and messages share every state, so they all go out in one draw
+	s_screenDrawVerts.clear();
 	for (int textNum = 0; textNum < (int)s_debugScreenObjects.size(); ++textNum)
 	{
 		DebugScreenObject& textObject = s_debugScreenObjects[textNum];
@@ -233,21 +315,12 @@ void DebugRenderScreen(Camera const& camera)
 			color = Rgba8::ColorLerp(textObject.m_startColor, textObject.m_endColor, textObject.m_timer.GetElapsedFraction());
 		}
 
-		rendererDX11->SetBlendMode(BlendMode::ALPHA);
-		rendererDX11->SetDepthMode(DepthMode::DISABLED);
-		rendererDX11->SetRasterizerMode(RasterizerMode::SOLID_CULL_BACK);
-		rendererDX11->SetSamplerMode(SamplerMode::POINT_CLAMP);
-		rendererDX11->SetModelConstants(Mat44::IDENTITY, color);
-		rendererDX11->BindShader(nullptr);
-		rendererDX11->BindTexture(&font->GetTexture());
-		rendererDX11->DrawVertexArray(textObject.m_verts);
+		AppendColoredDebugVerts(s_screenDrawVerts, textObject.m_verts, color);
 	}
 
-
 	AABB2 cameraBounds = AABB2(camera.GetOrthoBottomLeft(), camera.GetOrthoTopRight());
 	float lineHeight = 0.02f * (cameraBounds.m_maxs.y - cameraBounds.m_mins.y);
 	float lineWidth = 0.15f * (cameraBounds.m_maxs.x - cameraBounds.m_mins.x);
-	Verts messageVerts;
 	for (int messageNum = 0; messageNum < (int)s_messageObjects.size(); ++messageNum)
 	{
 		//work backwards to first add infinite messages and then most recent message added from top to bottom
@@ -259,13 +332,16 @@ void DebugRenderScreen(Camera const& camera)
 			color = Rgba8::ColorLerp(messageObject.m_startColor, messageObject.m_endColor, messageObject.m_timer.GetElapsedFraction());
 		}
 
-		std::string text = s_stackMessages ? Stringf("%s (%i)", messageObject.m_text.c_str(), messageObject.m_numInstances) : messageObject.m_text;
-
 		AABB2 lineBounds = AABB2(cameraBounds.m_mins.x, cameraBounds.m_maxs.y - ((messageNum + 1) * lineHeight), 
 			cameraBounds.m_mins.x + lineWidth, cameraBounds.m_maxs.y - (messageNum * lineHeight));
-		font->AddVertsForTextInBox2D(messageVerts, text, lineBounds, lineHeight, color, 1.f, Vec2(0.f, 0.5f), SHRINK_TO_FIT);
+		font->AddVertsForTextInBox2D(s_screenDrawVerts, GetMessageDisplayText(messageObject), lineBounds, lineHeight, color, 1.f, Vec2(0.f, 0.5f), SHRINK_TO_FIT);
 	}
 
+	if (s_screenDrawVerts.empty())
+		return;
+
+	rendererDX11->BeginCamera(camera);
+	rendererDX11->BeginRendererEvent("DRAW - Debug Screen Objects");
 	rendererDX11->SetBlendMode(BlendMode::ALPHA);
 	rendererDX11->SetDepthMode(DepthMode::DISABLED);
 	rendererDX11->SetSamplerMode(SamplerMode::POINT_CLAMP);
@@ -273,8 +349,7 @@ void DebugRenderScreen(Camera const& camera)
 	rendererDX11->SetModelConstants(Mat44::IDENTITY, Rgba8::WHITE);
 	rendererDX11->BindTexture(&font->GetTexture());
 	rendererDX11->BindShader(nullptr);
-	rendererDX11->DrawVertexArray(messageVerts);
-
+	rendererDX11->DrawVertexArray(s_screenDrawVerts);
 	rendererDX11->EndRendererEvent();
 	rendererDX11->EndCamera(camera);
 }
@@ -122,6 +122,75 @@ protected:
 	}
 
 
+	)";
+
+	//Instanced 2D quads, one QuadInstance2D per instance and no per vertex buffer.
+	//Drawn with the shared quad index buffer so SV_VertexID is the corner: 0 BL, 1 BR, 2 TR, 3 TL
+	const char* m_quadInstance2DShaderSource = R"(
+	cbuffer CameraConstants : register(b2)
+	{
+		float4x4 WorldToCameraTransform;
+		float4x4 CameraToRenderTransform;
+		float4x4 RenderToClipTransform;
+	};
+	
+	cbuffer ModelConstants : register(b3)
+	{
+		float4x4 ModelToWorldTransform;
+		float4 ModelColor;
+	};
+
+	struct vs_input_t
+	{
+		uint cornerIndex : SV_VertexID;
+		float2 position : INSTANCE_POSITION;
+		float2 iBasis : INSTANCE_IBASIS;
+		float4 localBounds : INSTANCE_BOUNDS;
+		float4 uvs : INSTANCE_UVS;
+		float4 color : COLOR;
+	};
+	
+	struct v2p_t
+	{
+		float4 clipSpacePosition : SV_Position;
+		float4 color : COLOR;
+		float2 uv : TEXCOORD;
+	};
+
+	Texture2D diffuseTexture : register(t0);
+
+	SamplerState diffuseSampler : register(s0);
+	
+	v2p_t VertexMain(vs_input_t input)
+	{
+		float2 corner = float2((input.cornerIndex == 1 || input.cornerIndex == 2) ? 1.f : 0.f, (input.cornerIndex >= 2) ? 1.f : 0.f);
+		float2 localPosition = lerp(input.localBounds.xy, input.localBounds.zw, corner);
+		float2 jBasis = float2(-input.iBasis.y, input.iBasis.x);
+		float2 position = input.position + (input.iBasis * localPosition.x) + (jBasis * localPosition.y);
+
+		float4 modelSpacePosition = float4(position, 0, 1);
+		float4 worldSpacePosition = mul(ModelToWorldTransform,modelSpacePosition);
+		float4 cameraSpacePosition = mul(WorldToCameraTransform, worldSpacePosition);
+		float4 renderSpacePosition = mul(CameraToRenderTransform, cameraSpacePosition);
+		float4 clipSpacePosition = mul(RenderToClipTransform, renderSpacePosition);
+	
+		v2p_t v2p;
+		v2p.clipSpacePosition = clipSpacePosition;
+		v2p.color = input.color;
+		v2p.uv = lerp(input.uvs.xy, input.uvs.zw, corner);
+		return v2p;
+	}
+
+	float4 PixelMain(v2p_t input) : SV_Target0
+	{
+		float4 textureColor = diffuseTexture.Sample(diffuseSampler, input.uv);
+		float4 vertexColor = input.color;
+		float4 color = textureColor * vertexColor * ModelColor;
+		clip(color.a - 0.01f);
+		return float4(color);
+	}
+
+
 	)";
 };
 
@@ -0,0 +1,98 @@
+#include "Engine/Renderer/FrameRingAllocator.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Math/MathUtils.hpp"
+
+FrameRingAllocator::FrameRingAllocator(unsigned int capacityBytes, int maxFramesInFlight)
+	:m_capacity(capacityBytes)
+	,m_maxFramesInFlight(GetClampedInt(maxFramesInFlight, 0, MAX_RING_FRAMES_IN_FLIGHT - 1))
+{
+}
+
+bool FrameRingAllocator::Allocate(unsigned int numBytes, unsigned int alignment, FrameRingAllocation& out_allocation)
+{
+	if (numBytes == 0 || numBytes > m_capacity)
+		return false;
+
+	//alignment is a vertex stride as often as a power of two
+	unsigned int alignedHead = (alignment > 1) ? ((m_head + alignment - 1) / alignment) * alignment : m_head;
+	unsigned int offset = alignedHead;
+	unsigned int numPaddingBytes = alignedHead - m_head;
+	bool didWrap = m_needsWrap;
+	if (didWrap || alignedHead + numBytes > m_capacity)
+	{
+		//the tail end of the ring is wasted until the frame that skipped it retires
+		offset = 0;
+		numPaddingBytes = m_needsWrap ? 0 : m_capacity - m_head;
+		didWrap = true;
+	}
+
+	//free space runs forward from the head to the oldest in flight byte
+	if (m_numUsedBytes + numPaddingBytes + numBytes > m_capacity)
+		return false;
+
+	//a ring filled exactly leaves the head at m_capacity, so the next allocation takes the wrap branch and reports it
+	m_needsWrap = false;
+	m_head = offset + numBytes;
+	m_numUsedBytes += numPaddingBytes + numBytes;
+	m_numBytesThisFrame += numPaddingBytes + numBytes;
+	m_lastAllocationEnd = offset + numBytes;
+	m_lastAllocationSize = numBytes;
+
+	out_allocation.m_offset = offset;
+	out_allocation.m_size = numBytes;
+	out_allocation.m_didWrap = didWrap;
+	return true;
+}
+
+void FrameRingAllocator::TrimLastAllocation(unsigned int usedBytes)
+{
+	GUARANTEE_OR_DIE(usedBytes <= m_lastAllocationSize, "Trimming a ring allocation past its size");
+
+	unsigned int numFreedBytes = m_lastAllocationSize - usedBytes;
+	m_lastAllocationEnd -= numFreedBytes;
+	m_lastAllocationSize = usedBytes;
+	m_head = m_lastAllocationEnd;
+	m_numUsedBytes -= numFreedBytes;
+	m_numBytesThisFrame -= numFreedBytes;
+}
+
+void FrameRingAllocator::EndFrame()
+{
+	//m_maxFramesInFlight is clamped below MAX_RING_FRAMES_IN_FLIGHT so there is always a free slot here
+	int newestFrameIndex = (m_oldestFrameIndex + m_numFramesInFlight) % MAX_RING_FRAMES_IN_FLIGHT;
+	m_frameSizes[newestFrameIndex] = m_numBytesThisFrame;
+	m_numFramesInFlight++;
+	m_numBytesThisFrame = 0;
+	m_lastAllocationSize = 0;
+
+	while (m_numFramesInFlight > m_maxFramesInFlight)
+	{
+		RetireOldestFrame();
+	}
+}
+
+void FrameRingAllocator::Reset()
+{
+	m_head = 0;
+	m_numUsedBytes = 0;
+	m_numBytesThisFrame = 0;
+	m_lastAllocationEnd = 0;
+	m_lastAllocationSize = 0;
+	m_numFramesInFlight = 0;
+	m_oldestFrameIndex = 0;
+	m_needsWrap = true;
+}
+
+void FrameRingAllocator::Resize(unsigned int capacityBytes)
+{
+	m_capacity = capacityBytes;
+	Reset();
+}
+
+void FrameRingAllocator::RetireOldestFrame()
+{
+	m_numUsedBytes -= m_frameSizes[m_oldestFrameIndex];
+	m_frameSizes[m_oldestFrameIndex] = 0;
+	m_oldestFrameIndex = (m_oldestFrameIndex + 1) % MAX_RING_FRAMES_IN_FLIGHT;
+	m_numFramesInFlight--;
+}
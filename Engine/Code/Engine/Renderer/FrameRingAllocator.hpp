@@ -0,0 +1,49 @@
+#pragma once
+
+constexpr int MAX_RING_FRAMES_IN_FLIGHT = 4;
+
+struct FrameRingAllocation
+{
+	unsigned int m_offset = 0;	//bytes from the start of the ring
+	unsigned int m_size = 0;
+	bool m_didWrap = false;		//went back to offset 0, backends without fences should orphan (D3D11 WRITE_DISCARD) before writing
+};
+
+//Hands out byte ranges of a fixed size ring for transient per frame data, it owns no memory itself.
+//The backend maps its buffer however it likes and writes at the returned offsets, so the ring logic runs headless too.
+//Bytes allocated in the last m_maxFramesInFlight frames are never handed out again, that is the fence a persistently
+//mapped buffer needs. Allocate() fails instead of overwriting them; backends that can orphan call Reset() and retry.
+class FrameRingAllocator
+{
+public:
+	explicit FrameRingAllocator(unsigned int capacityBytes = 0, int maxFramesInFlight = 2);
+
+	bool			Allocate(unsigned int numBytes, unsigned int alignment, FrameRingAllocation& out_allocation);
+	void			TrimLastAllocation(unsigned int usedBytes); //give back the unused tail of the last allocation
+	void			EndFrame();
+	void			Reset(); //forget everything in flight, the next allocation starts at 0 and reports a wrap
+	void			Resize(unsigned int capacityBytes); //also resets
+
+	unsigned int	GetCapacity() const { return m_capacity; }
+	unsigned int	GetNumUsedBytes() const { return m_numUsedBytes; }
+	unsigned int	GetNumBytesThisFrame() const { return m_numBytesThisFrame; }
+	int				GetNumFramesInFlight() const { return m_numFramesInFlight; }
+
+private:
+	void			RetireOldestFrame();
+
+private:
+	unsigned int m_capacity = 0;
+	unsigned int m_head = 0;				//m_capacity after an allocation that ends the ring exactly
+	unsigned int m_numUsedBytes = 0;		//everything still in flight including this frame, wrap padding counts as used
+	unsigned int m_numBytesThisFrame = 0;
+	bool m_needsWrap = true;				//true until the first allocation after a reset so the backend orphans its buffer
+
+	unsigned int m_lastAllocationEnd = 0;
+	unsigned int m_lastAllocationSize = 0;
+
+	int m_maxFramesInFlight = 2;
+	int m_numFramesInFlight = 0;
+	int m_oldestFrameIndex = 0;
+	unsigned int m_frameSizes[MAX_RING_FRAMES_IN_FLIGHT] = {};
+};
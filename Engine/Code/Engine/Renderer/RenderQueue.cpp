@@ -0,0 +1,177 @@
+#include "Engine/Renderer/RenderQueue.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+
+//Sort keys
+//-----------------------------------------------------------------------------------------------
+uint64_t MakeRenderSortKey(int layer, BlendMode blendMode, int shaderID, int textureID, float depthZeroToOne)
+{
+	GUARANTEE_OR_DIE(layer >= 0 && layer < MAX_RENDER_SORT_LAYERS, "Render sort layer out of range");
+	GUARANTEE_OR_DIE(shaderID >= 0 && shaderID < MAX_RENDER_SORT_SHADERS, "Too many shaders in one render queue");
+	GUARANTEE_OR_DIE(textureID >= 0 && textureID < MAX_RENDER_SORT_TEXTURES, "Too many textures in one render queue");
+
+	uint64_t depthBits = static_cast<uint64_t>(GetClampedZeroToOne(depthZeroToOne) * static_cast<float>(0xFFFFFF));
+	return (static_cast<uint64_t>(layer) << RENDER_SORT_KEY_LAYER_SHIFT)
+		| (static_cast<uint64_t>(blendMode) << RENDER_SORT_KEY_BLEND_SHIFT)
+		| (static_cast<uint64_t>(shaderID) << RENDER_SORT_KEY_SHADER_SHIFT)
+		| (static_cast<uint64_t>(textureID) << RENDER_SORT_KEY_TEXTURE_SHIFT)
+		| depthBits;
+}
+
+void RadixSortRenderEntries(std::vector<RenderSortEntry>& entries, std::vector<RenderSortEntry>& scratch)
+{
+	int numEntries = static_cast<int>(entries.size());
+	if (numEntries < 2)
+		return;
+
+	//bits that differ between any two keys, bytes without any are already sorted
+	uint64_t differingBits = 0;
+	for (int entryIndex = 1; entryIndex < numEntries; ++entryIndex)
+	{
+		differingBits |= entries[entryIndex].m_sortKey ^ entries[0].m_sortKey;
+	}
+
+	scratch.resize(numEntries);
+	for (int shift = 0; shift < 64; shift += 8)
+	{
+		if (((differingBits >> shift) & 0xFF) == 0)
+			continue;
+
+		int bucketStarts[256] = {};
+		for (int entryIndex = 0; entryIndex < numEntries; ++entryIndex)
+		{
+			bucketStarts[(entries[entryIndex].m_sortKey >> shift) & 0xFF]++;
+		}
+
+		int runningTotal = 0;
+		for (int bucketIndex = 0; bucketIndex < 256; ++bucketIndex)
+		{
+			int bucketCount = bucketStarts[bucketIndex];
+			bucketStarts[bucketIndex] = runningTotal;
+			runningTotal += bucketCount;
+		}
+
+		for (int entryIndex = 0; entryIndex < numEntries; ++entryIndex)
+		{
+			RenderSortEntry const& entry = entries[entryIndex];
+			scratch[bucketStarts[(entry.m_sortKey >> shift) & 0xFF]++] = entry;
+		}
+
+		entries.swap(scratch);
+	}
+}
+
+//RenderQueue
+//-----------------------------------------------------------------------------------------------
+void RenderQueue::Begin()
+{
+	m_packets.clear();
+	m_vertexes.clear();
+	m_sortEntries.clear();
+	m_shadersByID.clear();
+	m_texturesByID.clear();
+	m_isSorted = false;
+}
+
+void RenderQueue::AddDraw(int layer, BlendMode blendMode, Shader* shader, Texture* texture, int numVertexes, Vertex_PCU const* vertexes, float depthZeroToOne)
+{
+	if (numVertexes <= 0)
+		return;
+
+	RenderPacket packet;
+	packet.m_texture = texture;
+	packet.m_shader = shader;
+	packet.m_blendMode = blendMode;
+	packet.m_firstVertex = static_cast<int>(m_vertexes.size());
+	packet.m_numVertexes = numVertexes;
+	m_vertexes.insert(m_vertexes.end(), vertexes, vertexes + numVertexes);
+
+	RenderSortEntry sortEntry;
+	sortEntry.m_sortKey = MakeRenderSortKey(layer, blendMode, GetShaderID(shader), GetTextureID(texture), depthZeroToOne);
+	sortEntry.m_index = static_cast<int>(m_packets.size());
+	m_sortEntries.push_back(sortEntry);
+	m_packets.push_back(packet);
+	m_isSorted = false;
+}
+
+void RenderQueue::AddDraw(int layer, BlendMode blendMode, Shader* shader, Texture* texture, std::vector<Vertex_PCU> const& vertexes, float depthZeroToOne)
+{
+	if (vertexes.empty())
+		return;
+
+	AddDraw(layer, blendMode, shader, texture, static_cast<int>(vertexes.size()), vertexes.data(), depthZeroToOne);
+}
+
+void RenderQueue::Sort()
+{
+	RadixSortRenderEntries(m_sortEntries, m_sortScratch);
+	m_isSorted = true;
+}
+
+int RenderQueue::GetShaderID(Shader* shader)
+{
+	//ids are handed out in first use order each frame, only a handful of shaders and textures show up per frame
+	for (int shaderID = 0; shaderID < static_cast<int>(m_shadersByID.size()); ++shaderID)
+	{
+		if (m_shadersByID[shaderID] == shader)
+			return shaderID;
+	}
+
+	m_shadersByID.push_back(shader);
+	return static_cast<int>(m_shadersByID.size()) - 1;
+}
+
+int RenderQueue::GetTextureID(Texture* texture)
+{
+	for (int textureID = 0; textureID < static_cast<int>(m_texturesByID.size()); ++textureID)
+	{
+		if (m_texturesByID[textureID] == texture)
+			return textureID;
+	}
+
+	m_texturesByID.push_back(texture);
+	return static_cast<int>(m_texturesByID.size()) - 1;
+}
+
+//NullRenderBackend
+//-----------------------------------------------------------------------------------------------
+void NullRenderBackend::SetBlendMode(BlendMode blendMode)
+{
+	UNUSED(blendMode);
+	m_numBlendModeCalls++;
+}
+
+void NullRenderBackend::BindShader(Shader* shader)
+{
+	UNUSED(shader);
+	m_numShaderBinds++;
+}
+
+void NullRenderBackend::BindTexture(Texture* texture)
+{
+	UNUSED(texture);
+	m_numTextureBinds++;
+}
+
+void NullRenderBackend::DrawVertexArray(int numVertexes, Vertex_PCU const* vertexes)
+{
+	UNUSED(vertexes);
+	m_numDrawCalls++;
+	m_numVertexesDrawn += numVertexes;
+}
+
+Vertex_PCU* NullRenderBackend::BeginTransientVertexArray(int maxNumVertexes)
+{
+	if (static_cast<int>(m_transientVertexes.size()) < maxNumVertexes)
+	{
+		m_transientVertexes.resize(maxNumVertexes);
+	}
+	return m_transientVertexes.data();
+}
+
+void NullRenderBackend::EndTransientVertexArray(int numVertexes)
+{
+	DrawVertexArray(numVertexes, m_transientVertexes.data());
+}
@@ -0,0 +1,168 @@
+#pragma once
+#include "Engine/Core/Vertex_PCU.hpp"
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+class Texture;
+class Shader;
+enum class BlendMode : int;
+
+//Sort key layout, most significant first: layer 8 | blend 4 | shader 12 | texture 16 | depth 24
+constexpr int RENDER_SORT_KEY_LAYER_SHIFT = 56;
+constexpr int RENDER_SORT_KEY_BLEND_SHIFT = 52;
+constexpr int RENDER_SORT_KEY_SHADER_SHIFT = 40;
+constexpr int RENDER_SORT_KEY_TEXTURE_SHIFT = 24;
+constexpr int MAX_RENDER_SORT_LAYERS = 256;
+constexpr int MAX_RENDER_SORT_SHADERS = 4096;
+constexpr int MAX_RENDER_SORT_TEXTURES = 65536;
+
+uint64_t MakeRenderSortKey(int layer, BlendMode blendMode, int shaderID, int textureID, float depthZeroToOne = 0.f);
+
+//Sorts entries by m_sortKey with an LSD radix sort, stable so equal keys stay in submission order.
+//Byte positions that are the same for every key are skipped, so small key ranges cost only a pass or two.
+struct RenderSortEntry
+{
+	uint64_t m_sortKey = 0;
+	int m_index = 0;
+};
+void RadixSortRenderEntries(std::vector<RenderSortEntry>& entries, std::vector<RenderSortEntry>& scratch);
+
+struct RenderPacket
+{
+	Texture* m_texture = nullptr;
+	Shader* m_shader = nullptr; //nullptr for the default shader
+	BlendMode m_blendMode;
+	int m_firstVertex = 0;
+	int m_numVertexes = 0;
+};
+
+struct RenderQueueStats
+{
+	int m_numPackets = 0;
+	int m_numDraws = 0;
+	int m_numBlendChanges = 0;
+	int m_numShaderChanges = 0;
+	int m_numTextureChanges = 0;
+
+	int GetNumStateChanges() const { return m_numBlendChanges + m_numShaderChanges + m_numTextureChanges; }
+};
+
+//Collects draws for a frame, then sorts them by key and submits them with only the state changes that are needed.
+//Consecutive packets that end up with identical state are merged into a single draw.
+class RenderQueue
+{
+public:
+	void Begin();
+	void AddDraw(int layer, BlendMode blendMode, Shader* shader, Texture* texture, int numVertexes, Vertex_PCU const* vertexes, float depthZeroToOne = 0.f);
+	void AddDraw(int layer, BlendMode blendMode, Shader* shader, Texture* texture, std::vector<Vertex_PCU> const& vertexes, float depthZeroToOne = 0.f);
+	void Sort();
+
+	//Backend needs SetBlendMode(BlendMode), BindShader(Shader*), BindTexture(Texture*) and
+	//BeginTransientVertexArray(int) / EndTransientVertexArray(int), each merged run is written straight into the backend's ring
+	template <typename BackendType>
+	RenderQueueStats Execute(BackendType* backend);
+
+	int GetNumPackets() const { return static_cast<int>(m_packets.size()); }
+	RenderQueueStats const& GetLastStats() const { return m_lastStats; }
+
+private:
+	int GetShaderID(Shader* shader);
+	int GetTextureID(Texture* texture);
+
+private:
+	std::vector<RenderPacket> m_packets;
+	std::vector<Vertex_PCU> m_vertexes;
+	std::vector<RenderSortEntry> m_sortEntries;
+	std::vector<RenderSortEntry> m_sortScratch;
+	std::vector<Shader*> m_shadersByID;
+	std::vector<Texture*> m_texturesByID;
+	bool m_isSorted = false;
+	RenderQueueStats m_lastStats;
+};
+
+//Backend that only counts what it is asked to do, for measuring a queue without a device
+class NullRenderBackend
+{
+public:
+	void SetBlendMode(BlendMode blendMode);
+	void BindShader(Shader* shader);
+	void BindTexture(Texture* texture);
+	void DrawVertexArray(int numVertexes, Vertex_PCU const* vertexes);
+	Vertex_PCU* BeginTransientVertexArray(int maxNumVertexes);
+	void EndTransientVertexArray(int numVertexes);
+
+public:
+	int m_numBlendModeCalls = 0;
+	int m_numShaderBinds = 0;
+	int m_numTextureBinds = 0;
+	int m_numDrawCalls = 0;
+	int m_numVertexesDrawn = 0;
+
+private:
+	std::vector<Vertex_PCU> m_transientVertexes;
+};
+
+template <typename BackendType>
+RenderQueueStats RenderQueue::Execute(BackendType* backend)
+{
+	if (!m_isSorted)
+	{
+		Sort();
+	}
+
+	RenderQueueStats stats;
+	stats.m_numPackets = static_cast<int>(m_packets.size());
+
+	int numEntries = static_cast<int>(m_sortEntries.size());
+	RenderPacket const* currentState = nullptr;
+	int runStartIndex = 0;
+	while (runStartIndex < numEntries)
+	{
+		RenderPacket const& runPacket = m_packets[m_sortEntries[runStartIndex].m_index];
+		if (currentState == nullptr || runPacket.m_blendMode != currentState->m_blendMode)
+		{
+			backend->SetBlendMode(runPacket.m_blendMode);
+			stats.m_numBlendChanges++;
+		}
+		if (currentState == nullptr || runPacket.m_shader != currentState->m_shader)
+		{
+			backend->BindShader(runPacket.m_shader);
+			stats.m_numShaderChanges++;
+		}
+		if (currentState == nullptr || runPacket.m_texture != currentState->m_texture)
+		{
+			backend->BindTexture(runPacket.m_texture);
+			stats.m_numTextureChanges++;
+		}
+		currentState = &runPacket;
+
+		//sorted packets with identical state become one draw
+		int runEndIndex = runStartIndex + 1;
+		int runNumVertexes = runPacket.m_numVertexes;
+		while (runEndIndex < numEntries)
+		{
+			RenderPacket const& packet = m_packets[m_sortEntries[runEndIndex].m_index];
+			if (packet.m_blendMode != runPacket.m_blendMode || packet.m_shader != runPacket.m_shader || packet.m_texture != runPacket.m_texture)
+				break;
+
+			runNumVertexes += packet.m_numVertexes;
+			runEndIndex++;
+		}
+
+		Vertex_PCU* runVertexes = backend->BeginTransientVertexArray(runNumVertexes);
+		for (int sortIndex = runStartIndex; sortIndex < runEndIndex; ++sortIndex)
+		{
+			RenderPacket const& packet = m_packets[m_sortEntries[sortIndex].m_index];
+			std::copy(m_vertexes.begin() + packet.m_firstVertex, m_vertexes.begin() + packet.m_firstVertex + packet.m_numVertexes, runVertexes);
+			runVertexes += packet.m_numVertexes;
+		}
+		backend->EndTransientVertexArray(runNumVertexes);
+		stats.m_numDraws++;
+
+		runStartIndex = runEndIndex;
+	}
+
+	m_lastStats = stats;
+	return stats;
+}
@@ -14,6 +14,8 @@
 #include "Engine/Core/FileUtils.hpp"
 #include "Engine/Renderer/DefaultShader.hpp"
 #include "Engine/Core/Image.hpp"
+#include "Engine/Core/CookedImage.hpp"
+#include "Engine/Core/ImageLoadJob.hpp"
 #include "Engine/Math/MathUtils.hpp"
 
 #include<vector>
@@ -126,3 +128,288 @@ std::string Renderer::GetNameForRasterizerMode(RasterizerMode const& rasterizerM
 	default: return "UNAMED_RASTERIZER_MODE";
 	}
 }
+
+//Textures
+//----------------------------------------------------------------------------------------------------------------------
+Texture* Renderer::CreateOrGetTextureFromFile(char const* imageFilePath)
+{
+	// See if we already have this texture previously loaded
+	TextureHandle handle = m_textureRegistry.Find(imageFilePath);
+	if (!handle.IsValid())
+	{
+		// Never seen this texture before!  Let's load it.
+		CreateTextureFromFile(imageFilePath);
+		handle = m_textureRegistry.Find(imageFilePath);
+	}
+	else if (m_textureRegistry.Get(handle)->IsLoading())
+	{
+		//an async load of the same file is in flight, sync callers expect the real texture back
+		WaitForTextureLoad(m_textureRegistry.Get(handle));
+	}
+
+	//raw pointer callers can't give a reference back, so the texture lives as long as the renderer
+	m_textureRegistry.Pin(handle);
+	return m_textureRegistry.Get(handle);
+}
+
+Texture* Renderer::GetTextureForFileName(char const* imageFilePath) const
+{
+	return m_textureRegistry.GetOrDefault(m_textureRegistry.Find(imageFilePath), nullptr);
+}
+
+Texture* Renderer::CreateTextureFromFile(char const* imageFilePath)
+{
+	if (m_config.m_cookedTextureFolder.empty())
+	{
+		Image fileImage(imageFilePath);
+		return CreateTextureFromImage(fileImage);
+	}
+
+	Image* fileImage = LoadImageThroughCookedCache(imageFilePath, m_config.m_cookedTextureFolder.c_str());
+	Texture* newTexture = CreateTextureFromImage(*fileImage);
+	delete(fileImage);
+	return newTexture;
+}
+
+Texture* Renderer::CreateTextureFromImage(Image const& image)
+{
+	Texture* newTexture = new Texture();
+	newTexture->m_name = image.GetImageFilePath();
+	CreateTextureResources(newTexture, image);
+	m_loadedTextures.push_back(newTexture);
+
+	//CPU built images may share a name, the first one keeps it like the old linear search did
+	if (!newTexture->m_name.empty() && !m_textureRegistry.Find(newTexture->m_name.c_str()).IsValid())
+	{
+		m_textureRegistry.Add(newTexture->m_name.c_str(), newTexture);
+	}
+	return newTexture;
+}
+
+TextureHandle Renderer::CreateOrGetTextureHandle(char const* imageFilePath)
+{
+	TextureHandle handle = m_textureRegistry.Find(imageFilePath);
+	if (handle.IsValid())
+	{
+		if (m_textureRegistry.Get(handle)->IsLoading())
+		{
+			WaitForTextureLoad(m_textureRegistry.Get(handle));
+		}
+		m_textureRegistry.AddReference(handle);
+		return handle;
+	}
+
+	//registered with the one reference this caller owns
+	CreateTextureFromFile(imageFilePath);
+	return m_textureRegistry.Find(imageFilePath);
+}
+
+Texture* Renderer::GetTexture(TextureHandle handle) const
+{
+	return m_textureRegistry.GetOrDefault(handle, nullptr);
+}
+
+void Renderer::ReleaseTexture(TextureHandle handle)
+{
+	m_textureRegistry.ReleaseReference(handle);
+}
+
+void Renderer::UnloadTexture(TextureHandle handle)
+{
+	Texture* texture = nullptr;
+	if (m_textureRegistry.Unload(handle, texture))
+	{
+		DestroyTexture(texture);
+	}
+}
+
+int Renderer::UnloadUnreferencedTextures()
+{
+	std::vector<TextureHandle> unreferencedTextures;
+	m_textureRegistry.GetUnreferenced(unreferencedTextures);
+	for (int textureNum = 0; textureNum < (int)unreferencedTextures.size(); ++textureNum)
+	{
+		UnloadTexture(unreferencedTextures[textureNum]);
+	}
+
+	return (int)unreferencedTextures.size();
+}
+
+//Async loads
+//----------------------------------------------------------------------------------------------------------------------
+TextureHandle Renderer::CreateOrGetTextureHandleAsync(char const* imageFilePath)
+{
+	TextureHandle handle = m_textureRegistry.Find(imageFilePath);
+	if (handle.IsValid())
+	{
+		m_textureRegistry.AddReference(handle);
+		return handle;
+	}
+
+	return QueueTextureLoad(imageFilePath);
+}
+
+Texture* Renderer::CreateOrGetTextureFromFileAsync(char const* imageFilePath)
+{
+	TextureHandle handle = m_textureRegistry.Find(imageFilePath);
+	if (!handle.IsValid())
+	{
+		handle = QueueTextureLoad(imageFilePath);
+	}
+
+	m_textureRegistry.Pin(handle);
+	return m_textureRegistry.Get(handle);
+}
+
+void Renderer::FinishAsyncTextureLoads()
+{
+	//with no workers nothing runs queued jobs but a waiting thread, so each poll runs one here or loads would never finish
+	if (m_config.m_jobSystem != nullptr && m_config.m_jobSystem->GetNumWorkers() == 0)
+	{
+		m_config.m_jobSystem->TryExecuteQueuedJob();
+	}
+
+	//backwards so the swap and pop in CompletePendingTextureLoad only moves loads already checked
+	for (int pendingLoadIndex = (int)m_pendingTextureLoads.size() - 1; pendingLoadIndex >= 0; --pendingLoadIndex)
+	{
+		if (m_pendingTextureLoads[pendingLoadIndex].m_job->IsFinished())
+		{
+			CompletePendingTextureLoad(pendingLoadIndex);
+		}
+	}
+}
+
+void Renderer::WaitForAsyncTextureLoads()
+{
+	while (!m_pendingTextureLoads.empty())
+	{
+		int lastLoadIndex = (int)m_pendingTextureLoads.size() - 1;
+		m_config.m_jobSystem->WaitForJob(m_pendingTextureLoads[lastLoadIndex].m_job);
+		CompletePendingTextureLoad(lastLoadIndex);
+	}
+}
+
+TextureHandle Renderer::QueueTextureLoad(char const* imageFilePath)
+{
+	if (m_config.m_jobSystem == nullptr)
+	{
+		CreateTextureFromFile(imageFilePath);
+		return m_textureRegistry.Find(imageFilePath);
+	}
+
+	Texture* placeholderTexture = new Texture();
+	placeholderTexture->m_dimensions = IntVec2(1, 1);
+	placeholderTexture->m_name = imageFilePath;
+	placeholderTexture->m_isLoading = true;
+	m_loadedTextures.push_back(placeholderTexture);
+
+	PendingTextureLoad pendingLoad;
+	pendingLoad.m_texture = placeholderTexture;
+	pendingLoad.m_job = new ImageLoadJob(imageFilePath, m_config.m_cookedTextureFolder);
+	m_pendingTextureLoads.push_back(pendingLoad);
+	m_config.m_jobSystem->QueueJob(pendingLoad.m_job);
+
+	//registered with the one reference this caller owns
+	return m_textureRegistry.Add(imageFilePath, placeholderTexture);
+}
+
+void Renderer::WaitForTextureLoad(Texture* texture)
+{
+	for (int pendingLoadIndex = 0; pendingLoadIndex < (int)m_pendingTextureLoads.size(); ++pendingLoadIndex)
+	{
+		if (m_pendingTextureLoads[pendingLoadIndex].m_texture == texture)
+		{
+			m_config.m_jobSystem->WaitForJob(m_pendingTextureLoads[pendingLoadIndex].m_job);
+			CompletePendingTextureLoad(pendingLoadIndex);
+			return;
+		}
+	}
+}
+
+void Renderer::CompletePendingTextureLoad(int pendingLoadIndex)
+{
+	PendingTextureLoad pendingLoad = m_pendingTextureLoads[pendingLoadIndex];
+	m_pendingTextureLoads[pendingLoadIndex] = m_pendingTextureLoads.back();
+	m_pendingTextureLoads.pop_back();
+
+	Image* loadedImage = pendingLoad.m_job->TakeImage();
+	CreateTextureResources(pendingLoad.m_texture, *loadedImage);
+	delete(loadedImage);
+	delete(pendingLoad.m_job);
+}
+
+void Renderer::CancelTextureLoad(Texture* texture)
+{
+	//a worker may still be decoding into the job, so it has to finish before the job can go
+	for (int pendingLoadIndex = 0; pendingLoadIndex < (int)m_pendingTextureLoads.size(); ++pendingLoadIndex)
+	{
+		if (m_pendingTextureLoads[pendingLoadIndex].m_texture == texture)
+		{
+			m_config.m_jobSystem->WaitForJob(m_pendingTextureLoads[pendingLoadIndex].m_job);
+			delete(m_pendingTextureLoads[pendingLoadIndex].m_job);
+			m_pendingTextureLoads[pendingLoadIndex] = m_pendingTextureLoads.back();
+			m_pendingTextureLoads.pop_back();
+			return;
+		}
+	}
+}
+
+void Renderer::DestroyTexture(Texture* texture)
+{
+	CancelTextureLoad(texture);
+
+	for (int textureIndex = 0; textureIndex < (int)m_loadedTextures.size(); ++textureIndex)
+	{
+		if (m_loadedTextures[textureIndex] == texture)
+		{
+			m_loadedTextures[textureIndex] = m_loadedTextures.back();
+			m_loadedTextures.pop_back();
+			break;
+		}
+	}
+
+	DestroyTextureResources(texture);
+	delete(texture);
+}
+
+void Renderer::DestroyTexturesAndFonts()
+{
+	for (int fontNum = 0; fontNum < (int)m_loadedFonts.size(); ++fontNum)
+	{
+		delete(m_loadedFonts[fontNum]);
+	}
+	m_loadedFonts.clear();
+
+	for (int textureNum = 0; textureNum < (int)m_loadedTextures.size(); ++textureNum)
+	{
+		DestroyTextureResources(m_loadedTextures[textureNum]);
+		delete(m_loadedTextures[textureNum]);
+	}
+	m_loadedTextures.clear();
+	m_textureRegistry.Clear();
+	m_fontRegistry.Clear();
+}
+
+//Bitmap Font
+//----------------------------------------------------------------------------------------------------------------------
+BitmapFont* Renderer::CreatOrGetBitMapFontFromFile(char const* bitmapFontFilePathWithNoExtension)
+{
+	BitmapFont* existingBitMapFont = GetBitMapFontForFileName(bitmapFontFilePathWithNoExtension);
+	if (existingBitMapFont)
+	{
+		return existingBitMapFont;
+	}
+
+	//#TODO: need to remove the adding file extension line
+	std::string textureFilePath = Stringf("%s.png", bitmapFontFilePathWithNoExtension);
+	Texture* newTexture = CreateOrGetTextureFromFile(textureFilePath.c_str());
+	BitmapFont* newBitMapFont = new BitmapFont(bitmapFontFilePathWithNoExtension, *newTexture, IntVec2(16, 16));
+	m_loadedFonts.push_back(newBitMapFont);
+	m_fontRegistry.Add(bitmapFontFilePathWithNoExtension, newBitMapFont);
+	return newBitMapFont;
+}
+
+BitmapFont* Renderer::GetBitMapFontForFileName(char const* bitmapFontFilePathWithNoExtension) const
+{
+	return m_fontRegistry.GetOrDefault(m_fontRegistry.Find(bitmapFontFilePathWithNoExtension), nullptr);
+}
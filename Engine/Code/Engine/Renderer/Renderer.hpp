@@ -1,6 +1,9 @@
+#pragma once
 #include "Engine/Core/Rgba8.hpp"
 #include "Engine/Renderer/Camera.hpp"
 #include "Engine/Math/Mat44.hpp"
+#include "Engine/Renderer/RenderQueue.hpp"
+#include "Engine/Renderer/Texture.hpp"
 #include "Game/EngineBuildPreferences.hpp"
 
 #include <vector>
@@ -8,10 +11,12 @@
 
 struct Vertex_PCU;
 class Window;
+class JobSystem;
 struct IntVec2;
 class Texture;
 class BitmapFont;
 class Image;
+class ImageLoadJob;
 
 #define DX_SAFE_RELEASE(dxObject)	\
 {									\
@@ -37,6 +42,9 @@ struct RendererConfig
 {
 	Window* m_window = nullptr;
 	RendererType m_renderingType = RendererType::DIRECTX_11;
+	unsigned int m_immediateRingSizeBytes = 4 * 1024 * 1024; //transient vertex ring, grows if a single draw doesn't fit
+	JobSystem* m_jobSystem = nullptr; //decodes async texture loads, without one they load immediately
+	std::string m_cookedTextureFolder; //texture files load through cooked images kept here, empty decodes every load
 };
 
 
@@ -44,6 +52,8 @@ enum class VertexType : int
 {
 	VERTEX_PCU,
 	VERTEX_PCUTBN,
+	VERTEX_PCU2D,	//DX11 only, see RendererDX11::DrawQuadArray2D
+	QUAD_INSTANCE_2D, //DX11 only, per instance data with no vertex buffer, see RendererDX11::DrawQuadInstances2D
 	COUNT
 };
 
@@ -187,9 +197,24 @@ public:
 	virtual void EndRendererEvent() = 0;
 
 	//Creation
-	virtual Texture* CreateOrGetTextureFromFile(char const* imageFilePath) = 0;
-	virtual BitmapFont* CreatOrGetBitMapFontFromFile(char const* bitmapFontFilePathWithNoExtension) = 0;
-
+	virtual Texture*	CreateOrGetTextureFromFile(char const* imageFilePath);
+	virtual BitmapFont* CreatOrGetBitMapFontFromFile(char const* bitmapFontFilePathWithNoExtension);
+	Texture*			CreateTextureFromImage(Image const& image); //public so CPU-built images (atlas pages) can be uploaded
+
+	//Handles, each CreateOrGet adds a reference. Textures from the raw pointer calls above are pinned and never unloaded as unreferenced
+	TextureHandle	CreateOrGetTextureHandle(char const* imageFilePath);
+	Texture*		GetTexture(TextureHandle handle) const; //nullptr once unloaded
+	void			ReleaseTexture(TextureHandle handle);
+	void			UnloadTexture(TextureHandle handle); //explicit, any pointer to it dangles afterwards
+	int				UnloadUnreferencedTextures();
+
+	//Async loads return at once with a 1x1 placeholder that binds as the default texture, the image decodes on
+	//the config's JobSystem and the real texture is created here on the render thread by FinishAsyncTextureLoads
+	TextureHandle	CreateOrGetTextureHandleAsync(char const* imageFilePath);
+	Texture*		CreateOrGetTextureFromFileAsync(char const* imageFilePath);
+	void			FinishAsyncTextureLoads(); //BeginFrame calls this, only picks up images that are already decoded
+	void			WaitForAsyncTextureLoads();
+	int				GetNumPendingTextureLoads() const { return (int)m_pendingTextureLoads.size(); }
 
 	//Binds
 	void BindTexture(Texture* texture, int slot = 0);
@@ -200,20 +225,50 @@ public:
 	virtual void SetColorAdjustmentConstants(ColorAdjustmentConstants const& colorAdjustmentConstants) = 0;
 	virtual void SetPerFrameConstants(PerFrameConstants const& perFrameConstants) = 0;
 
+	RendererConfig const& GetConfig() const { return m_config; }
+
+	//Sorted draw submission, see RenderQueue::Execute
+	RenderQueue& GetRenderQueue() { return m_renderQueue; }
+
 	std::string GetNameForBlendMode(BlendMode const& blendMode) const;
 	std::string GetNameForDepthMode(DepthMode const& depthMode) const;
 	std::string GetNameForRasterizerMode(RasterizerMode const& rasterizerMode) const;
 
-private:
+protected:
+	//Backend hooks, the texture registry only needs a backend to make and free a texture's device resources
+	virtual void	CreateTextureResources(Texture* texture, Image const& image) = 0; //also clears the texture's loading flag
+	virtual void	DestroyTextureResources(Texture* texture) = 0;
+
+	//Textures
+	Texture*		GetTextureForFileName(char const* imageFilePath) const;
+	Texture*		CreateTextureFromFile(char const* imageFilePath);
+	void			DestroyTexture(Texture* texture);
+	void			DestroyTexturesAndFonts(); //for Shutdown, once nothing on the device still uses them
 
+	//Async loads
+	TextureHandle	QueueTextureLoad(char const* imageFilePath);
+	void			WaitForTextureLoad(Texture* texture);
+	void			CompletePendingTextureLoad(int pendingLoadIndex);
+	void			CancelTextureLoad(Texture* texture); //waits out a decode still writing into the texture's job and drops it
 
-private:
-	//std::vector<Texture*> m_loadedTextures;
-	//std::vector<BitmapFont*> m_loadedFonts;
+	//BitMapFont
+	BitmapFont*		GetBitMapFontForFileName(char const* bitmapFontFilePathWithNoExtension) const;
 
 protected:
 	RendererConfig m_config;
-
+	RenderQueue m_renderQueue;
+
+	std::vector<Texture*> m_loadedTextures;
+	std::vector<BitmapFont*> m_loadedFonts;
+	AssetRegistry<Texture*> m_textureRegistry;
+	AssetRegistry<BitmapFont*> m_fontRegistry;
+
+	struct PendingTextureLoad
+	{
+		Texture* m_texture = nullptr;
+		ImageLoadJob* m_job = nullptr;
+	};
+	std::vector<PendingTextureLoad> m_pendingTextureLoads;
 
 #if defined(ENGINE_DEBUG_RENDERER)
 	void* m_dxgiDebug = nullptr;
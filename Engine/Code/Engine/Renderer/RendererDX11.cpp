@@ -2,6 +2,9 @@
 #include "Engine/Window/Window.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Core/Vertex_PCU2D.hpp"
+#include "Engine/Core/VertexUtils.hpp"
+#include "Engine/Core/QuadInstance2D.hpp"
 #include "Engine/Math/IntVec2.hpp"
 #include "Engine/Renderer/Texture.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"
@@ -72,10 +75,19 @@ void RendererDX11::Startup()
 	//Compile and create vertex and pixel shader
 	DefaultShader shaderDefault;
 	m_defaultShader = CreateShader("Default", shaderDefault.m_defaultShaderSource);
+	m_defaultShader2D = CreateShader("Default2D", shaderDefault.m_defaultShaderSource, VertexType::VERTEX_PCU2D);
+	m_quadInstanceShader2D = CreateShader("QuadInstance2D", shaderDefault.m_quadInstance2DShaderSource, VertexType::QUAD_INSTANCE_2D);
 	BindShader(m_defaultShader);
 
 	//Create Vertex buffer
-	m_immediateVBO = CreateVertexBuffer(sizeof(Vertex_PCU), sizeof(Vertex_PCU));
+	//D3D11 orphans the whole buffer on a discarding map, so wraps need no fences and nothing has to stay in flight
+	m_immediateVBO = CreateVertexBuffer(m_config.m_immediateRingSizeBytes, sizeof(Vertex_PCU));
+	m_immediateRing = FrameRingAllocator(m_config.m_immediateRingSizeBytes, 0);
+	m_immediateQuadVBO = CreateVertexBuffer(m_config.m_immediateRingSizeBytes, sizeof(Vertex_PCU2D));
+	m_immediateQuadRing = FrameRingAllocator(m_config.m_immediateRingSizeBytes, 0);
+	m_immediateInstanceVBO = CreateVertexBuffer(m_config.m_immediateRingSizeBytes, sizeof(QuadInstance2D));
+	m_immediateInstanceRing = FrameRingAllocator(m_config.m_immediateRingSizeBytes, 0);
+	CreateQuadIndexBuffer();
 
 	//Create constant Buffers
 	m_perFrameCBO = CreateConstantBuffer(sizeof(PerFrameConstants));
@@ -115,10 +127,16 @@ void RendererDX11::BeginFrame()
 {
 	//set render target view
 	m_deviceContext->OMSetRenderTargets(1, &m_renderTargetView, m_depthStencilDSV);
+
+	FinishAsyncTextureLoads();
 }
 
 void RendererDX11::EndFrame()
 {
+	m_immediateRing.EndFrame();
+	m_immediateQuadRing.EndFrame();
+	m_immediateInstanceRing.EndFrame();
+
 	//present
 	HRESULT hr;
 	hr = m_swapChain->Present(0, 0);
@@ -143,6 +161,8 @@ void RendererDX11::EndFrame()
 
 void RendererDX11::Shutdown()
 {
+	WaitForAsyncTextureLoads();
+
 	//release DirectX objects
 	DX_SAFE_RELEASE(m_device);
 	DX_SAFE_RELEASE(m_deviceContext);
@@ -155,6 +175,15 @@ void RendererDX11::Shutdown()
 	delete(m_immediateVBO);
 	m_immediateVBO = nullptr;
 
+	delete(m_immediateQuadVBO);
+	m_immediateQuadVBO = nullptr;
+
+	delete(m_immediateInstanceVBO);
+	m_immediateInstanceVBO = nullptr;
+
+	delete(m_quadIndexBuffer);
+	m_quadIndexBuffer = nullptr;
+
 	delete(m_cameraCBO);
 	m_cameraCBO = nullptr;
 
@@ -196,14 +225,7 @@ void RendererDX11::Shutdown()
 		DX_SAFE_RELEASE(m_depthStencilStates[depthStencilNum]);
 	}
 
-	for (int textureNum = 0; textureNum < (int)m_loadedTextures.size(); ++textureNum)
-	{
-		Texture*& currentTexture = m_loadedTextures[textureNum];
-		DX_SAFE_RELEASE(currentTexture->m_texture);
-		DX_SAFE_RELEASE(currentTexture->m_shaderResourceView);
-		delete(currentTexture);
-		currentTexture = nullptr;
-	}
+	DestroyTexturesAndFonts();
 
 
 	//report error leaks and release debug module
@@ -299,17 +321,144 @@ void RendererDX11::EndRendererEvent()
 
 void RendererDX11::DrawVertexArray(int numVertexes, const Vertex_PCU* vertexes)
 {
-	unsigned int unsignedNumVertexes = (unsigned int)numVertexes;
-	unsigned int size = unsignedNumVertexes * (unsigned int)sizeof(Vertex_PCU);
-	CopyCPUToGPU(vertexes, size, m_immediateVBO);
-	DrawVertexBuffer(m_immediateVBO, unsignedNumVertexes);
+	if (numVertexes <= 0)
+		return;
+
+	Vertex_PCU* ringVertexes = BeginTransientVertexArray(numVertexes);
+	memcpy(ringVertexes, vertexes, (size_t)numVertexes * sizeof(Vertex_PCU));
+	EndTransientVertexArray(numVertexes);
 }
 
-void RendererDX11::DrawVertexArray(const std::vector<Vertex_PCU> verts)
+void RendererDX11::DrawVertexArray(std::vector<Vertex_PCU> const& verts)
 {
 	DrawVertexArray((int)(verts.size()), verts.data());
 }
 
+Vertex_PCU* RendererDX11::BeginTransientVertexArray(int maxNumVertexes)
+{
+	GUARANTEE_OR_DIE(!m_isWritingTransientVerts, "BeginTransientVertexArray called again before EndTransientVertexArray");
+	GUARANTEE_OR_DIE(maxNumVertexes > 0, "BeginTransientVertexArray needs at least one vertex");
+
+	unsigned int numBytes = (unsigned int)maxNumVertexes * (unsigned int)sizeof(Vertex_PCU);
+	void* ringData = MapImmediateRing(m_immediateVBO, m_immediateRing, numBytes, sizeof(Vertex_PCU), m_transientAllocation);
+	m_isWritingTransientVerts = true;
+	return static_cast<Vertex_PCU*>(ringData);
+}
+
+void RendererDX11::EndTransientVertexArray(int numVertexes)
+{
+	GUARANTEE_OR_DIE(m_isWritingTransientVerts, "EndTransientVertexArray called without BeginTransientVertexArray");
+	m_deviceContext->Unmap(m_immediateVBO->m_buffer, 0);
+	m_isWritingTransientVerts = false;
+
+	unsigned int numBytes = (unsigned int)numVertexes * (unsigned int)sizeof(Vertex_PCU);
+	m_immediateRing.TrimLastAllocation(numBytes);
+	if (numVertexes <= 0)
+		return;
+
+	BindVertexBuffer(m_immediateVBO);
+	SetStatesIfChanged();
+	m_deviceContext->Draw((UINT)numVertexes, m_transientAllocation.m_offset / (unsigned int)sizeof(Vertex_PCU));
+}
+
+void* RendererDX11::MapImmediateRing(VertexBuffer* vbo, FrameRingAllocator& ring, unsigned int numBytes, unsigned int stride, FrameRingAllocation& out_allocation)
+{
+	if (numBytes > ring.GetCapacity())
+	{
+		unsigned int newCapacity = ring.GetCapacity() * 2;
+		newCapacity = (newCapacity < numBytes) ? numBytes : newCapacity;
+		vbo->Resize(newCapacity);
+		ring.Resize(newCapacity);
+	}
+
+	if (!ring.Allocate(numBytes, stride, out_allocation))
+	{
+		ring.Reset();
+		ring.Allocate(numBytes, stride, out_allocation);
+	}
+
+	//ranges past the head were never handed to the GPU since the last discard, so they can be written without a stall
+	D3D11_MAP mapType = out_allocation.m_didWrap ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+	D3D11_MAPPED_SUBRESOURCE resource;
+	HRESULT hr = m_deviceContext->Map(vbo->m_buffer, 0, mapType, 0, &resource);
+	if (!SUCCEEDED(hr))
+	{
+		ERROR_AND_DIE("Could not map an immediate vertex ring");
+	}
+
+	return static_cast<unsigned char*>(resource.pData) + out_allocation.m_offset;
+}
+
+void RendererDX11::DrawQuadArray2D(int numVertexes, Vertex_PCU2D const* vertexes)
+{
+	if (numVertexes < NUM_VERTS_PER_QUAD_2D)
+		return;
+
+	unsigned int numBytes = (unsigned int)numVertexes * (unsigned int)sizeof(Vertex_PCU2D);
+	FrameRingAllocation allocation;
+	void* ringData = MapImmediateRing(m_immediateQuadVBO, m_immediateQuadRing, numBytes, sizeof(Vertex_PCU2D), allocation);
+	memcpy(ringData, vertexes, numBytes);
+	m_deviceContext->Unmap(m_immediateQuadVBO->m_buffer, 0);
+
+	DrawIndexedQuads2D(m_immediateQuadVBO, allocation.m_offset / (unsigned int)sizeof(Vertex_PCU2D), (unsigned int)numVertexes);
+}
+
+void RendererDX11::DrawQuadArray2D(std::vector<Vertex_PCU2D> const& verts)
+{
+	DrawQuadArray2D((int)verts.size(), verts.data());
+}
+
+void RendererDX11::DrawQuadVertexBuffer2D(VertexBuffer* vbo, unsigned int vertexCount, unsigned int firstVertex)
+{
+	DrawIndexedQuads2D(vbo, firstVertex, vertexCount);
+}
+
+void RendererDX11::DrawQuadInstances2D(int numInstances, QuadInstance2D const* instances)
+{
+	if (numInstances <= 0)
+		return;
+
+	unsigned int numBytes = (unsigned int)numInstances * (unsigned int)sizeof(QuadInstance2D);
+	FrameRingAllocation allocation;
+	void* ringData = MapImmediateRing(m_immediateInstanceVBO, m_immediateInstanceRing, numBytes, sizeof(QuadInstance2D), allocation);
+	memcpy(ringData, instances, numBytes);
+	m_deviceContext->Unmap(m_immediateInstanceVBO->m_buffer, 0);
+
+	//the first 6 shared quad indexes are 0 1 2, 0 2 3, the corner numbers the instanced shader expects
+	BindVertexBuffer(m_immediateInstanceVBO);
+	BindIndexBuffer(m_quadIndexBuffer);
+	SetStatesIfChanged(VertexType::QUAD_INSTANCE_2D);
+	m_deviceContext->DrawIndexedInstanced(NUM_INDEXES_PER_QUAD_2D, (UINT)numInstances, 0, 0, allocation.m_offset / (unsigned int)sizeof(QuadInstance2D));
+}
+
+void RendererDX11::DrawQuadInstances2D(std::vector<QuadInstance2D> const& instances)
+{
+	DrawQuadInstances2D((int)instances.size(), instances.data());
+}
+
+void RendererDX11::DrawIndexedQuads2D(VertexBuffer* vbo, unsigned int firstVertex, unsigned int vertexCount)
+{
+	BindVertexBuffer(vbo);
+	BindIndexBuffer(m_quadIndexBuffer);
+	SetStatesIfChanged(VertexType::VERTEX_PCU2D);
+
+	unsigned int numQuads = vertexCount / NUM_VERTS_PER_QUAD_2D;
+	for (unsigned int firstQuad = 0; firstQuad < numQuads; firstQuad += MAX_QUADS_PER_INDEXED_DRAW)
+	{
+		unsigned int numQuadsThisDraw = (numQuads - firstQuad < MAX_QUADS_PER_INDEXED_DRAW) ? numQuads - firstQuad : MAX_QUADS_PER_INDEXED_DRAW;
+		m_deviceContext->DrawIndexed(numQuadsThisDraw * NUM_INDEXES_PER_QUAD_2D, 0, (INT)(firstVertex + firstQuad * NUM_VERTS_PER_QUAD_2D));
+	}
+}
+
+void RendererDX11::CreateQuadIndexBuffer()
+{
+	std::vector<unsigned int> quadIndexes;
+	AddIndexesForQuads2D(quadIndexes, MAX_QUADS_PER_INDEXED_DRAW);
+	unsigned int size = (unsigned int)(quadIndexes.size() * sizeof(unsigned int));
+	m_quadIndexBuffer = CreateIndexBuffer(size);
+	CopyCPUToGPU(quadIndexes.data(), size, m_quadIndexBuffer);
+}
+
 void RendererDX11::DrawVertexBuffer(VertexBuffer* vbo, unsigned int vertexCount)
 {
 	BindVertexBuffer(vbo);
@@ -348,8 +497,27 @@ void RendererDX11::SetDepthMode(DepthMode depthMode)
 	m_desiredDepthMode = depthMode;
 }
 
-void RendererDX11::SetStatesIfChanged()
+void RendererDX11::SetStatesIfChanged(VertexType vertexType)
 {
+	//Vertex_PCU2D and QuadInstance2D each have one built in shader
+	Shader* shader = m_currentShader;
+	if (vertexType == VertexType::VERTEX_PCU2D)
+	{
+		shader = m_defaultShader2D;
+	}
+	else if (vertexType == VertexType::QUAD_INSTANCE_2D)
+	{
+		shader = m_quadInstanceShader2D;
+	}
+
+	if (shader != m_boundShader)
+	{
+		m_boundShader = shader;
+		m_deviceContext->VSSetShader(shader->m_vertexShader, nullptr, 0);
+		m_deviceContext->PSSetShader(shader->m_pixelShader, nullptr, 0);
+		m_deviceContext->IASetInputLayout(shader->m_inputLayout);
+	}
+
 	if (m_blendStates[(int)m_desiredBlendMode] != m_blendState)
 	{
 		m_blendState = m_blendStates[(int)m_desiredBlendMode];
@@ -383,44 +551,9 @@ void RendererDX11::SetStatesIfChanged()
 //Textures
 //----------------------------------------------------------------------------------------------------------------------
 
-Texture* RendererDX11::CreateOrGetTextureFromFile(char const* imageFilePath)
+void RendererDX11::CreateTextureResources(Texture* texture, Image const& image)
 {
-	// See if we already have this texture previously loaded
-	Texture* existingTexture = GetTextureForFileName(imageFilePath);
-	if (existingTexture)
-	{
-		return existingTexture;
-	}
-
-	// Never seen this texture before!  Let's load it.
-	Texture* newTexture = CreateTextureFromFile(imageFilePath);
-	return newTexture;
-}
-
-Texture* RendererDX11::GetTextureForFileName(char const* imageFilePath) const
-{
-	for (int textureIndex = 0; textureIndex < (int)(m_loadedTextures.size()); ++textureIndex)
-	{
-		if (m_loadedTextures[textureIndex]->m_name == static_cast<std::string>(imageFilePath))
-		{
-			return m_loadedTextures[textureIndex];
-		}
-	}
-
-	return nullptr;
-}
-
-Texture* RendererDX11::CreateTextureFromFile(char const* imageFilePath)
-{
-	Image fileImage(imageFilePath);
-	return CreateTextureFromImage(fileImage);
-}
-
-Texture* RendererDX11::CreateTextureFromImage(Image const& image)
-{
-	Texture* newTexture = new Texture();
-	newTexture->m_dimensions = image.GetDimensions();
-	newTexture->m_name = image.GetImageFilePath();
+	texture->m_dimensions = image.GetDimensions();
 
 	D3D11_TEXTURE2D_DESC textureDesc = {};
 	textureDesc.Width = image.GetDimensions().x;
@@ -436,26 +569,31 @@ Texture* RendererDX11::CreateTextureFromImage(Image const& image)
 	textureData.pSysMem = image.GetRawData();
 	textureData.SysMemPitch = 4 * image.GetDimensions().x;
 
-	HRESULT hr = m_device->CreateTexture2D(&textureDesc, &textureData, &newTexture->m_texture);
+	HRESULT hr = m_device->CreateTexture2D(&textureDesc, &textureData, &texture->m_texture);
 
 	if (!SUCCEEDED(hr))
 	{
 		ERROR_AND_DIE(Stringf("CreateTextureFromImage failed for image file: \"%s\"", image.GetImageFilePath().c_str()));
 	}
 
-	hr = m_device->CreateShaderResourceView(newTexture->m_texture, NULL, &newTexture->m_shaderResourceView);
+	hr = m_device->CreateShaderResourceView(texture->m_texture, NULL, &texture->m_shaderResourceView);
 	if (!SUCCEEDED(hr))
 	{
 		ERROR_AND_DIE(Stringf("CreateShaderResourceView failed for image file: \"%s\"", image.GetImageFilePath().c_str()));
 	}
+	texture->m_isLoading = false;
+}
 
-	m_loadedTextures.push_back(newTexture);
-	return newTexture;
+void RendererDX11::DestroyTextureResources(Texture* texture)
+{
+	DX_SAFE_RELEASE(texture->m_texture);
+	DX_SAFE_RELEASE(texture->m_shaderResourceView);
 }
 
 void RendererDX11::BindTexture(Texture* texture, int slot)
 {
-	if (texture == nullptr)
+	//async loads have no view until their image is decoded
+	if (texture == nullptr || texture->m_shaderResourceView == nullptr)
 	{
 		if (m_defaultTexturesBySlot[slot])
 		{
@@ -475,39 +613,6 @@ void RendererDX11::BindTexture(Texture* texture, int slot)
 }
 
 
-//Bitmap Font
-//----------------------------------------------------------------------------------------------------------------------
-
-BitmapFont* RendererDX11::CreatOrGetBitMapFontFromFile(char const* bitmapFontFilePathWithNoExtension)
-{
-	BitmapFont* existingBitMapFont = GetBitMapFontForFileName(bitmapFontFilePathWithNoExtension);
-	if (existingBitMapFont)
-	{
-		return existingBitMapFont;
-	}
-
-	//#TODO: need to remove the adding file extension line
-	std::string textureFilePath = Stringf("%s.png", bitmapFontFilePathWithNoExtension);
-	Texture* newTexture = CreateOrGetTextureFromFile(textureFilePath.c_str());
-	BitmapFont* newBitMapFont = new BitmapFont(bitmapFontFilePathWithNoExtension, *newTexture, IntVec2(16, 16));
-	m_loadedFonts.push_back(newBitMapFont);
-	return newBitMapFont;
-}
-
-
-BitmapFont* RendererDX11::GetBitMapFontForFileName(char const* bitmapFontFilePathWithNoExtension) const
-{
-	for (int fontIndex = 0; fontIndex < (int)(m_loadedFonts.size()); ++fontIndex)
-	{
-		if (m_loadedFonts[fontIndex]->m_fontFilePathNameWithNoExtension == static_cast<std::string>(bitmapFontFilePathWithNoExtension))
-		{
-			return m_loadedFonts[fontIndex];
-		}
-	}
-
-	return nullptr;
-}
-
 //Shaders
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -582,6 +687,29 @@ Shader* RendererDX11::CreateShader(char const* shaderName, char const* shaderSou
 		0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA,0},
 	};
 
+	//position z and w default to 0 and 1 when the float3 shader input reads a two component format
+	D3D11_INPUT_ELEMENT_DESC inputElementDescVerts_PCU2D[] = {
+		{"POSITION", 0, DXGI_FORMAT_R32G32_FLOAT,
+		0,0, D3D11_INPUT_PER_VERTEX_DATA,0},
+		{"COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM,
+		0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA,0},
+		{"TEXCOORD",0, DXGI_FORMAT_R16G16_UNORM,
+		0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA,0},
+	};
+
+	D3D11_INPUT_ELEMENT_DESC inputElementDescQuadInstance2D[] = {
+		{"INSTANCE_POSITION", 0, DXGI_FORMAT_R32G32_FLOAT,
+		0,0, D3D11_INPUT_PER_INSTANCE_DATA,1},
+		{"INSTANCE_IBASIS", 0, DXGI_FORMAT_R32G32_FLOAT,
+		0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA,1},
+		{"INSTANCE_BOUNDS", 0, DXGI_FORMAT_R32G32B32A32_FLOAT,
+		0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA,1},
+		{"INSTANCE_UVS", 0, DXGI_FORMAT_R32G32B32A32_FLOAT,
+		0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA,1},
+		{"COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM,
+		0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA,1},
+	};
+
 	D3D11_INPUT_ELEMENT_DESC inputElementDescVerts_PCUTBN[] = {
 		{"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT,
 		0,0, D3D11_INPUT_PER_VERTEX_DATA,0},
@@ -629,6 +757,34 @@ Shader* RendererDX11::CreateShader(char const* shaderName, char const* shaderSou
 		}
 		break;
 
+	case VertexType::VERTEX_PCU2D:
+		numElements = ARRAYSIZE(inputElementDescVerts_PCU2D);
+		hr = m_device->CreateInputLayout(
+			inputElementDescVerts_PCU2D, numElements,
+			vertexShaderByteCode.data(),
+			vertexShaderByteCode.size(),
+			&newShader->m_inputLayout
+		);
+		if (!SUCCEEDED(hr))
+		{
+			ERROR_AND_DIE("Could not create vertex layout for Vertex_PCU2D");
+		}
+		break;
+
+	case VertexType::QUAD_INSTANCE_2D:
+		numElements = ARRAYSIZE(inputElementDescQuadInstance2D);
+		hr = m_device->CreateInputLayout(
+			inputElementDescQuadInstance2D, numElements,
+			vertexShaderByteCode.data(),
+			vertexShaderByteCode.size(),
+			&newShader->m_inputLayout
+		);
+		if (!SUCCEEDED(hr))
+		{
+			ERROR_AND_DIE("Could not create input layout for QuadInstance2D");
+		}
+		break;
+
 	default:
 		ERROR_AND_DIE("Vertex type was not set to supported type");
 		break;
@@ -650,14 +806,8 @@ Shader* RendererDX11::CreateShader(char const* shaderName, VertexType vertexType
 
 void RendererDX11::BindShader(Shader* shader)
 {
-	if (shader == nullptr)
-	{
-		shader = m_defaultShader;
-	}
-
-	m_deviceContext->VSSetShader(shader->m_vertexShader, nullptr, 0);
-	m_deviceContext->PSSetShader(shader->m_pixelShader, nullptr, 0);
-	m_deviceContext->IASetInputLayout(shader->m_inputLayout);
+	//applied by SetStatesIfChanged() at the next draw, like the blend and rasterizer modes
+	m_currentShader = (shader == nullptr) ? m_defaultShader : shader;
 }
 
 //Buffers
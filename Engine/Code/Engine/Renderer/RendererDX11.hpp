@@ -1,12 +1,16 @@
+#pragma once
 #include "Engine/Core/Rgba8.hpp"
 #include "Engine/Renderer/Camera.hpp"
 #include "Engine/Math/Mat44.hpp"
 #include "Engine/Renderer/Renderer.hpp"
+#include "Engine/Renderer/FrameRingAllocator.hpp"
 
 #include "Game/EngineBuildPreferences.hpp"
 #include <vector>
 
 struct Vertex_PCU;
+struct Vertex_PCU2D;
+struct QuadInstance2D;
 class Window;
 struct IntVec2;
 class Texture;
@@ -30,6 +34,8 @@ struct ID3D11DepthStencilView;
 struct ID3D11DepthStencilState;
 
 
+constexpr unsigned int MAX_QUADS_PER_INDEXED_DRAW = 16384; //bigger quad draws are split, each part offsets its base vertex
+
 class RendererDX11 : public Renderer
 {
 public:
@@ -51,7 +57,20 @@ public:
 
 	//Draw
 	void		DrawVertexArray(int numVertexes, const Vertex_PCU* vertexes);
-	void		DrawVertexArray(const std::vector<Vertex_PCU> verts);
+	void		DrawVertexArray(std::vector<Vertex_PCU> const& verts);
+
+	//Write up to maxNumVertexes straight into the immediate ring, then End draws the ones actually written. No other draws in between
+	Vertex_PCU*	BeginTransientVertexArray(int maxNumVertexes);
+	void		EndTransientVertexArray(int numVertexes);
+
+	//2D quads, 4 Vertex_PCU2D each (see AddVertsForAABB2D), drawn through the shared quad index buffer with the default shader
+	void		DrawQuadArray2D(int numVertexes, Vertex_PCU2D const* vertexes);
+	void		DrawQuadArray2D(std::vector<Vertex_PCU2D> const& verts);
+	void		DrawQuadVertexBuffer2D(VertexBuffer* vbo, unsigned int vertexCount, unsigned int firstVertex = 0);
+
+	//One instance record per quad, corners are expanded in the vertex shader. Uses the bound texture, blend and sampler modes
+	void		DrawQuadInstances2D(int numInstances, QuadInstance2D const* instances);
+	void		DrawQuadInstances2D(std::vector<QuadInstance2D> const& instances);
 	void		DrawVertexBuffer(VertexBuffer* vbo, unsigned int vertexCount);
 
 	void		DrawIndexedVertexBuffer(VertexBuffer* vbo, IndexBuffer* ibo, unsigned int indexedCount);
@@ -61,10 +80,7 @@ public:
 	void		SetRasterizerMode(RasterizerMode rasterizerMode);
 	void		SetDepthMode(DepthMode depthMode);
 
-	//Creation
-	virtual Texture*	CreateOrGetTextureFromFile(char const* imageFilePath) override;
-	virtual BitmapFont* CreatOrGetBitMapFontFromFile(char const* bitmapFontFilePathWithNoExtension) override;
-
+	//Creation, the texture and font registry and async loads are Renderer's
 	Shader*			CreateOrGetShaderFromFile(char const* shaderName, VertexType vertexType = VertexType::VERTEX_PCU);
 	Shader*			CreateShader(char const* shaderName, char const* shaderSource, VertexType vertexType = VertexType::VERTEX_PCU);
 	Shader*			CreateShader(char const* shaderName, VertexType vertexType = VertexType::VERTEX_PCU);
@@ -92,17 +108,15 @@ public:
 	virtual void	SetColorAdjustmentConstants(ColorAdjustmentConstants const& colorAdjustmentConstants) override;
 	virtual void	SetPerFrameConstants(PerFrameConstants const& perFrameConstants) override;
 
-private:
-
-	//Textures
-	Texture*		GetTextureForFileName(char const* imageFilePath) const;
-	Texture*		CreateTextureFromFile(char const* imageFilePath);
-	Texture*		CreateTextureFromImage(Image const& image);
-
-	//BitMapFont
-	BitmapFont*		GetBitMapFontForFileName(char const* bitmapFontFilePathWithNoExtension) const;
+protected:
+	virtual void	CreateTextureResources(Texture* texture, Image const& image) override;
+	virtual void	DestroyTextureResources(Texture* texture) override;
 
-	void			SetStatesIfChanged();
+private:
+	void			SetStatesIfChanged(VertexType vertexType = VertexType::VERTEX_PCU);
+	void*			MapImmediateRing(VertexBuffer* vbo, FrameRingAllocator& ring, unsigned int numBytes, unsigned int stride, FrameRingAllocation& out_allocation);
+	void			DrawIndexedQuads2D(VertexBuffer* vbo, unsigned int firstVertex, unsigned int vertexCount);
+	void			CreateQuadIndexBuffer();
 
 	//Start up Process
 	void			CreateDeviceAndSwapChain();
@@ -112,10 +126,6 @@ private:
 	void			CreateSamplerModes();
 	void			CreateDepthStencil();
 
-private:
-	std::vector<Texture*> m_loadedTextures;
-	std::vector<BitmapFont*> m_loadedFonts;
-
 protected:
 	//DX objects
 	ID3D11RenderTargetView* m_renderTargetView = nullptr;
@@ -125,14 +135,25 @@ protected:
 
 	//Shaders
 	std::vector<Shader*> m_loadedShaders;
-	Shader* m_currentShader = nullptr;
+	Shader* m_currentShader = nullptr;	//bound at the next draw
+	Shader* m_boundShader = nullptr;
 	Shader* m_defaultShader = nullptr;
+	Shader* m_defaultShader2D = nullptr;	//same source as m_defaultShader with the Vertex_PCU2D input layout
+	Shader* m_quadInstanceShader2D = nullptr;
 
 	//Textures
 	Texture const* m_defaultTexturesBySlot[NUM_TEXTURE_DATA] = {};
 
 	//Buffers
 	VertexBuffer* m_immediateVBO = nullptr;
+	FrameRingAllocator m_immediateRing;
+	FrameRingAllocation m_transientAllocation;
+	bool m_isWritingTransientVerts = false;
+	VertexBuffer* m_immediateQuadVBO = nullptr;
+	FrameRingAllocator m_immediateQuadRing;
+	VertexBuffer* m_immediateInstanceVBO = nullptr;
+	FrameRingAllocator m_immediateInstanceRing;
+	IndexBuffer* m_quadIndexBuffer = nullptr;	//0 1 2, 0 2 3 for MAX_QUADS_PER_INDEXED_DRAW quads, never rewritten
 	ConstantBuffer* m_perFrameCBO = nullptr;
 	ConstantBuffer* m_cameraCBO = nullptr;
 	ConstantBuffer* m_modelCBO = nullptr;
@@ -925,6 +925,17 @@ BitmapFont* RendererDX12::CreatOrGetBitMapFontFromFile(char const* bitmapFontFil
 	return nullptr;
 }
 
+void RendererDX12::CreateTextureResources(Texture* texture, Image const& image)
+{
+	UNUSED(texture);
+	UNUSED(image);
+}
+
+void RendererDX12::DestroyTextureResources(Texture* texture)
+{
+	UNUSED(texture);
+}
+
 VertexBufferDX12* RendererDX12::CreateVertexBuffer(Verts const& verts, std::string const& name)
 {
 	VertexBufferDX12* newVertexBuffer = new VertexBufferDX12(this, name);
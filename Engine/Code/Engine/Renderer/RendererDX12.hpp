@@ -95,6 +95,11 @@ public:
 	void					UpdateBufferResource(ID3D12GraphicsCommandList2* commandList, ID3D12Resource** pDestinationResource, ID3D12Resource** pIntermediateResource, 
 								size_t numElements, size_t elementSize, const void* bufferData, D3D12_RESOURCE_FLAGS flags = D3D12_RESOURCE_FLAG_NONE);
 	*/
+protected:
+	//textures are not implemented on DX12 yet, the creation calls above return nullptr
+	virtual void	CreateTextureResources(Texture* texture, Image const& image) override;
+	virtual void	DestroyTextureResources(Texture* texture) override;
+
 private:
 	ID3D12Device2*			CreateDevice(IDXGIAdapter4* adapter);
 	IDXGIAdapter4*			GetAdapter(bool useWarp);
@@ -0,0 +1,332 @@
+#include "Engine/Renderer/RendererNull.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Core/Vertex_PCU2D.hpp"
+#include "Engine/Core/VertexUtils.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Core/Image.hpp"
+#include "Engine/Renderer/Texture.hpp"
+#include "Engine/Renderer/BitmapFont.hpp"
+#include "Engine/Renderer/Shader.hpp"
+#include "Engine/Renderer/VertexBuffer.hpp"
+
+//Stats
+//----------------------------------------------------------------------------------------------------------------------
+void RendererNullStats::Add(RendererNullStats const& stats)
+{
+	m_numDrawCalls += stats.m_numDrawCalls;
+	m_numVertexesDrawn += stats.m_numVertexesDrawn;
+	m_numBytesUploaded += stats.m_numBytesUploaded;
+	m_numBlendModeChanges += stats.m_numBlendModeChanges;
+	m_numRasterizerModeChanges += stats.m_numRasterizerModeChanges;
+	m_numTextureBinds += stats.m_numTextureBinds;
+	m_numShaderBinds += stats.m_numShaderBinds;
+	m_numCameras += stats.m_numCameras;
+	m_numRingResets += stats.m_numRingResets;
+}
+
+RendererNull::RendererNull(RendererConfig const& config)
+	:Renderer(config)
+{
+}
+
+void RendererNull::Startup()
+{
+	ResetStats();
+	m_immediateRingMemory.resize(m_config.m_immediateRingSizeBytes);
+	m_immediateRing = FrameRingAllocator(m_config.m_immediateRingSizeBytes, 0);
+}
+
+void RendererNull::BeginFrame()
+{
+	m_currentFrameStats = RendererNullStats();
+	FinishAsyncTextureLoads();
+}
+
+void RendererNull::EndFrame()
+{
+	m_immediateRing.EndFrame();
+	m_lastFrameStats = m_currentFrameStats;
+	m_totalStats.Add(m_currentFrameStats);
+	m_numFrames++;
+}
+
+void RendererNull::Shutdown()
+{
+	WaitForAsyncTextureLoads();
+
+	DestroyTexturesAndFonts();
+
+	for (int shaderNum = 0; shaderNum < (int)m_loadedShaders.size(); ++shaderNum)
+	{
+		delete(m_loadedShaders[shaderNum]);
+	}
+	m_loadedShaders.clear();
+}
+
+void RendererNull::ResetStats()
+{
+	m_currentFrameStats = RendererNullStats();
+	m_lastFrameStats = RendererNullStats();
+	m_totalStats = RendererNullStats();
+	m_numFrames = 0;
+}
+
+void RendererNull::ClearScreen(const Rgba8& clearColor)
+{
+	UNUSED(clearColor);
+}
+
+void RendererNull::BeginCamera(const Camera& camera)
+{
+	UNUSED(camera);
+	m_currentFrameStats.m_numCameras++;
+	m_currentFrameStats.m_numBytesUploaded += sizeof(CameraConstants);
+}
+
+void RendererNull::EndCamera(const Camera& camera)
+{
+	UNUSED(camera);
+}
+
+void RendererNull::BeginRendererEvent(char const* eventName)
+{
+	UNUSED(eventName);
+}
+
+void RendererNull::EndRendererEvent()
+{
+}
+
+//Draw
+//----------------------------------------------------------------------------------------------------------------------
+void RendererNull::DrawVertexArray(int numVertexes, const Vertex_PCU* vertexes)
+{
+	if (numVertexes <= 0)
+		return;
+
+	//same single copy into the ring as the DX11 path so the CPU cost matches
+	Vertex_PCU* ringVertexes = BeginTransientVertexArray(numVertexes);
+	memcpy(ringVertexes, vertexes, (size_t)numVertexes * sizeof(Vertex_PCU));
+	EndTransientVertexArray(numVertexes);
+}
+
+void RendererNull::DrawVertexArray(std::vector<Vertex_PCU> const& verts)
+{
+	DrawVertexArray((int)verts.size(), verts.data());
+}
+
+Vertex_PCU* RendererNull::BeginTransientVertexArray(int maxNumVertexes)
+{
+	GUARANTEE_OR_DIE(!m_isWritingTransientVerts, "BeginTransientVertexArray called again before EndTransientVertexArray");
+	GUARANTEE_OR_DIE(maxNumVertexes > 0, "BeginTransientVertexArray needs at least one vertex");
+
+	unsigned int numBytes = (unsigned int)maxNumVertexes * (unsigned int)sizeof(Vertex_PCU);
+	if (numBytes > m_immediateRing.GetCapacity())
+	{
+		unsigned int newCapacity = m_immediateRing.GetCapacity() * 2;
+		newCapacity = (newCapacity < numBytes) ? numBytes : newCapacity;
+		m_immediateRingMemory.resize(newCapacity);
+		m_immediateRing.Resize(newCapacity);
+	}
+
+	if (!m_immediateRing.Allocate(numBytes, sizeof(Vertex_PCU), m_transientAllocation))
+	{
+		m_immediateRing.Reset();
+		m_immediateRing.Allocate(numBytes, sizeof(Vertex_PCU), m_transientAllocation);
+		m_currentFrameStats.m_numRingResets++;
+	}
+
+	m_isWritingTransientVerts = true;
+	return reinterpret_cast<Vertex_PCU*>(m_immediateRingMemory.data() + m_transientAllocation.m_offset);
+}
+
+void RendererNull::EndTransientVertexArray(int numVertexes)
+{
+	GUARANTEE_OR_DIE(m_isWritingTransientVerts, "EndTransientVertexArray called without BeginTransientVertexArray");
+	m_isWritingTransientVerts = false;
+
+	m_immediateRing.TrimLastAllocation((unsigned int)numVertexes * (unsigned int)sizeof(Vertex_PCU));
+	if (numVertexes <= 0)
+		return;
+
+	m_currentFrameStats.m_numBytesUploaded += (uint64_t)numVertexes * sizeof(Vertex_PCU);
+	m_currentFrameStats.m_numDrawCalls++;
+	m_currentFrameStats.m_numVertexesDrawn += numVertexes;
+}
+
+void RendererNull::DrawVertexBuffer(VertexBuffer* vbo, unsigned int vertexCount)
+{
+	BindVertexBuffer(vbo);
+	m_currentFrameStats.m_numDrawCalls++;
+	m_currentFrameStats.m_numVertexesDrawn += (int)vertexCount;
+}
+
+void RendererNull::DrawQuadArray2D(int numVertexes, Vertex_PCU2D const* vertexes)
+{
+	UNUSED(vertexes);
+	if (numVertexes < NUM_VERTS_PER_QUAD_2D)
+		return;
+
+	m_currentFrameStats.m_numBytesUploaded += (uint64_t)numVertexes * sizeof(Vertex_PCU2D);
+	m_currentFrameStats.m_numDrawCalls++;
+	m_currentFrameStats.m_numVertexesDrawn += numVertexes;
+}
+
+void RendererNull::DrawQuadArray2D(std::vector<Vertex_PCU2D> const& verts)
+{
+	DrawQuadArray2D((int)verts.size(), verts.data());
+}
+
+void RendererNull::DrawQuadVertexBuffer2D(VertexBuffer* vbo, unsigned int vertexCount, unsigned int firstVertex)
+{
+	UNUSED(firstVertex);
+	DrawVertexBuffer(vbo, vertexCount);
+}
+
+void RendererNull::DrawQuadInstances2D(int numInstances, QuadInstance2D const* instances)
+{
+	if (numInstances <= 0)
+		return;
+
+	m_expandedQuadInstanceVerts.clear();
+	AddVertsForQuadInstances2D(m_expandedQuadInstanceVerts, numInstances, instances);
+
+	m_currentFrameStats.m_numBytesUploaded += (uint64_t)numInstances * sizeof(QuadInstance2D);
+	m_currentFrameStats.m_numDrawCalls++;
+	m_currentFrameStats.m_numVertexesDrawn += (int)m_expandedQuadInstanceVerts.size();
+}
+
+void RendererNull::DrawQuadInstances2D(std::vector<QuadInstance2D> const& instances)
+{
+	DrawQuadInstances2D((int)instances.size(), instances.data());
+}
+
+void RendererNull::SetBlendMode(BlendMode blendMode)
+{
+	if (blendMode != m_blendMode)
+	{
+		m_blendMode = blendMode;
+		m_currentFrameStats.m_numBlendModeChanges++;
+	}
+}
+
+void RendererNull::SetSamplerMode(SamplerMode samplerMode, int slot)
+{
+	UNUSED(samplerMode);
+	UNUSED(slot);
+}
+
+void RendererNull::SetRasterizerMode(RasterizerMode rasterizerMode)
+{
+	if (rasterizerMode != m_rasterizerMode)
+	{
+		m_rasterizerMode = rasterizerMode;
+		m_currentFrameStats.m_numRasterizerModeChanges++;
+	}
+}
+
+void RendererNull::SetDepthMode(DepthMode depthMode)
+{
+	UNUSED(depthMode);
+}
+
+//Creation
+//----------------------------------------------------------------------------------------------------------------------
+void RendererNull::CreateTextureResources(Texture* texture, Image const& image)
+{
+	//no device resources, only the size the game reads back
+	texture->m_dimensions = image.GetDimensions();
+	texture->m_isLoading = false;
+	m_currentFrameStats.m_numBytesUploaded += (uint64_t)image.GetDimensions().x * (uint64_t)image.GetDimensions().y * sizeof(Rgba8);
+}
+
+void RendererNull::DestroyTextureResources(Texture* texture)
+{
+	UNUSED(texture);
+}
+
+Shader* RendererNull::CreateOrGetShaderFromFile(char const* shaderName, VertexType vertexType)
+{
+	UNUSED(vertexType);
+	for (int shaderIndex = 0; shaderIndex < (int)m_loadedShaders.size(); ++shaderIndex)
+	{
+		if (m_loadedShaders[shaderIndex]->GetName() == (std::string)shaderName)
+		{
+			return m_loadedShaders[shaderIndex];
+		}
+	}
+
+	ShaderConfig shaderConfig;
+	shaderConfig.m_name = shaderName;
+	Shader* newShader = new Shader(shaderConfig);
+	m_loadedShaders.push_back(newShader);
+	return newShader;
+}
+
+VertexBuffer* RendererNull::CreateVertexBuffer(const unsigned int size, unsigned int stride)
+{
+	//a null device makes the buffer skip creating its D3D resource
+	return new VertexBuffer(nullptr, size, stride);
+}
+
+void RendererNull::CopyCPUToGPU(const void* data, unsigned int size, VertexBuffer* vbo)
+{
+	UNUSED(data);
+	if (vbo->m_size < size)
+	{
+		vbo->Resize(size);
+	}
+	m_currentFrameStats.m_numBytesUploaded += size;
+}
+
+//Binds
+//----------------------------------------------------------------------------------------------------------------------
+void RendererNull::BindTexture(Texture* texture, int slot)
+{
+	UNUSED(texture);
+	UNUSED(slot);
+	m_currentFrameStats.m_numTextureBinds++;
+}
+
+void RendererNull::BindShader(Shader* shader)
+{
+	UNUSED(shader);
+	m_currentFrameStats.m_numShaderBinds++;
+}
+
+void RendererNull::BindVertexBuffer(VertexBuffer* vbo)
+{
+	UNUSED(vbo);
+}
+
+void RendererNull::SetModelConstants(Mat44 const& modelToWorldTransform, Rgba8 const& modelColor)
+{
+	UNUSED(modelToWorldTransform);
+	UNUSED(modelColor);
+	m_currentFrameStats.m_numBytesUploaded += sizeof(ModelConstants);
+}
+
+void RendererNull::SetLightConstants(Vec3 const& sunDirection, float sunIntensity, float ambientIntensity, Rgba8 const& sunColor)
+{
+	SetLightConstants(LightConstants(sunDirection, sunIntensity, ambientIntensity, sunColor));
+}
+
+void RendererNull::SetLightConstants(LightConstants const& lightConstants)
+{
+	UNUSED(lightConstants);
+	m_currentFrameStats.m_numBytesUploaded += sizeof(LightConstants);
+}
+
+void RendererNull::SetColorAdjustmentConstants(ColorAdjustmentConstants const& colorAdjustmentConstants)
+{
+	UNUSED(colorAdjustmentConstants);
+	m_currentFrameStats.m_numBytesUploaded += sizeof(ColorAdjustmentConstants);
+}
+
+void RendererNull::SetPerFrameConstants(PerFrameConstants const& perFrameConstants)
+{
+	UNUSED(perFrameConstants);
+	m_currentFrameStats.m_numBytesUploaded += sizeof(PerFrameConstants);
+}
@@ -0,0 +1,126 @@
+#pragma once
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Renderer/Camera.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Engine/Renderer/FrameRingAllocator.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+
+#include <vector>
+#include <cstdint>
+
+struct Vertex_PCU;
+struct Vertex_PCU2D;
+struct QuadInstance2D;
+class Texture;
+class BitmapFont;
+class Image;
+class Shader;
+class VertexBuffer;
+
+struct RendererNullStats
+{
+	int m_numDrawCalls = 0;
+	int m_numVertexesDrawn = 0;
+	uint64_t m_numBytesUploaded = 0;	//vertex data, buffer copies and texture texels
+	int m_numBlendModeChanges = 0;		//calls that asked for a different mode than the current one
+	int m_numRasterizerModeChanges = 0;
+	int m_numTextureBinds = 0;
+	int m_numShaderBinds = 0;
+	int m_numCameras = 0;
+	int m_numRingResets = 0;			//transient ring ran out of room this frame and started over
+
+	void Add(RendererNullStats const& stats);
+};
+
+//Headless backend with the same draw and state API as RendererDX11, nothing is sent to a device.
+//Every call is counted instead so simulation and CPU side render cost can be profiled on machines without a GPU.
+//Textures and fonts are still decoded from disk so their dimensions (and load cost) match the real thing.
+//This removes the GPU, not the platform: Window, Input and parts of Core are still Win32/MSVC only, so a null build is a Windows build.
+class RendererNull : public Renderer
+{
+public:
+	RendererNull(RendererConfig const& config);
+	virtual ~RendererNull() {};
+
+	virtual void Startup() override;
+	virtual void BeginFrame() override;
+	virtual void EndFrame() override;
+	virtual void Shutdown() override;
+
+	virtual void ClearScreen(const Rgba8& clearColor) override;
+	virtual void BeginCamera(const Camera& camera) override;
+	virtual void EndCamera(const Camera& camera) override;
+
+	virtual void BeginRendererEvent(char const* eventName) override;
+	virtual void EndRendererEvent() override;
+
+	//Draw
+	void		DrawVertexArray(int numVertexes, const Vertex_PCU* vertexes);
+	void		DrawVertexArray(std::vector<Vertex_PCU> const& verts);
+	void		DrawVertexBuffer(VertexBuffer* vbo, unsigned int vertexCount);
+
+	//Same contract as RendererDX11, the ring lives in CPU memory here
+	Vertex_PCU*	BeginTransientVertexArray(int maxNumVertexes);
+	void		EndTransientVertexArray(int numVertexes);
+
+	//counted as one draw per call, the DX11 split at MAX_QUADS_PER_INDEXED_DRAW is not modelled
+	void		DrawQuadArray2D(int numVertexes, Vertex_PCU2D const* vertexes);
+	void		DrawQuadArray2D(std::vector<Vertex_PCU2D> const& verts);
+	void		DrawQuadVertexBuffer2D(VertexBuffer* vbo, unsigned int vertexCount, unsigned int firstVertex = 0);
+
+	//expanded on the CPU with AddVertsForQuadInstances2D, the same result the DX11 vertex shader produces
+	void		DrawQuadInstances2D(int numInstances, QuadInstance2D const* instances);
+	void		DrawQuadInstances2D(std::vector<QuadInstance2D> const& instances);
+	std::vector<Vertex_PCU> const& GetLastExpandedQuadInstanceVerts() const { return m_expandedQuadInstanceVerts; }
+
+	void		SetBlendMode(BlendMode blendMode);
+	void		SetSamplerMode(SamplerMode samplerMode, int slot = 0);
+	void		SetRasterizerMode(RasterizerMode rasterizerMode);
+	void		SetDepthMode(DepthMode depthMode);
+
+	//Creation, the texture and font registry and async loads are Renderer's
+	Shader*			CreateOrGetShaderFromFile(char const* shaderName, VertexType vertexType = VertexType::VERTEX_PCU);
+	VertexBuffer*	CreateVertexBuffer(const unsigned int size, unsigned int stride);
+
+	void		CopyCPUToGPU(const void* data, unsigned int size, VertexBuffer* vbo);
+
+	//Binds
+	void		BindTexture(Texture* texture, int slot = 0);
+	void		BindShader(Shader* shader);
+	void		BindVertexBuffer(VertexBuffer* vbo);
+
+	virtual void	SetModelConstants(Mat44 const& modelToWorldTransform = Mat44(), Rgba8 const& modelColor = Rgba8::WHITE) override;
+	virtual void	SetLightConstants(Vec3 const& sunDirection, float sunIntensity, float ambientIntensity, Rgba8 const& sunColor = Rgba8::WHITE) override;
+	virtual void	SetLightConstants(LightConstants const& lightConstants) override;
+	virtual void	SetColorAdjustmentConstants(ColorAdjustmentConstants const& colorAdjustmentConstants) override;
+	virtual void	SetPerFrameConstants(PerFrameConstants const& perFrameConstants) override;
+
+	//Stats
+	RendererNullStats const&	GetCurrentFrameStats() const { return m_currentFrameStats; }
+	RendererNullStats const&	GetLastFrameStats() const { return m_lastFrameStats; }
+	RendererNullStats const&	GetTotalStats() const { return m_totalStats; }
+	int							GetNumFrames() const { return m_numFrames; }
+	void						ResetStats();
+
+protected:
+	virtual void	CreateTextureResources(Texture* texture, Image const& image) override;
+	virtual void	DestroyTextureResources(Texture* texture) override;
+
+private:
+	std::vector<Shader*> m_loadedShaders;
+
+	std::vector<unsigned char> m_immediateRingMemory;
+	FrameRingAllocator m_immediateRing;
+	FrameRingAllocation m_transientAllocation;
+	bool m_isWritingTransientVerts = false;
+	std::vector<Vertex_PCU> m_expandedQuadInstanceVerts;
+
+	BlendMode m_blendMode = BlendMode::ALPHA;
+	RasterizerMode m_rasterizerMode = RasterizerMode::SOLID_CULL_BACK;
+
+	RendererNullStats m_currentFrameStats;
+	RendererNullStats m_lastFrameStats;
+	RendererNullStats m_totalStats;
+	int m_numFrames = 0;
+};
@@ -0,0 +1,61 @@
+#include "Engine/Renderer/SpriteBatch2D.hpp"
+#include "Engine/Core/VertexUtils.hpp"
+#include "Engine/Renderer/RenderQueue.hpp"
+
+void SpriteBatch2D::Begin()
+{
+	m_submissions.clear();
+	m_verts.clear();
+}
+
+void SpriteBatch2D::AddQuad(Texture* texture, BlendMode blendMode, int layer, AABB2 const& localBounds, Vec2 const& iBasis, Vec2 const& jBasis, Vec2 const& translation, Rgba8 const& tint, AABB2 const& uvs)
+{
+	int submissionIndex = AddSubmission(texture, blendMode, layer);
+	AddVertsForAABB2D(m_verts, localBounds, tint, uvs);
+
+	Submission& submission = m_submissions[submissionIndex];
+	submission.m_numVertexes = static_cast<int>(m_verts.size()) - submission.m_firstVertex;
+	TransformVertexArrayXY3D(submission.m_numVertexes, &m_verts[submission.m_firstVertex], iBasis, jBasis, translation);
+}
+
+void SpriteBatch2D::AddQuad(Texture* texture, BlendMode blendMode, int layer, AABB2 const& worldBounds, Rgba8 const& tint, AABB2 const& uvs)
+{
+	int submissionIndex = AddSubmission(texture, blendMode, layer);
+	AddVertsForAABB2D(m_verts, worldBounds, tint, uvs);
+
+	Submission& submission = m_submissions[submissionIndex];
+	submission.m_numVertexes = static_cast<int>(m_verts.size()) - submission.m_firstVertex;
+}
+
+void SpriteBatch2D::AddVerts(Texture* texture, BlendMode blendMode, int layer, std::vector<Vertex_PCU> const& worldVerts)
+{
+	if (worldVerts.empty())
+		return;
+
+	int submissionIndex = AddSubmission(texture, blendMode, layer);
+	m_verts.insert(m_verts.end(), worldVerts.begin(), worldVerts.end());
+	m_submissions[submissionIndex].m_numVertexes = static_cast<int>(worldVerts.size());
+}
+
+void SpriteBatch2D::AddToRenderQueue(RenderQueue& renderQueue, int baseLayer, Shader* shader) const
+{
+	for (int submissionIndex = 0; submissionIndex < static_cast<int>(m_submissions.size()); ++submissionIndex)
+	{
+		Submission const& submission = m_submissions[submissionIndex];
+		if (submission.m_numVertexes == 0)
+			continue;
+
+		renderQueue.AddDraw(baseLayer + submission.m_layer, submission.m_blendMode, shader, submission.m_texture, submission.m_numVertexes, &m_verts[submission.m_firstVertex]);
+	}
+}
+
+int SpriteBatch2D::AddSubmission(Texture* texture, BlendMode blendMode, int layer)
+{
+	Submission submission;
+	submission.m_texture = texture;
+	submission.m_blendMode = blendMode;
+	submission.m_layer = layer;
+	submission.m_firstVertex = static_cast<int>(m_verts.size());
+	m_submissions.push_back(submission);
+	return static_cast<int>(m_submissions.size()) - 1;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include <vector>
+
+class Texture;
+class Shader;
+class RenderQueue;
+
+//Collects 2D quads and loose verts for a frame and hands them to a RenderQueue, which sorts them by (layer, blend, texture)
+//and merges them into as few draws as possible. Submission order is kept inside a layer for the same state, but quads of
+//different textures in one layer may be reordered, so anything that has to draw on top of something else needs a higher layer.
+class SpriteBatch2D
+{
+public:
+	SpriteBatch2D() {};
+	~SpriteBatch2D() {};
+
+	void Begin();
+
+	//localBounds is transformed by the I J basis then translated, the same as TransformVertexArrayXY3D
+	void AddQuad(Texture* texture, BlendMode blendMode, int layer, AABB2 const& localBounds, Vec2 const& iBasis, Vec2 const& jBasis, Vec2 const& translation,
+		Rgba8 const& tint = Rgba8::WHITE, AABB2 const& uvs = AABB2::ZERO_TO_ONE);
+	void AddQuad(Texture* texture, BlendMode blendMode, int layer, AABB2 const& worldBounds, Rgba8 const& tint = Rgba8::WHITE, AABB2 const& uvs = AABB2::ZERO_TO_ONE);
+	void AddVerts(Texture* texture, BlendMode blendMode, int layer, std::vector<Vertex_PCU> const& worldVerts); //already in world space
+
+	int GetNumSubmissions() const { return static_cast<int>(m_submissions.size()); }
+
+	//Hands every submission to the queue as its own packet, layers offset by baseLayer
+	void AddToRenderQueue(RenderQueue& renderQueue, int baseLayer = 0, Shader* shader = nullptr) const;
+
+private:
+	int AddSubmission(Texture* texture, BlendMode blendMode, int layer);
+
+private:
+	struct Submission
+	{
+		Texture* m_texture = nullptr;
+		BlendMode m_blendMode = BlendMode::ALPHA;
+		int m_layer = 0;
+		int m_firstVertex = 0;
+		int m_numVertexes = 0;
+	};
+
+	std::vector<Submission> m_submissions;
+	std::vector<Vertex_PCU> m_verts;
+};
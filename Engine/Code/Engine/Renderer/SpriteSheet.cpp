@@ -5,6 +5,11 @@
 #include "Engine/Renderer/Texture.hpp"
 
 SpriteSheet::SpriteSheet(Texture& texture, IntVec2 const& simpleGridLayout)
+    :SpriteSheet(texture, simpleGridLayout, AABB2::ZERO_TO_ONE)
+{
+}
+
+SpriteSheet::SpriteSheet(Texture& texture, IntVec2 const& simpleGridLayout, AABB2 const& textureUVBounds)
     :m_texture(texture)
 {
     int numSpriteDefs = simpleGridLayout.x * simpleGridLayout.y;
@@ -21,6 +26,7 @@ SpriteSheet::SpriteSheet(Texture& texture, IntVec2 const& simpleGridLayout)
     float xNudge = 1.f / (textureDimensions.x * 128.f); //#TODO may need to adjust these spritesheet nudge values
     float yNudge = 1.f / (textureDimensions.y * 128.f);
 
+    Vec2 uvBoundsDimensions = textureUVBounds.m_maxs - textureUVBounds.m_mins;
     int rowNum = 0;
     int columnNum = 0;
 
@@ -32,8 +38,10 @@ SpriteSheet::SpriteSheet(Texture& texture, IntVec2 const& simpleGridLayout)
             columnNum = 0;
         }
 
-        uvMins = Vec2((columnNum * spriteDefUVDimensionsX) + xNudge, (1 - ((rowNum + 1) * spriteDefUVDimensionY)) + yNudge);
-        uvMaxs = Vec2(((columnNum + 1) * spriteDefUVDimensionsX) - xNudge, (1 - (rowNum * spriteDefUVDimensionY)) - yNudge);
+        uvMins = Vec2((columnNum * spriteDefUVDimensionsX), (1 - ((rowNum + 1) * spriteDefUVDimensionY)));
+        uvMaxs = Vec2(((columnNum + 1) * spriteDefUVDimensionsX), (1 - (rowNum * spriteDefUVDimensionY)));
+        uvMins = textureUVBounds.m_mins + uvMins * uvBoundsDimensions + Vec2(xNudge, yNudge);
+        uvMaxs = textureUVBounds.m_mins + uvMaxs * uvBoundsDimensions - Vec2(xNudge, yNudge);
         m_spriteDefs.push_back(SpriteDefinition(*this, spriteNum, uvMins, uvMaxs));
 
         columnNum++;
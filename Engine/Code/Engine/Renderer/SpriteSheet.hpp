@@ -11,6 +11,7 @@ class SpriteSheet
 {
 public:
 	explicit SpriteSheet(Texture& texture, IntVec2 const& simpleGridLayout);
+	explicit SpriteSheet(Texture& texture, IntVec2 const& simpleGridLayout, AABB2 const& textureUVBounds); //grid covers only textureUVBounds, e.g. a sheet packed into an atlas
 	~SpriteSheet() {}
 
 	Texture&					GetTexture() const;
@@ -0,0 +1,72 @@
+#include "Engine/Renderer/TextMesh.hpp"
+
+TextMesh::TextMesh(BitmapFont* font)
+	:m_font(font)
+{
+}
+
+void TextMesh::SetFont(BitmapFont* font)
+{
+	if (font == m_font)
+		return;
+
+	m_font = font;
+	Rebuild();
+}
+
+void TextMesh::SetText2D(std::string const& text, Vec2 const& textMins, float cellHeight, Rgba8 const& tint, float cellAspectScale)
+{
+	bool isUnchanged = !m_isInBox && m_text == text && m_box.m_mins == textMins && m_cellHeight == cellHeight && m_tint == tint && m_cellAspectScale == cellAspectScale;
+	if (isUnchanged)
+		return;
+
+	m_isInBox = false;
+	m_text = text;
+	m_box = AABB2(textMins, textMins);
+	m_cellHeight = cellHeight;
+	m_tint = tint;
+	m_cellAspectScale = cellAspectScale;
+	Rebuild();
+}
+
+void TextMesh::SetTextInBox2D(std::string const& text, AABB2 const& box, float cellHeight, Rgba8 const& tint, float cellAspectScale, Vec2 const& alignment, TextBoxMode mode)
+{
+	bool isUnchanged = m_isInBox && m_text == text && m_box.m_mins == box.m_mins && m_box.m_maxs == box.m_maxs && m_cellHeight == cellHeight && m_tint == tint
+		&& m_cellAspectScale == cellAspectScale && m_alignment == alignment && m_mode == mode;
+	if (isUnchanged)
+		return;
+
+	m_isInBox = true;
+	m_text = text;
+	m_box = box;
+	m_cellHeight = cellHeight;
+	m_tint = tint;
+	m_cellAspectScale = cellAspectScale;
+	m_alignment = alignment;
+	m_mode = mode;
+	Rebuild();
+}
+
+void TextMesh::Clear()
+{
+	m_text.clear();
+	m_verts.clear();
+}
+
+void TextMesh::Rebuild()
+{
+	m_verts.clear();
+	m_numRebuilds++;
+	if (m_font == nullptr || m_text.empty())
+		return;
+
+	if (m_isInBox)
+	{
+		m_font->AddVertsForTextInBox2D(m_verts, m_text, m_box, m_cellHeight, m_tint, m_cellAspectScale, m_alignment, m_mode);
+	}
+
+	else
+	{
+		m_font->AddVertsForText2D(m_verts, m_box.m_mins, m_cellHeight, m_text, m_tint, m_cellAspectScale);
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "Engine/Renderer/BitmapFont.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include <vector>
+#include <string>
+
+//Retained text for strings that rarely change. The verts are kept between frames and only laid out again
+//when the text or one of its settings actually changes, so calling SetText every frame with the same values is free.
+class TextMesh
+{
+public:
+	TextMesh() {}
+	explicit TextMesh(BitmapFont* font);
+	~TextMesh() {}
+
+	void SetFont(BitmapFont* font);
+	void SetText2D(std::string const& text, Vec2 const& textMins, float cellHeight, Rgba8 const& tint = Rgba8::WHITE, float cellAspectScale = 1.f);
+	void SetTextInBox2D(std::string const& text, AABB2 const& box, float cellHeight, Rgba8 const& tint = Rgba8::WHITE, float cellAspectScale = 1.f,
+		Vec2 const& alignment = Vec2(0.5f, 0.5f), TextBoxMode mode = TextBoxMode::SHRINK_TO_FIT);
+	void Clear();
+
+	bool IsEmpty() const { return m_verts.empty(); }
+	BitmapFont* GetFont() const { return m_font; }
+	std::vector<Vertex_PCU> const& GetVerts() const { return m_verts; }
+	int GetNumRebuilds() const { return m_numRebuilds; }
+
+	//Works with any renderer that has BindTexture(Texture*) and DrawVertexArray(std::vector<Vertex_PCU> const&)
+	template <typename RendererType>
+	void Render(RendererType* renderer) const;
+
+private:
+	void Rebuild();
+
+private:
+	BitmapFont* m_font = nullptr;
+	std::string m_text;
+	bool m_isInBox = false;
+	AABB2 m_box;			//only the mins are used for SetText2D
+	float m_cellHeight = 0.f;
+	Rgba8 m_tint;
+	float m_cellAspectScale = 1.f;
+	Vec2 m_alignment;
+	TextBoxMode m_mode = TextBoxMode::SHRINK_TO_FIT;
+
+	std::vector<Vertex_PCU> m_verts;
+	int m_numRebuilds = 0;
+};
+
+template <typename RendererType>
+void TextMesh::Render(RendererType* renderer) const
+{
+	if (m_font == nullptr || m_verts.empty())
+		return;
+
+	renderer->BindTexture(&m_font->GetTexture());
+	renderer->DrawVertexArray(m_verts);
+}
@@ -1,14 +1,19 @@
 #pragma once
 #include<string>
 #include "Engine/Math/IntVec2.hpp"
+#include "Engine/Core/AssetRegistry.hpp"
 
 struct ID3D11Texture2D;
 struct ID3D11ShaderResourceView;
+class Texture;
+
+typedef AssetHandle<Texture*> TextureHandle; //see Renderer CreateOrGetTextureHandle
 
 class Texture
 {
 	friend class Renderer; // Only the Renderer can create new Texture objects!
 	friend class RendererDX11;
+	friend class RendererNull;
 
 private:
 	Texture() {} // can't instantiate directly; must ask Renderer to do it for you
@@ -18,10 +23,12 @@ private:
 public:
 	IntVec2				GetDimensions() const { return m_dimensions; }
 	std::string const& GetImageFilePath() const { return m_name; }
+	bool				IsLoading() const { return m_isLoading; } //async load still decoding, binds as the default texture and is 1x1 until done
 
 protected:
 	std::string			m_name;
 	IntVec2				m_dimensions;
+	bool				m_isLoading = false;
 
 	ID3D11Texture2D* m_texture = nullptr;
 	ID3D11ShaderResourceView* m_shaderResourceView = nullptr;
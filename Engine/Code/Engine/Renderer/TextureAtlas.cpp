@@ -0,0 +1,308 @@
+#include "Engine/Renderer/TextureAtlas.hpp"
+#include "Engine/Renderer/Texture.hpp"
+#include "Engine/Core/Image.hpp"
+#include "Engine/Core/CookedImage.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include <algorithm>
+
+//SkylinePacker
+//-----------------------------------------------------------------------------------------------
+SkylinePacker::SkylinePacker(IntVec2 const& dimensions)
+	:m_dimensions(dimensions)
+{
+	SkylineNode firstNode;
+	firstNode.m_width = dimensions.x;
+	m_skyline.push_back(firstNode);
+}
+
+bool SkylinePacker::Insert(IntVec2 const& rectDimensions, IntVec2& out_rectMins)
+{
+	int bestNodeIndex = -1;
+	int bestTop = m_dimensions.y + 1;
+	int bestNodeWidth = m_dimensions.x + 1;
+	int bestY = 0;
+
+	//bottom-left heuristic, lowest resulting top edge wins and ties go to the narrowest spot
+	for (int nodeIndex = 0; nodeIndex < static_cast<int>(m_skyline.size()); ++nodeIndex)
+	{
+		int y = GetFitHeight(nodeIndex, rectDimensions.x);
+		if (y < 0 || y + rectDimensions.y > m_dimensions.y)
+			continue;
+
+		int top = y + rectDimensions.y;
+		int nodeWidth = m_skyline[nodeIndex].m_width;
+		if (top < bestTop || (top == bestTop && nodeWidth < bestNodeWidth))
+		{
+			bestNodeIndex = nodeIndex;
+			bestTop = top;
+			bestNodeWidth = nodeWidth;
+			bestY = y;
+		}
+	}
+
+	if (bestNodeIndex < 0)
+		return false;
+
+	out_rectMins = IntVec2(m_skyline[bestNodeIndex].m_x, bestY);
+	AddSkylineLevel(bestNodeIndex, out_rectMins, rectDimensions);
+	m_usedArea += rectDimensions.x * rectDimensions.y;
+	return true;
+}
+
+int SkylinePacker::GetFitHeight(int nodeIndex, int rectWidth) const
+{
+	int x = m_skyline[nodeIndex].m_x;
+	if (x + rectWidth > m_dimensions.x)
+		return -1;
+
+	//the rect rests on the highest node it spans
+	int y = 0;
+	int widthLeft = rectWidth;
+	for (int spanIndex = nodeIndex; widthLeft > 0; ++spanIndex)
+	{
+		y = std::max(y, m_skyline[spanIndex].m_y);
+		widthLeft -= m_skyline[spanIndex].m_width;
+	}
+
+	return y;
+}
+
+void SkylinePacker::AddSkylineLevel(int nodeIndex, IntVec2 const& rectMins, IntVec2 const& rectDimensions)
+{
+	SkylineNode newNode;
+	newNode.m_x = rectMins.x;
+	newNode.m_y = rectMins.y + rectDimensions.y;
+	newNode.m_width = rectDimensions.x;
+	m_skyline.insert(m_skyline.begin() + nodeIndex, newNode);
+
+	//trim or remove the nodes now hidden under the new one
+	int newNodeRight = newNode.m_x + newNode.m_width;
+	for (int followingIndex = nodeIndex + 1; followingIndex < static_cast<int>(m_skyline.size());)
+	{
+		SkylineNode& node = m_skyline[followingIndex];
+		if (node.m_x >= newNodeRight)
+			break;
+
+		int overlap = newNodeRight - node.m_x;
+		if (overlap < node.m_width)
+		{
+			node.m_x += overlap;
+			node.m_width -= overlap;
+			break;
+		}
+
+		m_skyline.erase(m_skyline.begin() + followingIndex);
+	}
+
+	//merge neighbours at the same height
+	for (int mergeIndex = 0; mergeIndex < static_cast<int>(m_skyline.size()) - 1;)
+	{
+		if (m_skyline[mergeIndex].m_y == m_skyline[mergeIndex + 1].m_y)
+		{
+			m_skyline[mergeIndex].m_width += m_skyline[mergeIndex + 1].m_width;
+			m_skyline.erase(m_skyline.begin() + mergeIndex + 1);
+		}
+		else
+		{
+			mergeIndex++;
+		}
+	}
+}
+
+//TextureAtlas
+//-----------------------------------------------------------------------------------------------
+TextureAtlas::TextureAtlas(TextureAtlasConfig const& config)
+	:m_config(config)
+{
+}
+
+TextureAtlas::~TextureAtlas()
+{
+	//page textures belong to the renderer
+	for (int pageIndex = 0; pageIndex < static_cast<int>(m_pageImages.size()); ++pageIndex)
+	{
+		delete m_pageImages[pageIndex];
+		m_pageImages[pageIndex] = nullptr;
+	}
+}
+
+int TextureAtlas::AddImage(char const* imageFilePath)
+{
+	GUARANTEE_OR_DIE(!m_isBuilt, Stringf("TextureAtlas::AddImage called with \"%s\" after the atlas was built", imageFilePath));
+
+	for (int spriteIndex = 0; spriteIndex < static_cast<int>(m_sprites.size()); ++spriteIndex)
+	{
+		if (m_sprites[spriteIndex].m_imageFilePath == imageFilePath)
+			return spriteIndex;
+	}
+
+	TextureAtlasSprite sprite;
+	sprite.m_imageFilePath = imageFilePath;
+	m_sprites.push_back(sprite);
+	return static_cast<int>(m_sprites.size()) - 1;
+}
+
+void TextureAtlas::PackImages()
+{
+	int numSprites = static_cast<int>(m_sprites.size());
+	std::vector<Image*> images(numSprites, nullptr);
+	for (int spriteIndex = 0; spriteIndex < numSprites; ++spriteIndex)
+	{
+		images[spriteIndex] = LoadSpriteImage(m_sprites[spriteIndex].m_imageFilePath.c_str());
+		m_sprites[spriteIndex].m_texelDimensions = images[spriteIndex]->GetDimensions();
+	}
+
+	//tallest first packs much tighter on a skyline
+	std::vector<int> packOrder(numSprites);
+	for (int spriteIndex = 0; spriteIndex < numSprites; ++spriteIndex)
+	{
+		packOrder[spriteIndex] = spriteIndex;
+	}
+	std::stable_sort(packOrder.begin(), packOrder.end(), [this](int a, int b)
+		{
+			IntVec2 const& dimsA = m_sprites[a].m_texelDimensions;
+			IntVec2 const& dimsB = m_sprites[b].m_texelDimensions;
+			if (dimsA.y != dimsB.y)
+				return dimsA.y > dimsB.y;
+
+			return dimsA.x > dimsB.x;
+		});
+
+	std::vector<SkylinePacker> packers;
+	int padding = m_config.m_padding;
+	for (int orderIndex = 0; orderIndex < numSprites; ++orderIndex)
+	{
+		TextureAtlasSprite& sprite = m_sprites[packOrder[orderIndex]];
+		IntVec2 paddedDims(sprite.m_texelDimensions.x + 2 * padding, sprite.m_texelDimensions.y + 2 * padding);
+		GUARANTEE_OR_DIE(paddedDims.x <= m_config.m_pageDimensions.x && paddedDims.y <= m_config.m_pageDimensions.y,
+			Stringf("TextureAtlas image \"%s\" (%i x %i) is bigger than an atlas page", sprite.m_imageFilePath.c_str(), sprite.m_texelDimensions.x, sprite.m_texelDimensions.y));
+
+		IntVec2 rectMins;
+		int pageIndex = 0;
+		for (; pageIndex < static_cast<int>(packers.size()); ++pageIndex)
+		{
+			if (packers[pageIndex].Insert(paddedDims, rectMins))
+				break;
+		}
+
+		if (pageIndex == static_cast<int>(packers.size()))
+		{
+			packers.push_back(SkylinePacker(m_config.m_pageDimensions));
+			packers.back().Insert(paddedDims, rectMins);
+		}
+
+		sprite.m_pageIndex = pageIndex;
+		sprite.m_texelMins = IntVec2(rectMins.x + padding, rectMins.y + padding);
+
+		Vec2 pageDims(static_cast<float>(m_config.m_pageDimensions.x), static_cast<float>(m_config.m_pageDimensions.y));
+		sprite.m_uvs.m_mins = Vec2(static_cast<float>(sprite.m_texelMins.x) / pageDims.x, static_cast<float>(sprite.m_texelMins.y) / pageDims.y);
+		sprite.m_uvs.m_maxs = Vec2(static_cast<float>(sprite.m_texelMins.x + sprite.m_texelDimensions.x) / pageDims.x, static_cast<float>(sprite.m_texelMins.y + sprite.m_texelDimensions.y) / pageDims.y);
+	}
+
+	m_numPages = static_cast<int>(packers.size());
+	for (int pageIndex = 0; pageIndex < m_numPages; ++pageIndex)
+	{
+		m_pageImages.push_back(new Image(m_config.m_pageDimensions, Rgba8(0, 0, 0, 0)));
+	}
+
+	for (int spriteIndex = 0; spriteIndex < numSprites; ++spriteIndex)
+	{
+		TextureAtlasSprite const& sprite = m_sprites[spriteIndex];
+		CopyImageToPage(*images[spriteIndex], sprite, *m_pageImages[sprite.m_pageIndex]);
+		delete images[spriteIndex];
+		images[spriteIndex] = nullptr;
+	}
+
+	m_isBuilt = true;
+}
+
+void TextureAtlas::ReleasePageImages()
+{
+	for (int pageIndex = 0; pageIndex < static_cast<int>(m_pageImages.size()); ++pageIndex)
+	{
+		delete m_pageImages[pageIndex];
+		m_pageImages[pageIndex] = nullptr;
+	}
+	m_pageImages.clear();
+}
+
+TextureAtlasSprite const& TextureAtlas::GetSprite(int spriteIndex) const
+{
+	return m_sprites[spriteIndex];
+}
+
+TextureAtlasSprite const* TextureAtlas::FindSprite(char const* imageFilePath) const
+{
+	if (!m_isBuilt)
+		return nullptr;
+
+	for (int spriteIndex = 0; spriteIndex < static_cast<int>(m_sprites.size()); ++spriteIndex)
+	{
+		if (m_sprites[spriteIndex].m_imageFilePath == imageFilePath)
+			return &m_sprites[spriteIndex];
+	}
+
+	return nullptr;
+}
+
+Texture* TextureAtlas::GetPageTexture(int pageIndex) const
+{
+	if (pageIndex < 0 || pageIndex >= static_cast<int>(m_pageTextures.size()))
+		return nullptr;
+
+	return m_pageTextures[pageIndex];
+}
+
+Image const* TextureAtlas::GetPageImage(int pageIndex) const
+{
+	if (pageIndex < 0 || pageIndex >= static_cast<int>(m_pageImages.size()))
+		return nullptr;
+
+	return m_pageImages[pageIndex];
+}
+
+AABB2 TextureAtlas::GetRemappedUVs(int spriteIndex, AABB2 const& imageUVs) const
+{
+	AABB2 const& spriteUVs = m_sprites[spriteIndex].m_uvs;
+	Vec2 spriteUVDims = spriteUVs.m_maxs - spriteUVs.m_mins;
+	return AABB2(spriteUVs.m_mins + imageUVs.m_mins * spriteUVDims, spriteUVs.m_mins + imageUVs.m_maxs * spriteUVDims);
+}
+
+Texture* TextureAtlas::GetTextureAndUVs(char const* imageFilePath, AABB2& out_uvs) const
+{
+	TextureAtlasSprite const* sprite = FindSprite(imageFilePath);
+	if (sprite == nullptr)
+		return nullptr;
+
+	out_uvs = sprite->m_uvs;
+	return GetPageTexture(sprite->m_pageIndex);
+}
+
+void TextureAtlas::CopyImageToPage(Image const& image, TextureAtlasSprite const& sprite, Image& pageImage) const
+{
+	//padding texels repeat the nearest edge texel
+	IntVec2 const& dims = sprite.m_texelDimensions;
+	int padding = m_config.m_padding;
+	for (int y = -padding; y < dims.y + padding; ++y)
+	{
+		int sourceY = GetClampedInt(y, 0, dims.y - 1);
+		for (int x = -padding; x < dims.x + padding; ++x)
+		{
+			int sourceX = GetClampedInt(x, 0, dims.x - 1);
+			pageImage.SetTexelColor(IntVec2(sprite.m_texelMins.x + x, sprite.m_texelMins.y + y), image.GetTexelColor(IntVec2(sourceX, sourceY)));
+		}
+	}
+}
+
+Image* TextureAtlas::LoadSpriteImage(char const* imageFilePath) const
+{
+	Image* image = m_config.m_cookedImageFolder.empty() ? new Image(imageFilePath) : LoadImageThroughCookedCache(imageFilePath, m_config.m_cookedImageFolder.c_str());
+	while (m_config.m_maxSpriteDimension > 0 && (image->GetDimensions().x > m_config.m_maxSpriteDimension || image->GetDimensions().y > m_config.m_maxSpriteDimension))
+	{
+		*image = image->CreateNextMip(MipFilter::BOX);
+	}
+
+	return image;
+}
@@ -0,0 +1,112 @@
+#pragma once
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include <string>
+#include <vector>
+
+class Image;
+class Texture;
+
+//Skyline bottom-left rectangle packer, one per atlas page
+class SkylinePacker
+{
+public:
+	explicit SkylinePacker(IntVec2 const& dimensions);
+
+	bool Insert(IntVec2 const& rectDimensions, IntVec2& out_rectMins); //false if the rect doesn't fit anywhere
+	int GetUsedArea() const { return m_usedArea; }
+
+private:
+	int GetFitHeight(int nodeIndex, int rectWidth) const; //-1 if the rect can't sit on this node
+	void AddSkylineLevel(int nodeIndex, IntVec2 const& rectMins, IntVec2 const& rectDimensions);
+
+private:
+	struct SkylineNode
+	{
+		int m_x = 0;
+		int m_y = 0;
+		int m_width = 0;
+	};
+
+	IntVec2 m_dimensions;
+	std::vector<SkylineNode> m_skyline;
+	int m_usedArea = 0;
+};
+
+struct TextureAtlasConfig
+{
+	IntVec2 m_pageDimensions = IntVec2(2048, 2048);
+	int m_padding = 2;				//texels around each sprite, filled by extruding its edges so filtering doesn't bleed
+	int m_maxSpriteDimension = 0;	//bigger images are box filtered down by halves until they fit, 0 for no limit
+	std::string m_cookedImageFolder;	//sources load through cooked images kept here, empty decodes every image
+};
+
+struct TextureAtlasSprite
+{
+	std::string m_imageFilePath;
+	int m_pageIndex = -1;
+	IntVec2 m_texelMins;
+	IntVec2 m_texelDimensions;
+	AABB2 m_uvs = AABB2::ZERO_TO_ONE; //where the whole image lives on its page
+};
+
+//Packs registered images into as few pages as possible so sprites from different files can share a draw.
+//Register everything with AddImage(), then Build() once; lookups before Build() return nothing.
+class TextureAtlas
+{
+public:
+	explicit TextureAtlas(TextureAtlasConfig const& config);
+	~TextureAtlas();
+
+	int		AddImage(char const* imageFilePath); //returns the sprite index, registering the same path twice returns the first index
+	//RendererType needs CreateTextureFromImage(Image const&), RendererDX11 and RendererNull both do
+	template <typename RendererType>
+	void	Build(RendererType* renderer);
+	void	PackImages(); //CPU half of Build, fills the page images
+	template <typename RendererType>
+	void	CreatePageTextures(RendererType* renderer);
+	bool	IsBuilt() const { return m_isBuilt; }
+	TextureAtlasConfig const& GetConfig() const { return m_config; }
+
+	int							GetNumSprites() const { return static_cast<int>(m_sprites.size()); }
+	int							GetNumPages() const { return m_numPages; }
+	TextureAtlasSprite const&	GetSprite(int spriteIndex) const;
+	TextureAtlasSprite const*	FindSprite(char const* imageFilePath) const;
+	Texture*					GetPageTexture(int pageIndex) const;
+	Image const*				GetPageImage(int pageIndex) const; //only valid between PackImages() and CreatePageTextures()
+
+	//maps uvs relative to the original image onto its rect in the atlas page
+	AABB2						GetRemappedUVs(int spriteIndex, AABB2 const& imageUVs = AABB2::ZERO_TO_ONE) const;
+	Texture*					GetTextureAndUVs(char const* imageFilePath, AABB2& out_uvs) const; //nullptr if the image isn't in the atlas
+
+	Image*						LoadSpriteImage(char const* imageFilePath) const; //the source through the cooked cache, halved until it fits, caller deletes it
+
+private:
+	void	ReleasePageImages();
+	void	CopyImageToPage(Image const& image, TextureAtlasSprite const& sprite, Image& pageImage) const;
+
+private:
+	TextureAtlasConfig m_config;
+	std::vector<TextureAtlasSprite> m_sprites;
+	std::vector<Image*> m_pageImages;
+	std::vector<Texture*> m_pageTextures;
+	int m_numPages = 0;
+	bool m_isBuilt = false;
+};
+
+template <typename RendererType>
+void TextureAtlas::Build(RendererType* renderer)
+{
+	PackImages();
+	CreatePageTextures(renderer);
+}
+
+template <typename RendererType>
+void TextureAtlas::CreatePageTextures(RendererType* renderer)
+{
+	for (int pageIndex = 0; pageIndex < static_cast<int>(m_pageImages.size()); ++pageIndex)
+	{
+		m_pageTextures.push_back(renderer->CreateTextureFromImage(*m_pageImages[pageIndex]));
+	}
+	ReleasePageImages();
+}
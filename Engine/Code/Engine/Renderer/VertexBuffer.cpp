@@ -25,6 +25,10 @@ VertexBuffer::~VertexBuffer()
 
 void VertexBuffer::Create()
 {
+	//RendererNull buffers have no device and only track their size
+	if (m_device == nullptr)
+		return;
+
 	D3D11_BUFFER_DESC bufferDesc = {};
 	bufferDesc.Usage = D3D11_USAGE_DYNAMIC;
 	bufferDesc.ByteWidth = m_size;
@@ -44,6 +48,9 @@ void VertexBuffer::Resize(unsigned int size)
 	DX_SAFE_RELEASE(m_buffer);
 
 	m_size = size;
+	if (m_device == nullptr)
+		return;
+
 	D3D11_BUFFER_DESC bufferDesc = {};
 	bufferDesc.Usage = D3D11_USAGE_DYNAMIC;
 	bufferDesc.ByteWidth = m_size;
@@ -7,6 +7,7 @@ class VertexBuffer
 {
 	friend class Renderer;
 	friend class RendererDX11;
+	friend class RendererNull;
 	friend class RenderDX12;
 
 public:
@@ -2,7 +2,7 @@
 #include "Game/Game.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/DevConsole.hpp"
-#include "Engine/Renderer/RendererDX11.hpp"
+#include "Game/GameRenderer.hpp"
 #include "Engine/Renderer/Camera.hpp"
 #include "Engine/Input/InputSystem.hpp"
 #include "Engine/Math/Vec2.hpp"
@@ -14,10 +14,11 @@
 #include "Engine//Window/Window.hpp"
 #include "Engine/Core/XmlUtils.hpp"
 #include "Engine/Core/Clock.hpp"
+#include "Engine/Core/JobSystem.hpp"
 
 
 App* g_app = nullptr;
-RendererDX11* g_renderer = nullptr;
+GameRenderer* g_renderer = nullptr;
 AudioSystem* g_audioSystem = nullptr;
 Window* g_window = nullptr;
 Game* g_game = nullptr;
@@ -27,18 +28,27 @@ Game* g_game = nullptr;
 void App::Startup()
 {
 	LoadGameConfig("Data/Definitions/GameConfig.xml");
+	JobSystemConfig jobSystemConfig;
+	g_jobSystem = new JobSystem(jobSystemConfig);
+	g_jobSystem->Startup();
+
 	InputConfig inputConfig;
 	g_inputSystem = new InputSystem(inputConfig);
 
+	//headless builds open no window, so the renderer gets none and nothing feeds Win32 input messages to g_inputSystem
+#if !defined(ENGINE_NULL_RENDERER)
 	WindowConfig windowConfig;
 	windowConfig.m_aspectRatio = 2.0f;
 	windowConfig.m_inputSystem = g_inputSystem;
 	windowConfig.m_windowTitle = "Libra";
 	g_window = new Window(windowConfig);
+#endif
 
 	RendererConfig rendererConfig;
 	rendererConfig.m_window = g_window;
-	g_renderer = new RendererDX11(rendererConfig);
+	rendererConfig.m_jobSystem = g_jobSystem;
+	rendererConfig.m_cookedTextureFolder = "Cooked/Textures";
+	g_renderer = new GameRenderer(rendererConfig);
 
 	EventSystemConfig eventSystemConfig;
 	g_eventSystem = new EventSystem(eventSystemConfig);
@@ -53,7 +63,9 @@ void App::Startup()
 	AudioConfig audioConfig;
 	g_audioSystem = new AudioSystem(audioConfig);
 
+#if !defined(ENGINE_NULL_RENDERER)
 	g_window->Startup();
+#endif
 	g_renderer->Startup();
 	g_eventSystem->Startup();
 	g_devConsole->Startup();
@@ -77,7 +89,9 @@ void App::Shutdown()
 	g_eventSystem->ShutDown();
 	g_inputSystem->Shutdown();
 	g_renderer->Shutdown();
+#if !defined(ENGINE_NULL_RENDERER)
 	g_window->Shutdown();
+#endif
 
 	delete g_audioSystem;
 	g_audioSystem = nullptr;
@@ -85,11 +99,18 @@ void App::Shutdown()
 	delete g_renderer;
 	g_renderer = nullptr;
 
+#if !defined(ENGINE_NULL_RENDERER)
 	delete g_window;
 	g_window = nullptr;
+#endif
 
 	delete g_inputSystem;
 	g_inputSystem = nullptr;
+
+	//last, the renderer waits on its texture loads during shutdown
+	g_jobSystem->Shutdown();
+	delete g_jobSystem;
+	g_jobSystem = nullptr;
 }
 
 //Frame Flow
@@ -109,7 +130,9 @@ void App::RunFrame()
 void App::BeginFrame()
 {
 	Clock::TickSystemClock();
+#if !defined(ENGINE_NULL_RENDERER)
 	g_window->BeginFrame();
+#endif
 	g_inputSystem->BeginFrame();
 	g_renderer->BeginFrame();
 	g_eventSystem->BeginFrame();
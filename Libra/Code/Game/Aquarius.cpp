@@ -5,7 +5,8 @@
 #include "Game/Tile.hpp"
 #include "Game/TileDefinition.hpp"
 #include "Engine/Core/EngineCommon.hpp"
-#include "Engine/Renderer/RendererDX11.hpp"
+#include "Game/GameRenderer.hpp"
+#include "Engine/Renderer/SpriteBatch2D.hpp"
 #include "Engine/Core/VertexUtils.hpp"
 #include"Engine/Math/MathUtils.hpp"
 #include "Engine/Core/TileHeatMap.hpp"
@@ -23,7 +24,7 @@ Aquarius::Aquarius(Map* const& mapOwner, EntityFaction faction)
 void Aquarius::Update(float deltaSeconds)
 {
 	UpdateTimers(deltaSeconds);
-	m_positionLastFrame = m_position;
+	m_positionLastFrame = GetPosition();
 
 	Vec2 fwrdNormal = UpdateEntityPathFinding(deltaSeconds);
 
@@ -31,18 +32,18 @@ void Aquarius::Update(float deltaSeconds)
 
 	if (DidChangeTile())
 	{
-		m_map->AddOverrideTileAtPos(m_position, "Water", m_trailAge);
+		m_map->AddOverrideTileAtPos(GetPosition(), "Water", m_trailAge);
 	}
 }
 
 Vec2 const Aquarius::UpdateEntityPathFinding(float deltaSeconds)
 {
 	//Change target based on sight to player
-	Vec2 playerPos = g_game->m_player->m_position;
-	if (m_map->HasLineOfSight(m_position, playerPos, m_sightRange, *m_solidMap))
+	Vec2 playerPos = g_game->m_player->GetPosition();
+	if (m_map->HasLineOfSight(GetPosition(), playerPos, m_sightRange, *m_solidMap))
 	{
 		m_chasingPlayerLocation = true;
-		m_map->GenerateEntityPathToTargetPos(m_pathToTarget, *m_map->m_amphibianDistanceMapToPlayer, m_position, static_cast<int>(m_sightRange));
+		m_map->GenerateEntityPathToTargetPos(m_pathToTarget, *m_map->m_amphibianDistanceMapToPlayer, GetPosition(), static_cast<int>(m_sightRange));
 		m_targetPos = m_pathToTarget.front();
 	}
 
@@ -55,34 +56,34 @@ Vec2 const Aquarius::UpdateEntityPathFinding(float deltaSeconds)
 	{
 		m_targetPos = playerPos;
 		m_nextWaypointPos = m_targetPos;
-		m_isPushedByEntities = false;
+		SetPhysicsFlag(PHYSICS_FLAG_IS_PUSHED_BY_ENTITIES, false);
 
 		//Does not move if next to player. This is to keep him from turning the tile underneath the player into water
-		Vec2 dispToNextWaypoint = m_nextWaypointPos - m_position;
+		Vec2 dispToNextWaypoint = m_nextWaypointPos - GetPosition();
 		m_orientationDegrees = GetTurnedTowardDegrees(m_orientationDegrees, dispToNextWaypoint.GetOrientationDegrees(), m_turnSpeed * deltaSeconds);
 		fwrdNormal = GetForwardNormal(); //update forward normal after rotation
 	}
 
 	else
 	{
-		m_isPushedByEntities = true;
+		SetPhysicsFlag(PHYSICS_FLAG_IS_PUSHED_BY_ENTITIES, true);
 		fwrdNormal = UpdatePositionAndOrientation(deltaSeconds);
 	}
 
 	//Update waypoint position whenever entity arrives at the next one
-	if (IsOnTargetTile(m_position, m_nextWaypointPos))
+	if (IsOnTargetTile(GetPosition(), m_nextWaypointPos))
 	{
 		SetNextWaypoint(fwrdNormal);
 	}
 
 	//Update target position when arrived at target tile
-	if (IsOnTargetTile(m_position, m_targetPos) || m_pathToTarget.size() < 1)
+	if (IsOnTargetTile(GetPosition(), m_targetPos) || m_pathToTarget.size() < 1)
 	{
 		if (!m_chasingPlayerLocation)
 		{
 			m_targetPos = m_map->GetRandomTraversablePosFromSolidMap(m_solidMap);
-			m_map->PopulateDistanceMapWithStationaryEntities(*m_roamDistanceMap, IntVec2(m_targetPos), DEFAULT_HEAT_MAP_SOLID_VALUE, !m_canTraverseWater);
-			m_map->GenerateEntityPathToTargetPos(m_pathToTarget, *m_roamDistanceMap, m_position);
+			m_map->PopulateDistanceMapWithStationaryEntities(*m_roamDistanceMap, IntVec2(m_targetPos), DEFAULT_HEAT_MAP_SOLID_VALUE, !HasPhysicsFlag(PHYSICS_FLAG_CAN_TRAVERSE_WATER));
+			m_map->GenerateEntityPathToTargetPos(m_pathToTarget, *m_roamDistanceMap, GetPosition());
 			m_nextWaypointPos = m_pathToTarget.back();
 		}
 
@@ -92,40 +93,33 @@ Vec2 const Aquarius::UpdateEntityPathFinding(float deltaSeconds)
 	return fwrdNormal;
 }
 
-void Aquarius::Render() const
+void Aquarius::Render(SpriteBatch2D& spriteBatch) const
 {
 	Vec2 fwrdNormal = GetForwardNormal();
-	std::vector<Vertex_PCU> worldVerts;
-	AddVertsForAABB2D(worldVerts, m_entityBounds, Rgba8::WHITE);
-
-	TransformVertexArrayXY3D(worldVerts, fwrdNormal, fwrdNormal.GetRotated90Degrees(), m_position);
-
-	g_renderer->SetBlendMode(BlendMode::ALPHA);
-	g_renderer->BindTexture(m_texture);
-	g_renderer->DrawVertexArray(worldVerts);
+	spriteBatch.AddQuad(m_texture, BlendMode::ALPHA, ENTITY_RENDER_LAYER_BODY, m_entityBounds, fwrdNormal, fwrdNormal.GetRotated90Degrees(), GetPosition(), Rgba8::WHITE, m_textureUVs);
 }
 
 void Aquarius::DebugRender() const
 {
 	std::vector<Vertex_PCU> debugVerts;
 	//Physics Ring
-	DebugDrawRing(m_position, m_physicsRadius, m_debugLineThickness, Rgba8(0, 255, 255));
+	DebugDrawRing(GetPosition(), GetPhysicsRadius(), m_debugLineThickness, Rgba8(0, 255, 255));
 
 	//Forward Vector
 	Vec2 vecFwrd = GetForwardNormal() * m_cosmeticRadius;
-	AddVertsForLineSegment2D(debugVerts, m_position, m_position + vecFwrd, m_debugLineThickness, Rgba8(255, 0, 0));
+	AddVertsForLineSegment2D(debugVerts, GetPosition(), GetPosition() + vecFwrd, m_debugLineThickness, Rgba8(255, 0, 0));
 
 	//Left Vector
 	Vec2 vecLeft = vecFwrd.GetRotated90Degrees();
-	AddVertsForLineSegment2D(debugVerts, m_position, m_position + vecLeft, m_debugLineThickness, Rgba8(0, 255, 0));
+	AddVertsForLineSegment2D(debugVerts, GetPosition(), GetPosition() + vecLeft, m_debugLineThickness, Rgba8(0, 255, 0));
 
 	//Velocity Line
-	AddVertsForLineSegment2D(debugVerts, m_position, m_position + m_velocity, m_debugLineThickness, Rgba8(255, 255, 0));
+	AddVertsForLineSegment2D(debugVerts, GetPosition(), GetPosition() + GetVelocity(), m_debugLineThickness, Rgba8(255, 255, 0));
 
 	if (m_chasingPlayerLocation)
 	{
 		//Line to Target Pos
-		AddVertsForLineSegment2D(debugVerts, m_position, m_targetPos, m_debugLineThickness, Rgba8(0, 0, 0, 100));
+		AddVertsForLineSegment2D(debugVerts, GetPosition(), m_targetPos, m_debugLineThickness, Rgba8(0, 0, 0, 100));
 		AddVertsForDisc2D(debugVerts, m_targetPos, 0.05f, Rgba8::BLACK);
 	}
 
@@ -136,7 +130,7 @@ void Aquarius::DebugRender() const
 
 void Aquarius::UpdateGameConfigXmlData()
 {
-	m_physicsRadius = g_gameConfigBlackboard.GetValue("aquariusPhysicsRadius", 0.35f);
+	SetPhysicsRadius(g_gameConfigBlackboard.GetValue("aquariusPhysicsRadius", 0.35f));
 	m_moveSpeed = g_gameConfigBlackboard.GetValue("aquariusDriveSpeed", 0.5f);
 	m_turnSpeed = g_gameConfigBlackboard.GetValue("aquariusTurnRate", 45.f);
 	m_maxHealth = g_gameConfigBlackboard.GetValue("aquariusStartingHealth", 10.f);
@@ -147,13 +141,13 @@ void Aquarius::UpdateGameConfigXmlData()
 	m_fireAperture = g_gameConfigBlackboard.GetValue("aquariusFireAperture", 5.f);
 	m_fireRate = g_gameConfigBlackboard.GetValue("aquariusFireRate", 2.f);
 	m_bulletSpawnOffset = g_gameConfigBlackboard.GetValue("aquariusBulletSpawnOffset", 0.6f);
-	m_canTraverseWater = true;
+	SetPhysicsFlag(PHYSICS_FLAG_CAN_TRAVERSE_WATER, true);
 }
 
 void Aquarius::CreateTexture()
 {
 	m_entityBounds = AABB2(-0.5f, -0.5f, 0.5f, 0.5f);
-	m_texture = g_renderer->CreateOrGetTextureFromFile(g_gameConfigBlackboard.GetValue("aquariusTexturePath", "").c_str());
+	m_texture = GetOrCreateEntityTexture(g_gameConfigBlackboard.GetValue("aquariusTexturePath", ""), m_textureUVs);
 	AddVertsForAABB2D(m_shapeVerts, m_entityBounds, Rgba8::WHITE);
 }
 
@@ -15,7 +15,7 @@ protected:
 
 	virtual void Update(float deltaSeconds) override;
 	virtual Vec2 const UpdateEntityPathFinding(float deltaSeconds) override;
-	virtual void Render() const override;
+	virtual void Render(SpriteBatch2D& spriteBatch) const override;
 	virtual void DebugRender() const override;
 	virtual void UpdateGameConfigXmlData() override;
 
@@ -3,7 +3,8 @@
 #include "Game/Game.hpp"
 #include "Game/Map.hpp"
 #include "Engine/Core/EngineCommon.hpp"
-#include "Engine/Renderer/RendererDX11.hpp"
+#include "Game/GameRenderer.hpp"
+#include "Engine/Renderer/SpriteBatch2D.hpp"
 #include "Engine/Core/VertexUtils.hpp"
 #include"Engine/Math/MathUtils.hpp"
 #include "Engine/Core/TileHeatMap.hpp"
@@ -19,22 +20,15 @@ Aries::Aries(Map* const& mapOwner, EntityFaction faction)
 
 void Aries::Update(float deltaSeconds)
 {
-	m_positionLastFrame = m_position;
+	m_positionLastFrame = GetPosition();
 	UpdateTimers(deltaSeconds);
 	UpdateEntityPathFinding(deltaSeconds);
 }
 
-void Aries::Render() const
+void Aries::Render(SpriteBatch2D& spriteBatch) const
 {
 	Vec2 fwrdNormal = GetForwardNormal();
-	std::vector<Vertex_PCU> worldVerts;
-	AddVertsForAABB2D(worldVerts, m_entityBounds, Rgba8::WHITE);
-
-	TransformVertexArrayXY3D(worldVerts, fwrdNormal, fwrdNormal.GetRotated90Degrees(), m_position);
-
-	g_renderer->SetBlendMode(BlendMode::ALPHA);
-	g_renderer->BindTexture(m_texture);
-	g_renderer->DrawVertexArray(worldVerts);
+	spriteBatch.AddQuad(m_texture, BlendMode::ALPHA, ENTITY_RENDER_LAYER_BODY, m_entityBounds, fwrdNormal, fwrdNormal.GetRotated90Degrees(), GetPosition(), Rgba8::WHITE, m_textureUVs);
 }
 
 void Aries::DebugRender() const
@@ -42,23 +36,23 @@ void Aries::DebugRender() const
 	std::vector<Vertex_PCU> debugVerts;
 
 	//Physics Ring
-	AddVertsForRing2D(debugVerts, m_position, m_physicsRadius, m_debugLineThickness, Rgba8(0, 255, 255));
+	AddVertsForRing2D(debugVerts, GetPosition(), GetPhysicsRadius(), m_debugLineThickness, Rgba8(0, 255, 255));
 
 	//Forward Vector
 	Vec2 vecFwrd = GetForwardNormal() * m_cosmeticRadius;
-	AddVertsForLineSegment2D(debugVerts, m_position, m_position + vecFwrd, m_debugLineThickness, Rgba8(255, 0, 0));
+	AddVertsForLineSegment2D(debugVerts, GetPosition(), GetPosition() + vecFwrd, m_debugLineThickness, Rgba8(255, 0, 0));
 
 	//Left Vector
 	Vec2 vecLeft = vecFwrd.GetRotated90Degrees();
-	AddVertsForLineSegment2D(debugVerts, m_position, m_position + vecLeft, m_debugLineThickness, Rgba8(0, 255, 0));
+	AddVertsForLineSegment2D(debugVerts, GetPosition(), GetPosition() + vecLeft, m_debugLineThickness, Rgba8(0, 255, 0));
 
 	//Velocity Line
-	AddVertsForLineSegment2D(debugVerts, m_position, m_position + m_velocity, m_debugLineThickness, Rgba8(255, 255, 0));
+	AddVertsForLineSegment2D(debugVerts, GetPosition(), GetPosition() + GetVelocity(), m_debugLineThickness, Rgba8(255, 255, 0));
 
 	if (m_chasingPlayerLocation)
 	{
 		//Line to Target Pos
-		AddVertsForLineSegment2D(debugVerts, m_position, m_targetPos, m_debugLineThickness, Rgba8(0, 0, 0, 100));
+		AddVertsForLineSegment2D(debugVerts, GetPosition(), m_targetPos, m_debugLineThickness, Rgba8(0, 0, 0, 100));
 		AddVertsForDisc2D(debugVerts, m_targetPos, 0.05f, Rgba8::BLACK);
 	}
 
@@ -69,7 +63,7 @@ void Aries::DebugRender() const
 
 void Aries::UpdateGameConfigXmlData()
 {
-	m_physicsRadius = g_gameConfigBlackboard.GetValue("ariesPhysicsRadius", 0.35f);
+	SetPhysicsRadius(g_gameConfigBlackboard.GetValue("ariesPhysicsRadius", 0.35f));
 	m_moveSpeed = g_gameConfigBlackboard.GetValue("ariesDriveSpeed", 0.5f);
 	m_turnSpeed = g_gameConfigBlackboard.GetValue("ariesTurnRate", 45.f);
 	m_maxHealth = g_gameConfigBlackboard.GetValue("ariesStartingHealth", 10.f);
@@ -77,19 +71,19 @@ void Aries::UpdateGameConfigXmlData()
 	m_sightRange = g_gameConfigBlackboard.GetValue("ariesSightRange", 7.f);
 	m_shieldAperture = g_gameConfigBlackboard.GetValue("ariesShieldAperture", 115.f);
 	m_driveAperture = g_gameConfigBlackboard.GetValue("ariesDriveAperture", 90.f);
-	m_canTraverseWater = false;
+	SetPhysicsFlag(PHYSICS_FLAG_CAN_TRAVERSE_WATER, false);
 }
 
 
 bool Aries::DidBulletHitShield(Vec2 const& bulletPos) const
 {
-	return IsPointInsideDirectedSector2D(bulletPos, m_position, GetForwardNormal(), m_shieldAperture, m_physicsRadius);
+	return IsPointInsideDirectedSector2D(bulletPos, GetPosition(), GetForwardNormal(), m_shieldAperture, GetPhysicsRadius());
 }
 
 void Aries::CreateTexture()
 {
 	m_entityBounds = AABB2(-0.5f, -0.5f, 0.5f, 0.5f);
-	m_texture = g_renderer->CreateOrGetTextureFromFile(g_gameConfigBlackboard.GetValue("ariesTexturePath", "").c_str());
+	m_texture = GetOrCreateEntityTexture(g_gameConfigBlackboard.GetValue("ariesTexturePath", ""), m_textureUVs);
 	AddVertsForAABB2D(m_shapeVerts, m_entityBounds, Rgba8::WHITE);
 }
 
@@ -0,0 +1,1392 @@
+#include "Game/Benchmarks.hpp"
+#include "Game/GameCommon.hpp"
+#include "Game/Game.hpp"
+#include "Game/Map.hpp"
+
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Core/Time.hpp"
+#include "Engine/Core/VertexUtils.hpp"
+#include "Engine/Core/Image.hpp"
+#include "Engine/Core/ImageLoadJob.hpp"
+#include "Engine/Core/CookedImage.hpp"
+#include "Engine/Core/FileUtils.hpp"
+#include "Engine/Core/JobSystem.hpp"
+#include "Engine/Core/StaticMeshUtils.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/FloatRange.hpp"
+#include "Engine/Math/OBB2.hpp"
+#include "Engine/Renderer/RenderQueue.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Engine/Renderer/TextureAtlas.hpp"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+
+void SubscribeBenchmarkEvents()
+{
+	Strings discKernelArguments;
+	discKernelArguments.push_back("Count=");
+	discKernelArguments.push_back("Iterations=");
+	SubscribeEventCallbackFunction("BenchmarkDiscKernels", discKernelArguments, Event_BenchmarkDiscKernels);
+
+	Strings renderQueueArguments;
+	renderQueueArguments.push_back("Count=");
+	renderQueueArguments.push_back("Textures=");
+	renderQueueArguments.push_back("Iterations=");
+	SubscribeEventCallbackFunction("BenchmarkRenderQueue", renderQueueArguments, Event_BenchmarkRenderQueue);
+
+	Strings vertexTransformArguments;
+	vertexTransformArguments.push_back("Count=");
+	vertexTransformArguments.push_back("Iterations=");
+	SubscribeEventCallbackFunction("BenchmarkVertexTransforms", vertexTransformArguments, Event_BenchmarkVertexTransforms);
+
+	Strings textureLoadArguments;
+	textureLoadArguments.push_back("Folder=");
+	SubscribeEventCallbackFunction("BenchmarkTextureLoads", textureLoadArguments, Event_BenchmarkTextureLoads);
+
+	Strings imageIngestArguments;
+	imageIngestArguments.push_back("Size=");
+	imageIngestArguments.push_back("Iterations=");
+	SubscribeEventCallbackFunction("BenchmarkImageIngest", imageIngestArguments, Event_BenchmarkImageIngest);
+
+	Strings cookTextureArguments;
+	cookTextureArguments.push_back("Folder=");
+	cookTextureArguments.push_back("Cooked=");
+	cookTextureArguments.push_back("Mips=");
+	SubscribeEventCallbackFunction("CookTextures", cookTextureArguments, Event_CookTextures);
+
+	Strings fileReadArguments;
+	fileReadArguments.push_back("Folder=");
+	SubscribeEventCallbackFunction("BenchmarkFileReads", fileReadArguments, Event_BenchmarkFileReads);
+
+	Strings objParseArguments;
+	objParseArguments.push_back("Count=");
+	objParseArguments.push_back("File=");
+	SubscribeEventCallbackFunction("BenchmarkOBJParse", objParseArguments, Event_BenchmarkOBJParse);
+
+	Strings textParseArguments;
+	textParseArguments.push_back("Count=");
+	textParseArguments.push_back("Iterations=");
+	SubscribeEventCallbackFunction("BenchmarkTextParsing", textParseArguments, Event_BenchmarkTextParsing);
+
+	Strings tileChunkArguments;
+	tileChunkArguments.push_back("Iterations=");
+	SubscribeEventCallbackFunction("BenchmarkTileChunks", tileChunkArguments, Event_BenchmarkTileChunks);
+
+	SubscribeEventCallbackFunction("BenchmarkTextureAtlas", Event_BenchmarkTextureAtlas);
+
+	Strings quadVertArguments;
+	quadVertArguments.push_back("Count=");
+	quadVertArguments.push_back("Iterations=");
+	SubscribeEventCallbackFunction("BenchmarkQuadVerts", quadVertArguments, Event_BenchmarkQuadVerts);
+}
+
+//Helpers
+//-----------------------------------------------------------------------------------------------
+template <typename T_Kernel>
+static double TimeKernel(int numIterations, T_Kernel const& runKernel)
+{
+	double startTime = GetCurrentTimeSeconds();
+	for (int iteration = 0; iteration < numIterations; ++iteration)
+	{
+		runKernel();
+	}
+	return GetCurrentTimeSeconds() - startTime;
+}
+
+//Prints the timings and treats a fast path whose output strays from the reference by more than tolerance as a bug, not a result
+static bool ReportKernelComparison(char const* kernelName, double referenceSeconds, double fastSeconds, float mismatch, float tolerance = 0.f)
+{
+	double speedup = (fastSeconds > 0.0) ? (referenceSeconds / fastSeconds) : 0.0;
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("%-26s reference %8.3fms  fast %8.3fms  x%.2f  mismatch %g", kernelName, referenceSeconds * 1000.0, fastSeconds * 1000.0, speedup, mismatch), 0.75f, true);
+	if (mismatch <= tolerance)
+		return true;
+
+	g_devConsole->AddLine(DevConsole::ERROR, Stringf("%s does not match its reference (mismatch %g, tolerance %g)", kernelName, mismatch, tolerance), 0.75f, true);
+	ERROR_RECOVERABLE(Stringf("Benchmark kernel %s does not match its reference (mismatch %g, tolerance %g)", kernelName, mismatch, tolerance));
+	return false;
+}
+
+//Times the reference and the fast path the same way, then checks the fast path's last output against the reference's
+template <typename T_Reference, typename T_Fast, typename T_GetMismatch>
+static bool CompareKernels(char const* kernelName, int numIterations, T_Reference const& runReference, T_Fast const& runFast, T_GetMismatch const& getMismatch, float tolerance = 0.f)
+{
+	double referenceSeconds = TimeKernel(numIterations, runReference);
+	double fastSeconds = TimeKernel(numIterations, runFast);
+	return ReportKernelComparison(kernelName, referenceSeconds, fastSeconds, getMismatch(), tolerance);
+}
+
+static float GetMaxDifference(std::vector<float> const& valuesA, std::vector<float> const& valuesB)
+{
+	if (valuesA.size() != valuesB.size())
+		return INFINITY;
+
+	float maxDifference = 0.f;
+	for (int valueNum = 0; valueNum < static_cast<int>(valuesA.size()); ++valueNum)
+	{
+		maxDifference = fmaxf(maxDifference, fabsf(valuesA[valueNum] - valuesB[valueNum]));
+	}
+	return maxDifference;
+}
+
+//Disc kernels
+//-----------------------------------------------------------------------------------------------
+//The entity push and bullet passes walk the physics tables with GetFirstOverlappingDiscIndexBatch2D and resolve pushes with
+//the batch push kernels. Each is checked here against the scalar loop it replaced, including discs sharing a center
+bool Event_BenchmarkDiscKernels(EventArgs& args)
+{
+	int numDiscs = GetClampedInt(args.GetValue("Count", 1024, true), 2, 16384);
+	int numIterations = std::max(args.GetValue("Iterations", 20, true), 1);
+	int numPairs = numDiscs / 2; //pair kernels push disc n against disc numPairs + n
+
+	//discs scattered over a small map so a realistic fraction of them overlap, a few stacked on the previous disc or their pair
+	const float FIELD_SIZE = 32.f;
+	std::vector<float> centersX(numDiscs);
+	std::vector<float> centersY(numDiscs);
+	std::vector<float> radii(numDiscs);
+	for (int discNum = 0; discNum < numDiscs; ++discNum)
+	{
+		int stackedOnNum = (discNum < numPairs) ? discNum - 1 : discNum - numPairs;
+		bool isStacked = stackedOnNum >= 0 && g_rng->RollWithPercentChance(0.05f);
+		centersX[discNum] = isStacked ? centersX[stackedOnNum] : g_rng->RollRandomFloatInRange(0.f, FIELD_SIZE);
+		centersY[discNum] = isStacked ? centersY[stackedOnNum] : g_rng->RollRandomFloatInRange(0.f, FIELD_SIZE);
+		radii[discNum] = g_rng->RollRandomFloatInRange(0.2f, 0.6f);
+	}
+
+	g_devConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("Disc kernels: %d discs, %d iterations", numDiscs, numIterations), 0.75f, true);
+
+	//every overlapping pair, found by restarting after each hit the way Map's passes do
+	std::vector<int> referencePairs;
+	std::vector<int> batchPairs;
+	auto runReference = [&]()
+	{
+		referencePairs.clear();
+		for (int discNum = 0; discNum < numDiscs; ++discNum)
+		{
+			Vec2 center(centersX[discNum], centersY[discNum]);
+			for (int otherNum = discNum + 1; otherNum < numDiscs; ++otherNum)
+			{
+				if (DoDiscsOverlap(center, radii[discNum], Vec2(centersX[otherNum], centersY[otherNum]), radii[otherNum]))
+				{
+					referencePairs.push_back(discNum * numDiscs + otherNum);
+				}
+			}
+		}
+	};
+	auto runBatch = [&]()
+	{
+		batchPairs.clear();
+		for (int discNum = 0; discNum < numDiscs; ++discNum)
+		{
+			Vec2 center(centersX[discNum], centersY[discNum]);
+			int otherNum = GetFirstOverlappingDiscIndexBatch2D(center, radii[discNum], centersX.data(), centersY.data(), radii.data(), discNum + 1, numDiscs);
+			for (; otherNum >= 0; otherNum = GetFirstOverlappingDiscIndexBatch2D(center, radii[discNum], centersX.data(), centersY.data(), radii.data(), otherNum + 1, numDiscs))
+			{
+				batchPairs.push_back(discNum * numDiscs + otherNum);
+			}
+		}
+	};
+	auto getMismatch = [&]()
+	{
+		return (referencePairs == batchPairs) ? 0.f : 1.f;
+	};
+	bool areAllMatching = CompareKernels("GetFirstOverlappingDisc", numIterations, runReference, runBatch, getMismatch);
+
+	//push kernels: positions and push counts must agree with the scalar functions, one disc sits on the fixed disc's center
+	Vec2 fieldCenter(FIELD_SIZE * 0.5f, FIELD_SIZE * 0.5f);
+	float fixedRadius = FIELD_SIZE * 0.25f;
+	AABB2 fixedBox(fieldCenter - Vec2(fixedRadius, fixedRadius), fieldCenter + Vec2(fixedRadius, fixedRadius));
+	centersX[0] = fieldCenter.x;
+	centersY[0] = fieldCenter.y;
+
+	const float PUSH_TOLERANCE = 1e-5f;
+	std::vector<float> referenceX;
+	std::vector<float> referenceY;
+	std::vector<float> batchX;
+	std::vector<float> batchY;
+	int numReferencePushed = 0;
+	int numBatchPushed = 0;
+	auto getPushMismatch = [&]()
+	{
+		if (numReferencePushed != numBatchPushed)
+			return INFINITY;
+
+		return std::max(GetMaxDifference(referenceX, batchX), GetMaxDifference(referenceY, batchY));
+	};
+	auto resetReference = [&]()
+	{
+		referenceX = centersX;
+		referenceY = centersY;
+		numReferencePushed = 0;
+	};
+	auto resetBatch = [&]()
+	{
+		batchX = centersX;
+		batchY = centersY;
+	};
+
+	//PushDiscsOutOfEachOther, N pairs
+	auto runPushApartReference = [&]()
+	{
+		resetReference();
+		for (int pairNum = 0; pairNum < numPairs; ++pairNum)
+		{
+			Vec2 discA(referenceX[pairNum], referenceY[pairNum]);
+			Vec2 discB(referenceX[numPairs + pairNum], referenceY[numPairs + pairNum]);
+			if (PushDiscsOutOfEachOther2D(discA, radii[pairNum], discB, radii[numPairs + pairNum]))
+			{
+				referenceX[pairNum] = discA.x;
+				referenceY[pairNum] = discA.y;
+				referenceX[numPairs + pairNum] = discB.x;
+				referenceY[numPairs + pairNum] = discB.y;
+				numReferencePushed++;
+			}
+		}
+	};
+	auto runPushApartBatch = [&]()
+	{
+		resetBatch();
+		numBatchPushed = PushDiscsOutOfEachOtherBatch2D(batchX.data(), batchY.data(), radii.data(), batchX.data() + numPairs, batchY.data() + numPairs, radii.data() + numPairs, numPairs);
+	};
+	areAllMatching &= CompareKernels("PushDiscsOutOfEachOther", numIterations, runPushApartReference, runPushApartBatch, getPushMismatch, PUSH_TOLERANCE);
+
+	//PushDiscOutOfFixedDisc, one fixed disc vs N
+	auto runFixedDiscReference = [&]()
+	{
+		resetReference();
+		for (int discNum = 0; discNum < numDiscs; ++discNum)
+		{
+			Vec2 disc(referenceX[discNum], referenceY[discNum]);
+			if (PushDiscOutOfFixedDisc2D(disc, radii[discNum], fieldCenter, fixedRadius))
+			{
+				referenceX[discNum] = disc.x;
+				referenceY[discNum] = disc.y;
+				numReferencePushed++;
+			}
+		}
+	};
+	auto runFixedDiscBatch = [&]()
+	{
+		resetBatch();
+		numBatchPushed = PushDiscsOutOfFixedDiscBatch2D(batchX.data(), batchY.data(), radii.data(), numDiscs, fieldCenter, fixedRadius);
+	};
+	areAllMatching &= CompareKernels("PushDiscOutOfFixedDisc", numIterations, runFixedDiscReference, runFixedDiscBatch, getPushMismatch, PUSH_TOLERANCE);
+
+	//PushDiscOutOfFixedDisc, N pairs, the second half stays fixed
+	auto runFixedDiscsReference = [&]()
+	{
+		resetReference();
+		for (int pairNum = 0; pairNum < numPairs; ++pairNum)
+		{
+			Vec2 disc(referenceX[pairNum], referenceY[pairNum]);
+			if (PushDiscOutOfFixedDisc2D(disc, radii[pairNum], Vec2(referenceX[numPairs + pairNum], referenceY[numPairs + pairNum]), radii[numPairs + pairNum]))
+			{
+				referenceX[pairNum] = disc.x;
+				referenceY[pairNum] = disc.y;
+				numReferencePushed++;
+			}
+		}
+	};
+	auto runFixedDiscsBatch = [&]()
+	{
+		resetBatch();
+		numBatchPushed = PushDiscsOutOfFixedDiscsBatch2D(batchX.data(), batchY.data(), radii.data(), batchX.data() + numPairs, batchY.data() + numPairs, radii.data() + numPairs, numPairs);
+	};
+	areAllMatching &= CompareKernels("PushDiscsOutOfFixedDiscs", numIterations, runFixedDiscsReference, runFixedDiscsBatch, getPushMismatch, PUSH_TOLERANCE);
+
+	//PushDiscOutOfFixedAABB, one fixed box vs N
+	auto runFixedBoxReference = [&]()
+	{
+		resetReference();
+		for (int discNum = 0; discNum < numDiscs; ++discNum)
+		{
+			Vec2 disc(referenceX[discNum], referenceY[discNum]);
+			if (PushDiscOutOfFixedAABB2D(disc, radii[discNum], fixedBox))
+			{
+				referenceX[discNum] = disc.x;
+				referenceY[discNum] = disc.y;
+				numReferencePushed++;
+			}
+		}
+	};
+	auto runFixedBoxBatch = [&]()
+	{
+		resetBatch();
+		numBatchPushed = PushDiscsOutOfFixedAABBBatch2D(batchX.data(), batchY.data(), radii.data(), numDiscs, fixedBox);
+	};
+	areAllMatching &= CompareKernels("PushDiscOutOfFixedAABB", numIterations, runFixedBoxReference, runFixedBoxBatch, getPushMismatch, PUSH_TOLERANCE);
+
+	//PushDiscOutOfFixedAABB, N pairs, each disc against the tile east of its own the way the wall pass batches a direction
+	std::vector<float> boxMinsX(numDiscs);
+	std::vector<float> boxMinsY(numDiscs);
+	std::vector<float> boxMaxsX(numDiscs);
+	std::vector<float> boxMaxsY(numDiscs);
+	for (int discNum = 0; discNum < numDiscs; ++discNum)
+	{
+		boxMinsX[discNum] = floorf(centersX[discNum]) + 1.f;
+		boxMinsY[discNum] = floorf(centersY[discNum]);
+		boxMaxsX[discNum] = boxMinsX[discNum] + 1.f;
+		boxMaxsY[discNum] = boxMinsY[discNum] + 1.f;
+	}
+
+	auto runTileBoxesReference = [&]()
+	{
+		resetReference();
+		for (int discNum = 0; discNum < numDiscs; ++discNum)
+		{
+			Vec2 disc(referenceX[discNum], referenceY[discNum]);
+			if (PushDiscOutOfFixedAABB2D(disc, radii[discNum], AABB2(boxMinsX[discNum], boxMinsY[discNum], boxMaxsX[discNum], boxMaxsY[discNum])))
+			{
+				referenceX[discNum] = disc.x;
+				referenceY[discNum] = disc.y;
+				numReferencePushed++;
+			}
+		}
+	};
+	auto runTileBoxesBatch = [&]()
+	{
+		resetBatch();
+		numBatchPushed = PushDiscsOutOfFixedAABBsBatch2D(batchX.data(), batchY.data(), radii.data(), boxMinsX.data(), boxMinsY.data(), boxMaxsX.data(), boxMaxsY.data(), numDiscs);
+	};
+	areAllMatching &= CompareKernels("PushDiscsOutOfFixedAABBs", numIterations, runTileBoxesReference, runTileBoxesBatch, getPushMismatch, PUSH_TOLERANCE);
+	return areAllMatching;
+}
+
+//Render queue
+//-----------------------------------------------------------------------------------------------
+bool Event_BenchmarkRenderQueue(EventArgs& args)
+{
+	int numPackets = std::max(args.GetValue("Count", 2000, true), 1);
+	int numTextures = GetClampedInt(args.GetValue("Textures", 8, true), 1, 256);
+	int numIterations = std::max(args.GetValue("Iterations", 100, true), 1);
+
+	//the null backend never dereferences textures, so distinct addresses are enough to tell them apart
+	static char s_fakeTextures[256];
+	std::vector<Texture*> packetTextures(numPackets);
+	std::vector<BlendMode> packetBlendModes(numPackets);
+	std::vector<int> packetLayers(numPackets);
+	for (int packetNum = 0; packetNum < numPackets; ++packetNum)
+	{
+		packetTextures[packetNum] = reinterpret_cast<Texture*>(&s_fakeTextures[g_rng->RollRandomIntInRange(0, numTextures - 1)]);
+		packetBlendModes[packetNum] = g_rng->RollWithPercentChance(0.25f) ? BlendMode::ADDITIVE : BlendMode::ALPHA;
+		packetLayers[packetNum] = g_rng->RollRandomIntInRange(0, 5);
+	}
+
+	Vertex_PCU quadVerts[6];
+	RenderQueue renderQueue;
+	auto fillQueue = [&]()
+	{
+		renderQueue.Begin();
+		for (int packetNum = 0; packetNum < numPackets; ++packetNum)
+		{
+			renderQueue.AddDraw(packetLayers[packetNum], packetBlendModes[packetNum], nullptr, packetTextures[packetNum], 6, quadVerts);
+		}
+	};
+
+	g_devConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("Render queue: %d packets, %d textures, %d iterations", numPackets, numTextures, numIterations), 0.75f, true);
+
+	//submission order, every packet that differs from the one before costs a state change and a draw
+	NullRenderBackend unsortedBackend;
+	for (int packetNum = 0; packetNum < numPackets; ++packetNum)
+	{
+		if (packetNum == 0 || packetBlendModes[packetNum] != packetBlendModes[packetNum - 1])
+		{
+			unsortedBackend.SetBlendMode(packetBlendModes[packetNum]);
+		}
+		if (packetNum == 0 || packetTextures[packetNum] != packetTextures[packetNum - 1])
+		{
+			unsortedBackend.BindTexture(packetTextures[packetNum]);
+		}
+		unsortedBackend.DrawVertexArray(6, quadVerts);
+	}
+
+	NullRenderBackend sortedBackend;
+	fillQueue();
+	renderQueue.Execute(&sortedBackend);
+
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Unsorted  draws %5d  blend %5d  texture %5d", unsortedBackend.m_numDrawCalls, unsortedBackend.m_numBlendModeCalls, unsortedBackend.m_numTextureBinds), 0.75f, true);
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("Sorted    draws %5d  blend %5d  texture %5d", sortedBackend.m_numDrawCalls, sortedBackend.m_numBlendModeCalls, sortedBackend.m_numTextureBinds), 0.75f, true);
+
+	//radix sort against a comparison sort on the same keys
+	fillQueue();
+	std::vector<RenderSortEntry> sourceEntries;
+	sourceEntries.reserve(numPackets);
+	for (int packetNum = 0; packetNum < numPackets; ++packetNum)
+	{
+		RenderSortEntry entry;
+		entry.m_sortKey = MakeRenderSortKey(packetLayers[packetNum], packetBlendModes[packetNum], 0, static_cast<int>(reinterpret_cast<char*>(packetTextures[packetNum]) - s_fakeTextures));
+		entry.m_index = packetNum;
+		sourceEntries.push_back(entry);
+	}
+
+	std::vector<RenderSortEntry> comparisonEntries;
+	std::vector<RenderSortEntry> radixEntries;
+	std::vector<RenderSortEntry> scratch;
+	auto runComparisonSort = [&]()
+	{
+		comparisonEntries = sourceEntries;
+		std::stable_sort(comparisonEntries.begin(), comparisonEntries.end(), [](RenderSortEntry const& a, RenderSortEntry const& b) { return a.m_sortKey < b.m_sortKey; });
+	};
+	auto runRadixSort = [&]()
+	{
+		radixEntries = sourceEntries;
+		RadixSortRenderEntries(radixEntries, scratch);
+	};
+	auto getMismatch = [&]()
+	{
+		int numMismatches = 0;
+		for (int entryNum = 0; entryNum < numPackets; ++entryNum)
+		{
+			numMismatches += (radixEntries[entryNum].m_index != comparisonEntries[entryNum].m_index) ? 1 : 0;
+		}
+		return static_cast<float>(numMismatches);
+	};
+	return CompareKernels("RadixSortRenderEntries", numIterations, runComparisonSort, runRadixSort, getMismatch);
+}
+
+//Vertex transforms
+//-----------------------------------------------------------------------------------------------
+static float GetMaxPositionDifference(std::vector<Vertex_PCU> const& vertsA, std::vector<Vertex_PCU> const& vertsB)
+{
+	if (vertsA.size() != vertsB.size())
+		return INFINITY;
+
+	float maxDifference = 0.f;
+	for (int vertNum = 0; vertNum < static_cast<int>(vertsA.size()); ++vertNum)
+	{
+		maxDifference = fmaxf(maxDifference, fabsf(vertsA[vertNum].m_position.x - vertsB[vertNum].m_position.x));
+		maxDifference = fmaxf(maxDifference, fabsf(vertsA[vertNum].m_position.y - vertsB[vertNum].m_position.y));
+	}
+	return maxDifference;
+}
+
+//The generators as they were before the shared unit circle tables, trig for every slice
+static void AddVertsForDisc2DReference(Verts& verts, Vec2 const& discCenter, float discRadius, Rgba8 const& color, int numSlices)
+{
+	float degreesPerSlice = 360.f / static_cast<float>(numSlices);
+	float sliceEndTheta = 0.f;
+	for (int sliceNum = 0; sliceNum < numSlices; ++sliceNum)
+	{
+		float sliceStartTheta = sliceEndTheta;
+		sliceEndTheta = sliceStartTheta + degreesPerSlice;
+		verts.push_back(Vertex_PCU(discCenter, color));
+		verts.push_back(Vertex_PCU(discCenter + Vec2::MakeFromPolarDegrees(sliceStartTheta, discRadius), color));
+		verts.push_back(Vertex_PCU(discCenter + Vec2::MakeFromPolarDegrees(sliceEndTheta, discRadius), color));
+	}
+}
+
+static void AddVertsForRing2DReference(Verts& verts, Vec2 const& center, float radius, float thickness, Rgba8 const& color)
+{
+	float innerRadius = radius - 0.5f * thickness;
+	float outerRadius = radius + 0.5f * thickness;
+	constexpr int NUM_SIDES = 32;
+	constexpr float DEGREES_PER_SIDE = 360.f / static_cast<float>(NUM_SIDES);
+	for (int sideNum = 0; sideNum < NUM_SIDES; ++sideNum)
+	{
+		Vec2 startDirection = Vec2::MakeFromPolarDegrees(DEGREES_PER_SIDE * static_cast<float>(sideNum));
+		Vec2 endDirection = Vec2::MakeFromPolarDegrees(DEGREES_PER_SIDE * static_cast<float>(sideNum + 1));
+		Vertex_PCU innerStart(center + startDirection * innerRadius, color);
+		Vertex_PCU outerStart(center + startDirection * outerRadius, color);
+		Vertex_PCU outerEnd(center + endDirection * outerRadius, color);
+		Vertex_PCU innerEnd(center + endDirection * innerRadius, color);
+		verts.push_back(innerEnd);
+		verts.push_back(innerStart);
+		verts.push_back(outerStart);
+		verts.push_back(innerEnd);
+		verts.push_back(outerStart);
+		verts.push_back(outerEnd);
+	}
+}
+
+static void AddVertsForCapsule2DReference(Verts& verts, Vec2 const& boneStart, Vec2 const& boneEnd, float radius, Rgba8 const& color)
+{
+	Vec2 forwardStep = boneEnd - boneStart;
+	forwardStep.SetLength(radius);
+	Vec2 leftStep = forwardStep.GetRotated90Degrees();
+	verts.push_back(Vertex_PCU(boneStart - leftStep, color));
+	verts.push_back(Vertex_PCU(boneEnd - leftStep, color));
+	verts.push_back(Vertex_PCU(boneEnd + leftStep, color));
+	verts.push_back(Vertex_PCU(boneStart + leftStep, color));
+	verts.push_back(Vertex_PCU(boneStart - leftStep, color));
+	verts.push_back(Vertex_PCU(boneEnd + leftStep, color));
+
+	constexpr int NUM_SLICES = 16;
+	constexpr float DEGREES_PER_SLICE = 180.f / static_cast<float>(NUM_SLICES);
+	float endCapTheta = forwardStep.GetOrientationDegrees() - 90.f;
+	float startCapTheta = endCapTheta + 180.f;
+	for (int sliceNum = 0; sliceNum < NUM_SLICES; ++sliceNum)
+	{
+		verts.push_back(Vertex_PCU(boneEnd, color));
+		verts.push_back(Vertex_PCU(boneEnd + Vec2::MakeFromPolarDegrees(endCapTheta, radius), color));
+		endCapTheta += DEGREES_PER_SLICE;
+		verts.push_back(Vertex_PCU(boneEnd + Vec2::MakeFromPolarDegrees(endCapTheta, radius), color));
+
+		verts.push_back(Vertex_PCU(boneStart, color));
+		verts.push_back(Vertex_PCU(boneStart + Vec2::MakeFromPolarDegrees(startCapTheta, radius), color));
+		startCapTheta += DEGREES_PER_SLICE;
+		verts.push_back(Vertex_PCU(boneStart + Vec2::MakeFromPolarDegrees(startCapTheta, radius), color));
+	}
+}
+
+bool Event_BenchmarkVertexTransforms(EventArgs& args)
+{
+	//defaults to about one entity's worth of verts transformed for a few thousand entities
+	int numVerts = std::max(args.GetValue("Count", 240, true), 1);
+	int numIterations = std::max(args.GetValue("Iterations", 5000, true), 1);
+
+	std::vector<Vertex_PCU> sourceVerts;
+	sourceVerts.reserve(numVerts);
+	for (int vertNum = 0; vertNum < numVerts; ++vertNum)
+	{
+		Vec3 position(g_rng->RollRandomFloatInRange(-1.f, 1.f), g_rng->RollRandomFloatInRange(-1.f, 1.f), 0.f);
+		sourceVerts.push_back(Vertex_PCU(position, Rgba8::WHITE, Vec2::ZERO));
+	}
+
+	float scale = 1.5f;
+	float rotationDegrees = 37.f;
+	Vec2 translation(12.f, 7.f);
+	Vec2 iBasis = Vec2::MakeFromPolarDegrees(rotationDegrees, scale);
+	Vec2 jBasis = iBasis.GetRotated90Degrees();
+
+	g_devConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("Vertex transforms: %d verts, %d iterations", numVerts, numIterations), 0.75f, true);
+
+	//I J basis, scalar reference against the SSE kernel. Both do the same multiplies and adds in the same order
+	std::vector<Vertex_PCU> scalarVerts;
+	std::vector<Vertex_PCU> batchVerts;
+	auto getPositionMismatch = [&]()
+	{
+		return GetMaxPositionDifference(scalarVerts, batchVerts);
+	};
+	auto runScalarBasis = [&]()
+	{
+		scalarVerts = sourceVerts;
+		TransformVertexArrayXY3DScalar(numVerts, scalarVerts.data(), iBasis, jBasis, translation);
+	};
+	auto runBatchBasis = [&]()
+	{
+		batchVerts = sourceVerts;
+		TransformVertexArrayXY3D(numVerts, batchVerts.data(), iBasis, jBasis, translation);
+	};
+
+	//scale and rotation, the old per vert path against the basis built once. The old path rounds its own sin and cos
+	//per vert, so a few ulps of the translated position are allowed
+	auto runScalarDegrees = [&]()
+	{
+		scalarVerts = sourceVerts;
+		for (int vertNum = 0; vertNum < numVerts; ++vertNum)
+		{
+			TransformPositionXY3D(scalarVerts[vertNum].m_position, scale, rotationDegrees, translation);
+		}
+	};
+	auto runBatchDegrees = [&]()
+	{
+		batchVerts = sourceVerts;
+		TransformVertexArrayXY3D(numVerts, batchVerts.data(), scale, rotationDegrees, translation);
+	};
+	bool areAllMatching = CompareKernels("TransformVertexArrayXY3D", numIterations, runScalarBasis, runBatchBasis, getPositionMismatch);
+	areAllMatching &= CompareKernels("TransformVertexArrayXY3D deg", numIterations, runScalarDegrees, runBatchDegrees, getPositionMismatch, 1e-4f);
+
+	//shape generators, table lookups against trig per slice. The old loops summed the slice angle and the capsule caps were
+	//trig at the bone angle rather than a rotated table, so the two round a little differently
+	constexpr int NUM_SHAPES = 64;
+	constexpr float SHAPE_TOLERANCE = 1e-4f;
+	int numShapeIterations = std::max(numIterations / 50, 1);
+	std::vector<Vec2> shapeCenters;
+	std::vector<Vec2> shapeEnds;
+	for (int shapeNum = 0; shapeNum < NUM_SHAPES; ++shapeNum)
+	{
+		shapeCenters.push_back(Vec2(g_rng->RollRandomFloatInRange(-10.f, 10.f), g_rng->RollRandomFloatInRange(-10.f, 10.f)));
+		shapeEnds.push_back(shapeCenters.back() + Vec2::MakeFromPolarDegrees(g_rng->RollRandomFloatInRange(0.f, 360.f), g_rng->RollRandomFloatInRange(0.5f, 4.f)));
+	}
+
+	auto runDiscsReference = [&]()
+	{
+		scalarVerts.clear();
+		for (int shapeNum = 0; shapeNum < NUM_SHAPES; ++shapeNum)
+		{
+			AddVertsForDisc2DReference(scalarVerts, shapeCenters[shapeNum], 2.f, Rgba8::WHITE, 1 + shapeNum % 64);
+		}
+	};
+	auto runDiscs = [&]()
+	{
+		batchVerts.clear();
+		for (int shapeNum = 0; shapeNum < NUM_SHAPES; ++shapeNum)
+		{
+			AddVertsForDisc2D(batchVerts, shapeCenters[shapeNum], 2.f, Rgba8::WHITE, 1 + shapeNum % 64);
+		}
+	};
+	areAllMatching &= CompareKernels("AddVertsForDisc2D", numShapeIterations, runDiscsReference, runDiscs, getPositionMismatch, SHAPE_TOLERANCE);
+
+	auto runRingsReference = [&]()
+	{
+		scalarVerts.clear();
+		for (int shapeNum = 0; shapeNum < NUM_SHAPES; ++shapeNum)
+		{
+			AddVertsForRing2DReference(scalarVerts, shapeCenters[shapeNum], 2.f, 0.25f, Rgba8::WHITE);
+		}
+	};
+	auto runRings = [&]()
+	{
+		batchVerts.clear();
+		for (int shapeNum = 0; shapeNum < NUM_SHAPES; ++shapeNum)
+		{
+			AddVertsForRing2D(batchVerts, shapeCenters[shapeNum], 2.f, 0.25f, Rgba8::WHITE);
+		}
+	};
+	areAllMatching &= CompareKernels("AddVertsForRing2D", numShapeIterations, runRingsReference, runRings, getPositionMismatch, SHAPE_TOLERANCE);
+
+	auto runCapsulesReference = [&]()
+	{
+		scalarVerts.clear();
+		for (int shapeNum = 0; shapeNum < NUM_SHAPES; ++shapeNum)
+		{
+			AddVertsForCapsule2DReference(scalarVerts, shapeCenters[shapeNum], shapeEnds[shapeNum], 0.75f, Rgba8::WHITE);
+		}
+	};
+	auto runCapsules = [&]()
+	{
+		batchVerts.clear();
+		for (int shapeNum = 0; shapeNum < NUM_SHAPES; ++shapeNum)
+		{
+			AddVertsForCapsule2D(batchVerts, shapeCenters[shapeNum], shapeEnds[shapeNum], 0.75f, Rgba8::WHITE);
+		}
+	};
+	areAllMatching &= CompareKernels("AddVertsForCapsule2D", numShapeIterations, runCapsulesReference, runCapsules, getPositionMismatch, SHAPE_TOLERANCE);
+	return areAllMatching;
+}
+
+//Texture loads
+//-----------------------------------------------------------------------------------------------
+static void GetImageFilePathsInFolder(std::string const& folderPath, Strings& out_imageFilePaths)
+{
+	std::error_code errorCode;
+	for (std::filesystem::recursive_directory_iterator fileIter(folderPath, errorCode), endIter; fileIter != endIter; fileIter.increment(errorCode))
+	{
+		std::string extension = fileIter->path().extension().string();
+		if (fileIter->is_regular_file() && (extension == ".png" || extension == ".jpg"))
+		{
+			out_imageFilePaths.push_back(fileIter->path().generic_string());
+		}
+	}
+}
+
+static bool AreImagesEqual(Image const& imageA, Image const& imageB)
+{
+	if (imageA.GetDimensions() != imageB.GetDimensions())
+		return false;
+
+	size_t numBytes = (size_t)imageA.GetDimensions().x * (size_t)imageA.GetDimensions().y * sizeof(Rgba8);
+	return memcmp(imageA.GetRawData(), imageB.GetRawData(), numBytes) == 0;
+}
+
+bool Event_BenchmarkTextureLoads(EventArgs& args)
+{
+	std::string folderPath = args.GetValue("Folder", "Data");
+
+	Strings imageFilePaths;
+	GetImageFilePathsInFolder(folderPath, imageFilePaths);
+	if (imageFilePaths.empty())
+	{
+		g_devConsole->AddLine(DevConsole::ERROR, Stringf("No .png or .jpg files found under \"%s\"", folderPath.c_str()), 0.75f, true);
+		return false;
+	}
+
+	int numWorkers = (g_jobSystem != nullptr) ? g_jobSystem->GetNumWorkers() : 0;
+	g_devConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("Texture loads: %d images under \"%s\", %d workers", (int)imageFilePaths.size(), folderPath.c_str(), numWorkers), 0.75f, true);
+	if (g_jobSystem == nullptr)
+		return false;
+
+	//serial decode on this thread, what every CreateOrGetTextureFromFile used to cost back to back
+	std::vector<Image*> serialImages;
+	double startTime = GetCurrentTimeSeconds();
+	for (int imageNum = 0; imageNum < (int)imageFilePaths.size(); ++imageNum)
+	{
+		serialImages.push_back(new Image(imageFilePaths[imageNum].c_str()));
+	}
+	double serialSeconds = GetCurrentTimeSeconds() - startTime;
+
+	//the same files as ImageLoadJobs, this thread helps until the queue is empty
+	std::vector<ImageLoadJob*> loadJobs;
+	startTime = GetCurrentTimeSeconds();
+	for (int imageNum = 0; imageNum < (int)imageFilePaths.size(); ++imageNum)
+	{
+		loadJobs.push_back(new ImageLoadJob(imageFilePaths[imageNum].c_str()));
+		g_jobSystem->QueueJob(loadJobs.back());
+	}
+	g_jobSystem->WaitForAllJobs();
+	double parallelSeconds = GetCurrentTimeSeconds() - startTime;
+
+	int numMismatches = 0;
+	for (int imageNum = 0; imageNum < (int)imageFilePaths.size(); ++imageNum)
+	{
+		Image* parallelImage = loadJobs[imageNum]->TakeImage();
+		if (parallelImage == nullptr || !AreImagesEqual(*serialImages[imageNum], *parallelImage))
+		{
+			numMismatches++;
+		}
+		delete parallelImage;
+		delete loadJobs[imageNum];
+		delete serialImages[imageNum];
+	}
+
+	return ReportKernelComparison("Image decode", serialSeconds, parallelSeconds, static_cast<float>(numMismatches));
+}
+
+bool Event_BenchmarkImageIngest(EventArgs& args)
+{
+	//defaults to a large sprite sheet's worth of texels
+	int imageSize = std::max(args.GetValue("Size", 2048, true), 1);
+	int numIterations = std::max(args.GetValue("Iterations", 10, true), 1);
+	int numTexels = imageSize * imageSize;
+
+	std::vector<unsigned char> rgbTexelData((size_t)numTexels * 3);
+	for (int byteNum = 0; byteNum < (int)rgbTexelData.size(); ++byteNum)
+	{
+		rgbTexelData[byteNum] = static_cast<unsigned char>(g_rng->RollRandomIntInRange(0, 255));
+	}
+
+	g_devConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("Image ingest: %dx%d, %d iterations", imageSize, imageSize, numIterations), 0.75f, true);
+
+	//3 channel decode output to RGBA8, the per texel reference against the SIMD expansion
+	std::vector<Rgba8> scalarTexels(numTexels);
+	std::vector<Rgba8> batchTexels(numTexels);
+	auto getTexelMismatch = [&]()
+	{
+		return (memcmp(scalarTexels.data(), batchTexels.data(), (size_t)numTexels * sizeof(Rgba8)) == 0) ? 0.f : 1.f;
+	};
+	auto runScalarExpand = [&]() { ExpandTexelsToRgba8Scalar(numTexels, rgbTexelData.data(), 3, scalarTexels.data()); };
+	auto runBatchExpand = [&]() { ExpandTexelsToRgba8(numTexels, rgbTexelData.data(), 3, batchTexels.data()); };
+	bool areAllMatching = CompareKernels("ExpandTexelsToRgba8 RGB", numIterations, runScalarExpand, runBatchExpand, getTexelMismatch);
+
+	//fill, the old per channel loop against FillTexels
+	Rgba8 fillColor(12, 34, 56, 78);
+	auto runScalarFill = [&]()
+	{
+		for (int texelNum = 0; texelNum < numTexels; ++texelNum)
+		{
+			scalarTexels[texelNum].r = fillColor.r;
+			scalarTexels[texelNum].g = fillColor.g;
+			scalarTexels[texelNum].b = fillColor.b;
+			scalarTexels[texelNum].a = fillColor.a;
+		}
+	};
+	auto runBatchFill = [&]() { FillTexels(numTexels, fillColor, batchTexels.data()); };
+	areAllMatching &= CompareKernels("FillTexels", numIterations, runScalarFill, runBatchFill, getTexelMismatch);
+
+	//full mip chains of the random texels, box as the baseline for the Kaiser filter's extra cost
+	ExpandTexelsToRgba8(numTexels, rgbTexelData.data(), 3, batchTexels.data());
+	Image sourceImage(IntVec2(imageSize, imageSize), Rgba8::WHITE);
+	for (int texelNum = 0; texelNum < numTexels; ++texelNum)
+	{
+		sourceImage.SetTexelColor(IntVec2(texelNum % imageSize, texelNum / imageSize), batchTexels[texelNum]);
+	}
+
+	std::vector<Image> mips;
+	double startTime = GetCurrentTimeSeconds();
+	sourceImage.GenerateMipChain(mips, MipFilter::BOX);
+	double boxSeconds = GetCurrentTimeSeconds() - startTime;
+
+	startTime = GetCurrentTimeSeconds();
+	sourceImage.GenerateMipChain(mips, MipFilter::KAISER);
+	double kaiserSeconds = GetCurrentTimeSeconds() - startTime;
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("%-26s box %8.3fms  kaiser %8.3fms  %d levels", "GenerateMipChain", boxSeconds * 1000.0, kaiserSeconds * 1000.0, (int)mips.size()), 0.75f, true);
+	return areAllMatching;
+}
+
+//Cooks every image under Folder= and checks each cook against a fresh stb decode, then times a cold load both ways
+bool Event_CookTextures(EventArgs& args)
+{
+	std::string folderPath = args.GetValue("Folder", "Data");
+	std::string cookedFolderPath = args.GetValue("Cooked", "Cooked/Textures");
+	bool generateMips = args.GetValue("Mips", false);
+
+	Strings imageFilePaths;
+	GetImageFilePathsInFolder(folderPath, imageFilePaths);
+	if (imageFilePaths.empty())
+	{
+		g_devConsole->AddLine(DevConsole::ERROR, Stringf("No .png or .jpg files found under \"%s\"", folderPath.c_str()), 0.75f, true);
+		return false;
+	}
+
+	int numCookFailures = 0;
+	int numMismatches = 0;
+	for (int imageNum = 0; imageNum < (int)imageFilePaths.size(); ++imageNum)
+	{
+		char const* imageFilePath = imageFilePaths[imageNum].c_str();
+		CookedImage cookedImage;
+		if (!CookImage(imageFilePath, cookedFolderPath.c_str(), generateMips) || !cookedImage.LoadFromFile(GetCookedImageFilePath(cookedFolderPath.c_str(), imageFilePath)))
+		{
+			g_devConsole->AddLine(DevConsole::ERROR, Stringf("Could not cook \"%s\"", imageFilePath), 0.75f, true);
+			numCookFailures++;
+			continue;
+		}
+
+		Image decodedImage(imageFilePath);
+		std::vector<Image> mips;
+		if (generateMips)
+		{
+			decodedImage.GenerateMipChain(mips);
+		}
+
+		int numExpectedLevels = std::min(1 + (int)mips.size(), MAX_COOKED_IMAGE_LEVELS);
+		bool doesCookMatch = cookedImage.GetNumLevels() == numExpectedLevels;
+		for (int levelIndex = 0; doesCookMatch && levelIndex < cookedImage.GetNumLevels(); ++levelIndex)
+		{
+			Image const& levelImage = (levelIndex == 0) ? decodedImage : mips[levelIndex - 1];
+			IntVec2 levelDims = levelImage.GetDimensions();
+			doesCookMatch = cookedImage.GetLevelDimensions(levelIndex) == levelDims && memcmp(cookedImage.GetLevelTexels(levelIndex), levelImage.GetRawData(), (size_t)levelDims.x * (size_t)levelDims.y * sizeof(Rgba8)) == 0;
+		}
+
+		if (!doesCookMatch)
+		{
+			g_devConsole->AddLine(DevConsole::ERROR, Stringf("Cook of \"%s\" does not match its stb decode", imageFilePath), 0.75f, true);
+			numMismatches++;
+		}
+	}
+
+	g_devConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("Cooked %d images under \"%s\" to \"%s\", %d failed, %d mismatched", (int)imageFilePaths.size() - numCookFailures, folderPath.c_str(), cookedFolderPath.c_str(), numCookFailures, numMismatches), 0.75f, true);
+
+	//a cold load decodes every file with stb, a cooked one reads level 0 straight into the image
+	double startTime = GetCurrentTimeSeconds();
+	for (int imageNum = 0; imageNum < (int)imageFilePaths.size(); ++imageNum)
+	{
+		Image decodedImage(imageFilePaths[imageNum].c_str());
+	}
+	double decodeSeconds = GetCurrentTimeSeconds() - startTime;
+
+	startTime = GetCurrentTimeSeconds();
+	for (int imageNum = 0; imageNum < (int)imageFilePaths.size(); ++imageNum)
+	{
+		Image* cookedImage = LoadImageThroughCookedCache(imageFilePaths[imageNum].c_str(), cookedFolderPath.c_str());
+		delete cookedImage;
+	}
+	double cookedSeconds = GetCurrentTimeSeconds() - startTime;
+
+	//round trip through the path textures actually load with, load(cook(x)) has to be x texel for texel and keep its name
+	for (int imageNum = 0; imageNum < (int)imageFilePaths.size(); ++imageNum)
+	{
+		char const* imageFilePath = imageFilePaths[imageNum].c_str();
+		Image decodedImage(imageFilePath);
+		Image* loadedImage = LoadImageThroughCookedCache(imageFilePath, cookedFolderPath.c_str());
+		IntVec2 dims = decodedImage.GetDimensions();
+		bool doesRoundTrip = loadedImage->GetDimensions() == dims && loadedImage->GetImageFilePath() == decodedImage.GetImageFilePath()
+			&& memcmp(loadedImage->GetRawData(), decodedImage.GetRawData(), (size_t)dims.x * (size_t)dims.y * sizeof(Rgba8)) == 0;
+		delete loadedImage;
+
+		if (!doesRoundTrip)
+		{
+			g_devConsole->AddLine(DevConsole::ERROR, Stringf("Loading the cook of \"%s\" does not give back its stb decode", imageFilePath), 0.75f, true);
+			numMismatches++;
+		}
+	}
+
+	return ReportKernelComparison("Load decoded vs cooked", decodeSeconds, cookedSeconds, static_cast<float>(numMismatches + numCookFailures));
+}
+
+//File reads
+//-----------------------------------------------------------------------------------------------
+static uint64_t SumFileBytes(std::string_view fileBytes, uint64_t sum)
+{
+	for (size_t byteNum = 0; byteNum < fileBytes.size(); ++byteNum)
+	{
+		sum += static_cast<uint8_t>(fileBytes[byteNum]);
+	}
+	return sum;
+}
+
+//Every file under Folder= read and summed four ways, whole buffer as the baseline for mapped, chunked and async reads
+bool Event_BenchmarkFileReads(EventArgs& args)
+{
+	std::string folderPath = args.GetValue("Folder", "Data");
+
+	Strings filePaths;
+	std::error_code errorCode;
+	for (std::filesystem::recursive_directory_iterator fileIter(folderPath, errorCode), endIter; fileIter != endIter; fileIter.increment(errorCode))
+	{
+		if (fileIter->is_regular_file())
+		{
+			filePaths.push_back(fileIter->path().generic_string());
+		}
+	}
+
+	g_devConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("File reads: %d files under \"%s\"", (int)filePaths.size(), folderPath.c_str()), 0.75f, true);
+	if (filePaths.empty())
+		return false;
+
+	uint64_t bufferSum = 0;
+	double startTime = GetCurrentTimeSeconds();
+	for (int fileNum = 0; fileNum < (int)filePaths.size(); ++fileNum)
+	{
+		std::vector<uint8_t> fileBuffer;
+		FileReadToBuffer(fileBuffer, filePaths[fileNum]);
+		bufferSum = SumFileBytes(std::string_view(reinterpret_cast<char const*>(fileBuffer.data()), fileBuffer.size()), bufferSum);
+	}
+	double bufferSeconds = GetCurrentTimeSeconds() - startTime;
+
+	uint64_t mappedSum = 0;
+	startTime = GetCurrentTimeSeconds();
+	for (int fileNum = 0; fileNum < (int)filePaths.size(); ++fileNum)
+	{
+		MappedFile mappedFile;
+		mappedFile.Open(filePaths[fileNum]);
+		mappedSum = SumFileBytes(mappedFile.GetView(), mappedSum);
+	}
+	double mappedSeconds = GetCurrentTimeSeconds() - startTime;
+	bool areAllMatching = ReportKernelComparison("MappedFile", bufferSeconds, mappedSeconds, (mappedSum == bufferSum) ? 0.f : 1.f);
+
+	uint64_t chunkedSum = 0;
+	FileChunkReader chunkReader;
+	startTime = GetCurrentTimeSeconds();
+	for (int fileNum = 0; fileNum < (int)filePaths.size(); ++fileNum)
+	{
+		chunkReader.Open(filePaths[fileNum]);
+		while (chunkReader.ReadNextChunk())
+		{
+			chunkedSum = SumFileBytes(chunkReader.GetChunk(), chunkedSum);
+		}
+	}
+	chunkReader.Close();
+	double chunkedSeconds = GetCurrentTimeSeconds() - startTime;
+	areAllMatching &= ReportKernelComparison("FileChunkReader", bufferSeconds, chunkedSeconds, (chunkedSum == bufferSum) ? 0.f : 1.f);
+
+	if (g_jobSystem == nullptr)
+		return areAllMatching;
+
+	uint64_t asyncSum = 0;
+	std::vector<FileReadJob*> readJobs;
+	startTime = GetCurrentTimeSeconds();
+	for (int fileNum = 0; fileNum < (int)filePaths.size(); ++fileNum)
+	{
+		readJobs.push_back(FileReadAsync(g_jobSystem, filePaths[fileNum]));
+	}
+	for (int fileNum = 0; fileNum < (int)readJobs.size(); ++fileNum)
+	{
+		g_jobSystem->WaitForJob(readJobs[fileNum]);
+		std::vector<uint8_t>& fileBuffer = readJobs[fileNum]->GetBuffer();
+		asyncSum = SumFileBytes(std::string_view(reinterpret_cast<char const*>(fileBuffer.data()), fileBuffer.size()), asyncSum);
+		delete readJobs[fileNum];
+	}
+	double asyncSeconds = GetCurrentTimeSeconds() - startTime;
+	areAllMatching &= ReportKernelComparison("FileReadAsync", bufferSeconds, asyncSeconds, (asyncSum == bufferSum) ? 0.f : 1.f);
+	return areAllMatching;
+}
+
+//OBJ parse
+//-----------------------------------------------------------------------------------------------
+//Count x Count quads of a wavy sheet, each quad one polygon with a uv and normal per corner like an exporter writes
+static void AppendGridOBJText(std::string& objText, int gridSize)
+{
+	objText += "# BenchmarkOBJParse grid\n";
+	for (int y = 0; y <= gridSize; ++y)
+	{
+		for (int x = 0; x <= gridSize; ++x)
+		{
+			float height = 0.25f * SinDegrees(10.f * (float)x) * CosDegrees(10.f * (float)y);
+			objText += Stringf("v %.6f %.6f %.6f\nvt %.6f %.6f\nvn 0.000000 0.000000 1.000000\n", (float)x, (float)y, height, (float)x / (float)gridSize, (float)y / (float)gridSize);
+		}
+	}
+
+	for (int y = 0; y < gridSize; ++y)
+	{
+		for (int x = 0; x < gridSize; ++x)
+		{
+			int bottomLeft = y * (gridSize + 1) + x + 1;
+			int topLeft = bottomLeft + gridSize + 1;
+			objText += Stringf("f %d/%d/%d %d/%d/%d %d/%d/%d %d/%d/%d\n", bottomLeft, bottomLeft, bottomLeft, bottomLeft + 1, bottomLeft + 1, bottomLeft + 1,
+				topLeft + 1, topLeft + 1, topLeft + 1, topLeft, topLeft, topLeft);
+		}
+	}
+}
+
+static float GetMeshMismatch(VertTBNs const& vertsA, std::vector<unsigned int> const& indexesA, VertTBNs const& vertsB, std::vector<unsigned int> const& indexesB)
+{
+	if (vertsA.size() != vertsB.size() || indexesA != indexesB)
+		return 1.f;
+	return (vertsA.empty() || memcmp(vertsA.data(), vertsB.data(), vertsA.size() * sizeof(Vertex_PCUTBN)) == 0) ? 0.f : 1.f;
+}
+
+//Single thread parse against the JobSystem one on File= (or a generated Count x Count grid), then the .mesh cache load
+bool Event_BenchmarkOBJParse(EventArgs& args)
+{
+	std::string objFilePath = args.GetValue("File", "");
+	if (objFilePath.empty())
+	{
+		//defaults to two million triangles
+		int gridSize = GetClampedInt(args.GetValue("Count", 1000, true), 1, 4000);
+		std::string objText;
+		AppendGridOBJText(objText, gridSize);
+
+		std::error_code errorCode;
+		std::filesystem::create_directories("Cooked/Meshes", errorCode);
+		objFilePath = Stringf("Cooked/Meshes/BenchmarkGrid%d.obj", gridSize);
+		FileWriteFromBuffer(std::vector<uint8_t>(objText.begin(), objText.end()), objFilePath);
+	}
+
+	MappedFile objFile;
+	if (!objFile.Open(objFilePath))
+	{
+		g_devConsole->AddLine(DevConsole::ERROR, Stringf("Could not read OBJ file \"%s\"", objFilePath.c_str()), 0.75f, true);
+		return false;
+	}
+
+	VertTBNs singleVerts;
+	std::vector<unsigned int> singleIndexes;
+	double startTime = GetCurrentTimeSeconds();
+	ParseOBJMeshTextBuffer(singleVerts, singleIndexes, objFile.GetView(), objFilePath.c_str());
+	double singleSeconds = GetCurrentTimeSeconds() - startTime;
+
+	VertTBNs jobVerts;
+	std::vector<unsigned int> jobIndexes;
+	startTime = GetCurrentTimeSeconds();
+	ParseOBJMeshTextBuffer(jobVerts, jobIndexes, objFile.GetView(), objFilePath.c_str(), g_jobSystem);
+	double jobSeconds = GetCurrentTimeSeconds() - startTime;
+
+	double megabytes = (double)objFile.GetSize() / (1024.0 * 1024.0);
+	g_devConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("OBJ parse: \"%s\" %.1fMB, %d triangles, %d verts, %d workers", objFilePath.c_str(), megabytes,
+		(int)singleIndexes.size() / 3, (int)singleVerts.size(), (g_jobSystem != nullptr) ? g_jobSystem->GetNumWorkers() : 0), 0.75f, true);
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("%.1fMB/s single thread, %.1fMB/s on the JobSystem", megabytes / std::max(singleSeconds, 1e-9), megabytes / std::max(jobSeconds, 1e-9)), 0.75f, true);
+	bool areAllMatching = ReportKernelComparison("OBJ single vs JobSystem", singleSeconds, jobSeconds, GetMeshMismatch(singleVerts, singleIndexes, jobVerts, jobIndexes));
+	objFile.Close();
+
+	//first load writes the cache, the timed one reads it back
+	VertTBNs cachedVerts;
+	std::vector<unsigned int> cachedIndexes;
+	LoadOBJMeshFile(cachedVerts, cachedIndexes, objFilePath, g_jobSystem);
+	cachedVerts.clear();
+	cachedIndexes.clear();
+	startTime = GetCurrentTimeSeconds();
+	LoadOBJMeshFile(cachedVerts, cachedIndexes, objFilePath, g_jobSystem);
+	double cachedSeconds = GetCurrentTimeSeconds() - startTime;
+	areAllMatching &= ReportKernelComparison("OBJ parse vs .mesh cache", singleSeconds, cachedSeconds, GetMeshMismatch(singleVerts, singleIndexes, cachedVerts, cachedIndexes));
+	return areAllMatching;
+}
+
+//Text parsing
+//-----------------------------------------------------------------------------------------------
+//How every SetFromText parsed before the string_view splitter, one std::string per piece then atof
+static int ParseFloatsWithSplitStrings(std::string const& text, char delimiterToSplitOn, float* out_values, int maxNumValues)
+{
+	Strings numsFromText = SplitStringOnDelimiter(text, delimiterToSplitOn);
+	for (int valueNum = 0; valueNum < maxNumValues && valueNum < (int)numsFromText.size(); ++valueNum)
+	{
+		out_values[valueNum] = (float)atof(numsFromText[valueNum].c_str());
+	}
+	return (int)numsFromText.size();
+}
+
+//Count attribute strings shaped like definition XML (vec2, color, range) parsed Iterations times, Split + atof against StringViewSplitter + from_chars
+bool Event_BenchmarkTextParsing(EventArgs& args)
+{
+	int numStrings = std::max(args.GetValue("Count", 10000, true), 1);
+	int numIterations = std::max(args.GetValue("Iterations", 20, true), 1);
+
+	Strings attributeTexts;
+	std::vector<char> delimiters;
+	for (int stringNum = 0; stringNum < numStrings; ++stringNum)
+	{
+		switch (stringNum % 3)
+		{
+		case 0:
+			attributeTexts.push_back(Stringf("%.3f, %.3f", g_rng->RollRandomFloatInRange(-100.f, 100.f), g_rng->RollRandomFloatInRange(-100.f, 100.f)));
+			delimiters.push_back(',');
+			break;
+		case 1:
+			attributeTexts.push_back(Stringf("%d,%d,%d,%d", g_rng->RollRandomIntInRange(0, 255), g_rng->RollRandomIntInRange(0, 255), g_rng->RollRandomIntInRange(0, 255), g_rng->RollRandomIntInRange(0, 255)));
+			delimiters.push_back(',');
+			break;
+		default:
+			attributeTexts.push_back(Stringf("%.2f~%.2f", g_rng->RollRandomFloatInRange(0.f, 1.f), g_rng->RollRandomFloatInRange(1.f, 10.f)));
+			delimiters.push_back('~');
+			break;
+		}
+	}
+
+	g_devConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("Text parsing: %d attribute strings, %d iterations", numStrings, numIterations), 0.75f, true);
+
+	std::vector<float> scalarValues((size_t)numStrings * 4, 0.f);
+	std::vector<float> batchValues((size_t)numStrings * 4, 0.f);
+	auto runSplitStrings = [&]()
+	{
+		for (int stringNum = 0; stringNum < numStrings; ++stringNum)
+		{
+			ParseFloatsWithSplitStrings(attributeTexts[stringNum], delimiters[stringNum], &scalarValues[(size_t)stringNum * 4], 4);
+		}
+	};
+	auto runFromChars = [&]()
+	{
+		for (int stringNum = 0; stringNum < numStrings; ++stringNum)
+		{
+			ParseNumbersFromText(attributeTexts[stringNum], delimiters[stringNum], &batchValues[(size_t)stringNum * 4], 4);
+		}
+	};
+	auto getValueMismatch = [&]()
+	{
+		return GetMaxDifference(scalarValues, batchValues);
+	};
+	bool areAllMatching = CompareKernels("Split+atof vs from_chars", numIterations, runSplitStrings, runFromChars, getValueMismatch);
+
+	//the same strings through the SetFromText the definition loaders call, against the old path building the same types
+	auto runOldSetFromText = [&]()
+	{
+		for (int stringNum = 0; stringNum < numStrings; ++stringNum)
+		{
+			float values[4] = {};
+			int numValues = ParseFloatsWithSplitStrings(attributeTexts[stringNum], delimiters[stringNum], values, 4);
+			scalarValues[stringNum] = (numValues == 4) ? (float)Rgba8((unsigned char)values[0], (unsigned char)values[1], (unsigned char)values[2], (unsigned char)values[3]).a : Vec2(values[0], values[1]).x;
+		}
+	};
+	auto runSetFromText = [&]()
+	{
+		for (int stringNum = 0; stringNum < numStrings; ++stringNum)
+		{
+			std::string const& attributeText = attributeTexts[stringNum];
+			if (stringNum % 3 == 1)
+			{
+				Rgba8 color;
+				color.SetFromText(attributeText.c_str());
+				batchValues[stringNum] = (float)color.a;
+			}
+			else if (stringNum % 3 == 0)
+			{
+				Vec2 vec2;
+				vec2.SetFromText(attributeText.c_str());
+				batchValues[stringNum] = vec2.x;
+			}
+			else
+			{
+				FloatRange range;
+				range.SetFromText(attributeText.c_str());
+				batchValues[stringNum] = range.m_min;
+			}
+		}
+	};
+	areAllMatching &= CompareKernels("SetFromText old vs new", numIterations, runOldSetFromText, runSetFromText, getValueMismatch);
+	return areAllMatching;
+}
+
+//Tile chunks
+//-----------------------------------------------------------------------------------------------
+//Building every chunk is what RenderTiles paid each frame before the chunk cache, a tile override now pays for one chunk.
+//Every clean chunk is rebuilt on the side and compared with what it last uploaded, so a tile change that missed
+//OnTileDefinitionChanged shows up as a mismatch
+bool Event_BenchmarkTileChunks(EventArgs& args)
+{
+	Map* map = (g_game != nullptr) ? g_game->m_currentMap : nullptr;
+	if (map == nullptr)
+	{
+		g_devConsole->AddLine(DevConsole::ERROR, "BenchmarkTileChunks needs a map, start a game first", 0.75f, true);
+		return false;
+	}
+
+	int numIterations = std::max(args.GetValue("Iterations", 20, true), 1);
+	int numChunks = map->GetNumTileMeshChunks();
+	g_devConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("Benchmark tile chunks: %d chunks, %d iterations", numChunks, numIterations), 0.75f, true);
+
+	std::vector<Vertex_PCU2D> verts;
+	auto runBuildAll = [&]()
+	{
+		verts.clear();
+		for (int chunkNum = 0; chunkNum < numChunks; ++chunkNum)
+		{
+			map->AddVertsForTileMeshChunk(verts, chunkNum);
+		}
+	};
+	auto runRebuildOne = [&]()
+	{
+		map->MarkTileMeshChunkDirty(0);
+		map->RebuildDirtyTileMeshChunks();
+	};
+	double buildAllSeconds = TimeKernel(numIterations, runBuildAll);
+	double rebuildOneSeconds = TimeKernel(numIterations, runRebuildOne);
+
+	int numStaleChunks = 0;
+	for (int chunkNum = 0; chunkNum < numChunks; ++chunkNum)
+	{
+		if (!map->IsTileMeshChunkCurrent(chunkNum, verts))
+		{
+			numStaleChunks++;
+		}
+	}
+	return ReportKernelComparison("Build all vs rebuild one", buildAllSeconds, rebuildOneSeconds, static_cast<float>(numStaleChunks));
+}
+
+//Texture atlas
+//-----------------------------------------------------------------------------------------------
+//Repacks the entity atlas's images with its config and checks every sprite's rect, padding included, against its source
+//image taken through the same downsampling. A packer that overlaps rects or a copy that is off by a texel is a mismatch
+static int CountAtlasSpriteMismatches(TextureAtlas const& atlas, int spriteIndex)
+{
+	TextureAtlasConfig const& config = atlas.GetConfig();
+	TextureAtlasSprite const& sprite = atlas.GetSprite(spriteIndex);
+	Image* image = atlas.LoadSpriteImage(sprite.m_imageFilePath.c_str());
+
+	Image const* pageImage = atlas.GetPageImage(sprite.m_pageIndex);
+	IntVec2 dims = image->GetDimensions();
+	if (dims != sprite.m_texelDimensions)
+	{
+		delete image;
+		return dims.x * dims.y;
+	}
+
+	int numMismatches = 0;
+	for (int y = -config.m_padding; y < dims.y + config.m_padding; ++y)
+	{
+		int sourceY = GetClampedInt(y, 0, dims.y - 1);
+		for (int x = -config.m_padding; x < dims.x + config.m_padding; ++x)
+		{
+			int sourceX = GetClampedInt(x, 0, dims.x - 1);
+			if (pageImage->GetTexelColor(IntVec2(sprite.m_texelMins.x + x, sprite.m_texelMins.y + y)) != image->GetTexelColor(IntVec2(sourceX, sourceY)))
+			{
+				numMismatches++;
+			}
+		}
+	}
+
+	delete image;
+	return numMismatches;
+}
+
+bool Event_BenchmarkTextureAtlas(EventArgs& args)
+{
+	UNUSED(args);
+	if (g_entityAtlas == nullptr)
+	{
+		g_devConsole->AddLine(DevConsole::ERROR, "BenchmarkTextureAtlas needs the entity atlas, set entityAtlasEnabled", 0.75f, true);
+		return false;
+	}
+
+	TextureAtlas atlas(g_entityAtlas->GetConfig());
+	int numSprites = g_entityAtlas->GetNumSprites();
+	for (int spriteIndex = 0; spriteIndex < numSprites; ++spriteIndex)
+	{
+		atlas.AddImage(g_entityAtlas->GetSprite(spriteIndex).m_imageFilePath.c_str());
+	}
+
+	//a standalone texture per image loaded each image once too, so loading alone is the reference
+	auto runLoadImages = [&]()
+	{
+		for (int spriteIndex = 0; spriteIndex < numSprites; ++spriteIndex)
+		{
+			delete atlas.LoadSpriteImage(atlas.GetSprite(spriteIndex).m_imageFilePath.c_str());
+		}
+	};
+	auto runPackImages = [&]()
+	{
+		atlas.PackImages();
+	};
+	double loadSeconds = TimeKernel(1, runLoadImages);
+	double packSeconds = TimeKernel(1, runPackImages);
+
+	int numMismatches = 0;
+	for (int spriteIndex = 0; spriteIndex < numSprites; ++spriteIndex)
+	{
+		numMismatches += CountAtlasSpriteMismatches(atlas, spriteIndex);
+	}
+
+	g_devConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("Benchmark texture atlas: %d sprites on %d pages", numSprites, atlas.GetNumPages()), 0.75f, true);
+	return ReportKernelComparison("Load vs load+pack", loadSeconds, packSeconds, static_cast<float>(numMismatches));
+}
+
+//Compact quad verts
+//-----------------------------------------------------------------------------------------------
+//Vertex_PCU2D corners drawn through the shared quad index buffer against the 6 Vertex_PCU per quad they replaced.
+//Each corner list is expanded through AddIndexesForQuads2D before comparing, so a wrong corner order shows up as well.
+//Positions and colors have to match exactly, uvs only to the unorm16 rounding
+static float GetMaxQuadVertDifference(std::vector<Vertex_PCU> const& triangleVerts, std::vector<Vertex_PCU2D> const& cornerVerts)
+{
+	int numQuads = static_cast<int>(cornerVerts.size()) / NUM_VERTS_PER_QUAD_2D;
+	if (static_cast<int>(triangleVerts.size()) != numQuads * NUM_INDEXES_PER_QUAD_2D)
+		return INFINITY;
+
+	std::vector<unsigned int> indexes;
+	AddIndexesForQuads2D(indexes, numQuads, 0);
+
+	float maxDifference = 0.f;
+	for (int indexNum = 0; indexNum < static_cast<int>(indexes.size()); ++indexNum)
+	{
+		Vertex_PCU const& triangleVert = triangleVerts[indexNum];
+		Vertex_PCU2D const& cornerVert = cornerVerts[indexes[indexNum]];
+		if (triangleVert.m_color != cornerVert.m_color || triangleVert.m_position.z != 0.f)
+			return INFINITY;
+
+		Vec2 positionDifference = Vec2(triangleVert.m_position.x, triangleVert.m_position.y) - cornerVert.m_position;
+		Vec2 uvDifference = triangleVert.m_uvTexCoords - cornerVert.GetUVTexCoords();
+		maxDifference = fmaxf(maxDifference, fmaxf(fabsf(positionDifference.x), fabsf(positionDifference.y)));
+		maxDifference = fmaxf(maxDifference, fmaxf(fabsf(uvDifference.x), fabsf(uvDifference.y)));
+	}
+	return maxDifference;
+}
+
+bool Event_BenchmarkQuadVerts(EventArgs& args)
+{
+	int numQuads = GetClampedInt(args.GetValue("Count", 4096, true), 1, 1 << 20);
+	int numIterations = std::max(args.GetValue("Iterations", 50, true), 1);
+	numIterations = (numIterations < 1) ? 1 : numIterations;
+	g_devConsole->AddLine(DevConsole::INFO_MAJOR, Stringf("Benchmark quad verts: %d quads, %d iterations, %d vs %d bytes per quad",
+		numQuads, numIterations, static_cast<int>(6 * sizeof(Vertex_PCU)), static_cast<int>(NUM_VERTS_PER_QUAD_2D * sizeof(Vertex_PCU2D))), 0.75f, true);
+
+	std::vector<AABB2> boxes;
+	std::vector<AABB2> uvs;
+	std::vector<Rgba8> colors;
+	boxes.reserve(numQuads);
+	uvs.reserve(numQuads);
+	colors.reserve(numQuads);
+	for (int quadNum = 0; quadNum < numQuads; ++quadNum)
+	{
+		Vec2 mins(g_rng->RollRandomFloatInRange(-100.f, 100.f), g_rng->RollRandomFloatInRange(-100.f, 100.f));
+		boxes.push_back(AABB2(mins, mins + Vec2(g_rng->RollRandomFloatInRange(0.1f, 4.f), g_rng->RollRandomFloatInRange(0.1f, 4.f))));
+		Vec2 uvMins(g_rng->RollRandomFloatInRange(0.f, 0.5f), g_rng->RollRandomFloatInRange(0.f, 0.5f));
+		uvs.push_back(AABB2(uvMins, uvMins + Vec2(g_rng->RollRandomFloatInRange(0.f, 0.5f), g_rng->RollRandomFloatInRange(0.f, 0.5f))));
+		colors.push_back(Rgba8((unsigned char)g_rng->RollRandomIntInRange(0, 255), (unsigned char)g_rng->RollRandomIntInRange(0, 255), (unsigned char)g_rng->RollRandomIntInRange(0, 255), 255));
+	}
+
+	std::vector<Vertex_PCU> triangleVerts;
+	std::vector<Vertex_PCU2D> cornerVerts;
+	auto getQuadMismatch = [&]()
+	{
+		return GetMaxQuadVertDifference(triangleVerts, cornerVerts);
+	};
+
+	auto runAABB2Triangles = [&]()
+	{
+		triangleVerts.clear();
+		for (int quadNum = 0; quadNum < numQuads; ++quadNum)
+		{
+			AddVertsForAABB2D(triangleVerts, boxes[quadNum], colors[quadNum], uvs[quadNum]);
+		}
+	};
+	auto runAABB2Corners = [&]()
+	{
+		cornerVerts.clear();
+		for (int quadNum = 0; quadNum < numQuads; ++quadNum)
+		{
+			AddVertsForAABB2D(cornerVerts, boxes[quadNum], colors[quadNum], uvs[quadNum]);
+		}
+	};
+	//half a unorm16 step plus the float rounding of the divide back
+	constexpr float UV_TOLERANCE = 1e-5f;
+	bool areAllMatching = CompareKernels("AddVertsForAABB2D", numIterations, runAABB2Triangles, runAABB2Corners, getQuadMismatch, UV_TOLERANCE);
+
+	auto runOBB2Triangles = [&]()
+	{
+		triangleVerts.clear();
+		for (int quadNum = 0; quadNum < numQuads; ++quadNum)
+		{
+			AddVertsForOBB2D(triangleVerts, boxes[quadNum].GetCenterPos(), Vec2::MakeFromPolarDegrees(static_cast<float>(quadNum)), boxes[quadNum].GetDimensions() * 0.5f, colors[quadNum]);
+		}
+	};
+	auto runOBB2Corners = [&]()
+	{
+		cornerVerts.clear();
+		for (int quadNum = 0; quadNum < numQuads; ++quadNum)
+		{
+			AddVertsForOBB2D(cornerVerts, boxes[quadNum].GetCenterPos(), Vec2::MakeFromPolarDegrees(static_cast<float>(quadNum)), boxes[quadNum].GetDimensions() * 0.5f, colors[quadNum]);
+		}
+	};
+	areAllMatching &= CompareKernels("AddVertsForOBB2D", numIterations, runOBB2Triangles, runOBB2Corners, getQuadMismatch, UV_TOLERANCE);
+	return areAllMatching;
+}
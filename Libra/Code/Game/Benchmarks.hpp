@@ -0,0 +1,18 @@
+#pragma once
+#include "Engine/Core/EventSystem.hpp"
+
+//Dev console benchmarks comparing engine fast paths against their scalar reference versions
+void SubscribeBenchmarkEvents();
+
+bool Event_BenchmarkDiscKernels(EventArgs& args);
+bool Event_BenchmarkRenderQueue(EventArgs& args);
+bool Event_BenchmarkVertexTransforms(EventArgs& args);
+bool Event_BenchmarkTextureLoads(EventArgs& args);
+bool Event_BenchmarkImageIngest(EventArgs& args);
+bool Event_CookTextures(EventArgs& args);
+bool Event_BenchmarkFileReads(EventArgs& args);
+bool Event_BenchmarkOBJParse(EventArgs& args);
+bool Event_BenchmarkTextParsing(EventArgs& args);
+bool Event_BenchmarkTileChunks(EventArgs& args);
+bool Event_BenchmarkTextureAtlas(EventArgs& args);
+bool Event_BenchmarkQuadVerts(EventArgs& args);
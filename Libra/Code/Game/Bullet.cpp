@@ -2,7 +2,8 @@
 #include "Game/GameCommon.hpp"
 #include "Game/Map.hpp"
 #include "Game/Game.hpp"
-#include "Engine/Renderer/RendererDX11.hpp"
+#include "Game/GameRenderer.hpp"
+#include "Engine/Renderer/SpriteBatch2D.hpp"
 #include "Engine/Renderer/Texture.hpp"
 #include "Engine/Core/VertexUtils.hpp"
 #include "Engine/Math/MathUtils.hpp"
@@ -15,12 +16,12 @@ Bullet::Bullet(Map* const& mapOwner, EntityType entityType, EntityFaction factio
 {
 	UpdateGameConfigXmlData();
 	CreateTexture();
-	m_isPushedByWalls = false;
-	m_isPushedByEntities = false;
-	m_doesPushEntities = false;
-	m_isHitByBullets = false;
+	SetPhysicsFlag(PHYSICS_FLAG_IS_PUSHED_BY_WALLS, false);
+	SetPhysicsFlag(PHYSICS_FLAG_IS_PUSHED_BY_ENTITIES, false);
+	SetPhysicsFlag(PHYSICS_FLAG_DOES_PUSH_ENTITIES, false);
+	SetPhysicsFlag(PHYSICS_FLAG_IS_HIT_BY_BULLETS, false);
 	m_health = 1;
-	m_physicsRadius = 0.f;
+	SetPhysicsRadius(0.f);
 
 	if (entityType == ENTITY_TYPE_EVIL_SHELL)
 	{
@@ -30,7 +31,7 @@ Bullet::Bullet(Map* const& mapOwner, EntityType entityType, EntityFaction factio
 	else if (entityType == ENTITY_TYPE_GOOD_FLAME_BULLET)
 	{
 		m_isFlameBullet = true;
-		m_physicsRadius = 0.25f;
+		SetPhysicsRadius(0.25f);
 		m_numBounces = 0;
 		m_flameOrientation = g_rng->RollRandomFloatInRange(0.f, 360.f);
 	}
@@ -44,8 +45,8 @@ Bullet::~Bullet()
 
 void Bullet::Update(float deltaSeconds)
 {
-	m_velocity = GetForwardNormal() * m_moveSpeed * deltaSeconds;
-	Vec2 futurePos = m_position + m_velocity;
+	SetVelocity(GetForwardNormal() * m_moveSpeed * deltaSeconds);
+	Vec2 futurePos = GetPosition() + GetVelocity();
 
 	if (m_isTrackingBullet)
 	{
@@ -70,44 +71,35 @@ void Bullet::Update(float deltaSeconds)
 		{
 			IntVec2 tileCoords = m_map->GetTileCoordsFromPosition(futurePos);
 			AABB2 tileBounds = m_map->GetTileBoundsFromTileCoords(tileCoords);
-			Vec2 nearestPoint = tileBounds.GetNearestPoint(m_position);
-			Vec2 surfaceNormal = (m_position - nearestPoint).GetNormalized();
+			Vec2 nearestPoint = tileBounds.GetNearestPoint(GetPosition());
+			Vec2 surfaceNormal = (GetPosition() - nearestPoint).GetNormalized();
 			BounceOffSurfaceNormal(surfaceNormal);
-			g_game->PlayGameSFX(BULLET_BOUNCE, m_position);
+			g_game->PlayGameSFX(BULLET_BOUNCE, GetPosition());
 		}
 	}
 
 	else
 	{
-		m_position = futurePos;
+		SetPosition(futurePos);
 	}
 }
 
-void Bullet::Render() const
+void Bullet::Render(SpriteBatch2D& spriteBatch) const
 {
 	Vec2 fwrdNormal;
-	std::vector<Vertex_PCU> worldVerts;
 
 	if (!m_isFlameBullet)
 	{
 		fwrdNormal = GetForwardNormal();
-		AddVertsForAABB2D(worldVerts, m_entityBounds, Rgba8::WHITE);
-		TransformVertexArrayXY3D(worldVerts, fwrdNormal, fwrdNormal.GetRotated90Degrees(), m_position);
-		g_renderer->SetBlendMode(BlendMode::ALPHA);
+		spriteBatch.AddQuad(m_texture, BlendMode::ALPHA, ENTITY_RENDER_LAYER_PROJECTILE, m_entityBounds, fwrdNormal, fwrdNormal.GetRotated90Degrees(), GetPosition(), Rgba8::WHITE, m_textureUVs);
 	}
 
 	else if (m_spriteAnimDef != nullptr)
 	{
 		fwrdNormal = Vec2::MakeFromPolarDegrees(m_flameOrientation);
 		SpriteDefinition spriteDef = m_spriteAnimDef->GetSpriteDefAtTime(RangeMapClamped(m_health, 1.f, 0.f, 0.f, m_decayRate));
-		AddVertsForAABB2D(worldVerts, m_entityBounds, Rgba8::WHITE, spriteDef.GetUVS());
-		TransformVertexArrayXY3D(worldVerts, fwrdNormal, fwrdNormal.GetRotated90Degrees(), m_position);
-		g_renderer->SetBlendMode(BlendMode::ADDITIVE);
+		spriteBatch.AddQuad(m_texture, BlendMode::ADDITIVE, ENTITY_RENDER_LAYER_PROJECTILE, m_entityBounds, fwrdNormal, fwrdNormal.GetRotated90Degrees(), GetPosition(), Rgba8::WHITE, spriteDef.GetUVS());
 	}
-
-	g_renderer->BindTexture(m_texture);
-	g_renderer->DrawVertexArray(worldVerts);
-	
 }
 
 void Bullet::DebugRender() const
@@ -116,12 +108,12 @@ void Bullet::DebugRender() const
 	if (m_isFlameBullet)
 	{
 		//Physics Ring
-		AddVertsForRing2D(debugVerts, m_position, m_physicsRadius, m_debugLineThickness, Rgba8(0, 255, 255));
+		AddVertsForRing2D(debugVerts, GetPosition(), GetPhysicsRadius(), m_debugLineThickness, Rgba8(0, 255, 255));
 	}
 
 	else
 	{
-		AddVertsForDisc2D(debugVerts, m_position, 0.05f, Rgba8::WHITE);
+		AddVertsForDisc2D(debugVerts, GetPosition(), 0.05f, Rgba8::WHITE);
 	}
 	
 
@@ -141,12 +133,12 @@ void Bullet::LoseHealth(float amount)
 
 void Bullet::Die()
 {
-	m_isGarbage = true;
+	m_map->DestroyEntity(this);
 	m_isDead = true;
 	Vec2 fwrdNormal = GetForwardNormal();
 	if (!m_isFlameBullet)
 	{
-		m_map->SpawnExplosion(m_position + (fwrdNormal * m_bulletLength * 0.45f) , BULLET_DEATH_EXPLOSION_SIZE, DEATH_EXPLOSION_DURATION);
+		m_map->SpawnExplosion(GetPosition() + (fwrdNormal * m_bulletLength * 0.45f) , BULLET_DEATH_EXPLOSION_SIZE, DEATH_EXPLOSION_DURATION);
 	}
 }
 
@@ -199,7 +191,7 @@ void Bullet::UpdateGameConfigXmlData()
 
 void Bullet::BounceOffSurfaceNormal(Vec2 const& surfaceNormal)
 {
-	Vec2 reflectedDirection = m_velocity.GetReflected(surfaceNormal);
+	Vec2 reflectedDirection = GetVelocity().GetReflected(surfaceNormal);
 	m_orientationDegrees = reflectedDirection.GetOrientationDegrees();
 	m_numBounces--;
 }
@@ -209,41 +201,43 @@ void Bullet::CreateTexture()
 	switch (m_entityType)
 	{
 	case ENTITY_TYPE_GOOD_BULLET:
-		m_texture = g_renderer->CreateOrGetTextureFromFile("Data/Images/Bullets/FriendlyBullet.png");
+		m_texture = GetOrCreateEntityTexture("Data/Images/Bullets/FriendlyBullet.png", m_textureUVs);
 		m_bulletLength = g_gameConfigBlackboard.GetValue("defaultBulletVertsSizeX", 0.25f);
 		break;
 	case ENTITY_TYPE_GOOD_BOLT:
-		m_texture = g_renderer->CreateOrGetTextureFromFile("Data/Images/Bullets/FriendlyBolt.png");
+		m_texture = GetOrCreateEntityTexture("Data/Images/Bullets/FriendlyBolt.png", m_textureUVs);
 		m_bulletLength = g_gameConfigBlackboard.GetValue("defaultBulletVertsSizeX", 0.25f);
 		break;
 	case ENTITY_TYPE_EVIL_BULLET:
-		m_texture = g_renderer->CreateOrGetTextureFromFile("Data/Images/Bullets/EnemyBullet.png");
+		m_texture = GetOrCreateEntityTexture("Data/Images/Bullets/EnemyBullet.png", m_textureUVs);
 		m_bulletLength = g_gameConfigBlackboard.GetValue("defaultBulletVertsSizeX", 0.25f);
 		break;
 	case ENTITY_TYPE_EVIL_BOLT:
-		m_texture = g_renderer->CreateOrGetTextureFromFile("Data/Images/Bullets/EnemyBolt.png");
+		m_texture = GetOrCreateEntityTexture("Data/Images/Bullets/EnemyBolt.png", m_textureUVs);
 		m_bulletLength = g_gameConfigBlackboard.GetValue("defaultBulletVertsSizeX", 0.25f);
 		break;
 	case ENTITY_TYPE_EVIL_BOUNCING_BOLT:
-		m_texture = g_renderer->CreateOrGetTextureFromFile("Data/Images/Bullets/EnemyBolt.png");
+		m_texture = GetOrCreateEntityTexture("Data/Images/Bullets/EnemyBolt.png", m_textureUVs);
 		m_bulletLength = g_gameConfigBlackboard.GetValue("defaultBulletVertsSizeX", 0.25f);
 		break;
 	case ENTITY_TYPE_EVIL_SHELL:
-		m_texture = g_renderer->CreateOrGetTextureFromFile("Data/Images/Bullets/EnemyShell.png");
+		m_texture = GetOrCreateEntityTexture("Data/Images/Bullets/EnemyShell.png", m_textureUVs);
 		m_bulletLength = g_gameConfigBlackboard.GetValue("defaultBulletVertsSizeX", 0.25f);
 		break;
 	case ENTITY_TYPE_GOOD_FLAME_BULLET:
-		m_texture = g_renderer->CreateOrGetTextureFromFile(g_gameConfigBlackboard.GetValue("explosionSpriteSheetTexture", "").c_str());
 		m_bulletLength = 1.f;
 		SpriteSheet* spriteSheet = m_map->m_explosionSpriteSheet;
+		m_texture = &spriteSheet->GetTexture();
+		m_textureUVs = AABB2::ZERO_TO_ONE; //flames only use the sprite sheet's uvs, which already point into the atlas
 		int endIndex = spriteSheet->GetNumSprites() - 1;
 		m_spriteAnimDef = new SpriteAnimDefinition(*spriteSheet, 0, endIndex, endIndex / m_decayRate, ONCE);
 		break;
 	}
 
+	//aspect of the image itself, which is only part of m_texture when it came from the atlas
 	IntVec2 textureDims = m_texture->GetDimensions();
-	float xDims = static_cast<float>(textureDims.x);
-	float yDims = static_cast<float>(textureDims.y);
+	float xDims = static_cast<float>(textureDims.x) * (m_textureUVs.m_maxs.x - m_textureUVs.m_mins.x);
+	float yDims = static_cast<float>(textureDims.y) * (m_textureUVs.m_maxs.y - m_textureUVs.m_mins.y);
 	float xToYAspect = yDims / xDims;
 
 	Vec2 convertedDims(m_bulletLength, m_bulletLength * xToYAspect);
@@ -256,6 +250,6 @@ void Bullet::CreateTexture()
 void Bullet::TurnTowardsPlayer(float maxTurnDegrees)
 {
 	Entity* player = g_game->m_player;
-	float orientToPlayer = (player->m_position - m_position).GetOrientationDegrees();
+	float orientToPlayer = (player->GetPosition() - GetPosition()).GetOrientationDegrees();
 	m_orientationDegrees = GetTurnedTowardDegrees(m_orientationDegrees, orientToPlayer, maxTurnDegrees);
 }
@@ -10,7 +10,7 @@ protected:
 	virtual ~Bullet();
 
 	virtual void Update(float deltaSeconds) override;
-	virtual void Render() const override;
+	virtual void Render(SpriteBatch2D& spriteBatch) const override;
 	virtual void DebugRender() const override;
 	virtual void LoseHealth(float amount) override;
 	virtual void Die() override;
@@ -4,7 +4,8 @@
 #include "Game/Map.hpp"
 #include "Game/Player.hpp"
 #include "Engine/Core/EngineCommon.hpp"
-#include "Engine/Renderer/RendererDX11.hpp"
+#include "Game/GameRenderer.hpp"
+#include "Engine/Renderer/SpriteBatch2D.hpp"
 #include "Engine/Core/VertexUtils.hpp"
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Core/TileHeatMap.hpp"
@@ -20,24 +21,16 @@ Capricorn::Capricorn(Map* const& mapOwner, EntityFaction faction)
 
 void Capricorn::Update(float deltaSeconds)
 {
-	m_positionLastFrame = m_position;
+	m_positionLastFrame = GetPosition();
 	UpdateTimers(deltaSeconds);
 	Vec2 fwrdNormal = UpdateEntityPathFinding(deltaSeconds);
 	TryShootBullet(ENTITY_TYPE_EVIL_SHELL, FACTION_EVIL, fwrdNormal);
 }
 
-void Capricorn::Render() const
+void Capricorn::Render(SpriteBatch2D& spriteBatch) const
 {
 	Vec2 fwrdNormal = GetForwardNormal();
-	std::vector<Vertex_PCU> worldVerts;
-	AddVertsForAABB2D(worldVerts, m_entityBounds, Rgba8::WHITE);
-
-	TransformVertexArrayXY3D(worldVerts, fwrdNormal, fwrdNormal.GetRotated90Degrees(), m_position);
-	
-
-	g_renderer->SetBlendMode(BlendMode::ALPHA);
-	g_renderer->BindTexture(m_texture);
-	g_renderer->DrawVertexArray(worldVerts);
+	spriteBatch.AddQuad(m_texture, BlendMode::ALPHA, ENTITY_RENDER_LAYER_BODY, m_entityBounds, fwrdNormal, fwrdNormal.GetRotated90Degrees(), GetPosition(), Rgba8::WHITE, m_textureUVs);
 }
 
 void Capricorn::DebugRender() const
@@ -45,23 +38,23 @@ void Capricorn::DebugRender() const
 	std::vector<Vertex_PCU> debugVerts;
 
 	//Physics Ring
-	AddVertsForRing2D(debugVerts, m_position, m_physicsRadius, m_debugLineThickness, Rgba8(0, 255, 255));
+	AddVertsForRing2D(debugVerts, GetPosition(), GetPhysicsRadius(), m_debugLineThickness, Rgba8(0, 255, 255));
 
 	//Forward Vector
 	Vec2 vecFwrd = GetForwardNormal() * m_cosmeticRadius;
-	AddVertsForLineSegment2D(debugVerts, m_position, m_position + vecFwrd, m_debugLineThickness, Rgba8(255, 0, 0));
+	AddVertsForLineSegment2D(debugVerts, GetPosition(), GetPosition() + vecFwrd, m_debugLineThickness, Rgba8(255, 0, 0));
 
 	//Left Vector
 	Vec2 vecLeft = vecFwrd.GetRotated90Degrees();
-	AddVertsForLineSegment2D(debugVerts, m_position, m_position + vecLeft, m_debugLineThickness, Rgba8(0, 255, 0));
+	AddVertsForLineSegment2D(debugVerts, GetPosition(), GetPosition() + vecLeft, m_debugLineThickness, Rgba8(0, 255, 0));
 
 	//Velocity Line
-	AddVertsForLineSegment2D(debugVerts, m_position, m_position + m_velocity, m_debugLineThickness, Rgba8(255, 255, 0));
+	AddVertsForLineSegment2D(debugVerts, GetPosition(), GetPosition() + GetVelocity(), m_debugLineThickness, Rgba8(255, 255, 0));
 
 	if (m_chasingPlayerLocation)
 	{
 		//Line to Target Pos
-		AddVertsForLineSegment2D(debugVerts, m_position, m_targetPos, m_debugLineThickness, Rgba8(0, 0, 0, 100));
+		AddVertsForLineSegment2D(debugVerts, GetPosition(), m_targetPos, m_debugLineThickness, Rgba8(0, 0, 0, 100));
 		AddVertsForDisc2D(debugVerts, m_targetPos, 0.05f, Rgba8::BLACK);
 	}
 
@@ -72,7 +65,7 @@ void Capricorn::DebugRender() const
 
 void Capricorn::UpdateGameConfigXmlData()
 {
-	m_physicsRadius = g_gameConfigBlackboard.GetValue("capricornPhysicsRadius", 0.35f);
+	SetPhysicsRadius(g_gameConfigBlackboard.GetValue("capricornPhysicsRadius", 0.35f));
 	m_maxHealth = g_gameConfigBlackboard.GetValue("capricornStartingHealth", 7.f);
 	m_health = m_maxHealth;
 	m_sightRange = g_gameConfigBlackboard.GetValue("capricornSightRange", 5.f);
@@ -82,12 +75,12 @@ void Capricorn::UpdateGameConfigXmlData()
 	m_driveAperture = g_gameConfigBlackboard.GetValue("capricornDriveAperture", 45.f);
 	m_bulletSpawnOffset = g_gameConfigBlackboard.GetValue("capricornBulletSpawnOffset", 0.2f);
 	m_fireRate = g_gameConfigBlackboard.GetValue("capricornFireRate", 2.f);
-	m_canTraverseWater = true;
+	SetPhysicsFlag(PHYSICS_FLAG_CAN_TRAVERSE_WATER, true);
 }
 
 void Capricorn::CreateTexture()
 {
 	m_entityBounds = AABB2(-0.5f, -0.5f, 0.5f, 0.5f);
-	m_texture = g_renderer->CreateOrGetTextureFromFile(g_gameConfigBlackboard.GetValue("capricornTexturePath", "").c_str());
+	m_texture = GetOrCreateEntityTexture(g_gameConfigBlackboard.GetValue("capricornTexturePath", ""), m_textureUVs);
 	AddVertsForAABB2D(m_shapeVerts, m_entityBounds, Rgba8::WHITE);
 }
@@ -9,6 +9,7 @@
 //
 
 //#define ENGINE_DISABLE_AUDIO	// (If uncommented) Disables AudioSystem code and fmod linkage.
+//#define ENGINE_NULL_RENDERER	// (If uncommented, or built as NullRenderer|x64) Game runs without a window and renders through RendererNull: no GPU work, draw calls and uploads are only counted.
 #if defined (_DEBUG)
 #define ENGINE_DEBUG_RENDERER
 #endif
@@ -4,7 +4,7 @@
 #include "Game/Player.hpp"
 #include "Game/Game.hpp"
 #include "Engine/Math/MathUtils.hpp"
-#include "Engine/Renderer/RendererDX11.hpp"
+#include "Game/GameRenderer.hpp"
 #include "Engine/Core/VertexUtils.hpp"
 #include "Engine/Core/TileHeatMap.hpp"
 #include "Engine/Math/LineSegment2.hpp"
@@ -13,9 +13,10 @@ Entity::Entity(Map* const& mapOwner, EntityType entityType, EntityFaction factio
  	: m_map(mapOwner)
 	, m_entityType(entityType)
  	, m_entityFaction(faction)
- 	, m_position(startingPosition)
  	, m_orientationDegrees(orientationDeg)
  {
+	m_map->GetEntityPhysicsTable(entityType).AddRow(this, faction);
+	SetPosition(startingPosition);
  	m_debugLineThickness = g_gameConfigBlackboard.GetValue("debugDrawLineThickness", 0.03f);
  }
 
@@ -24,11 +25,14 @@ Entity::Entity(Map* const& mapOwner, EntityType entityType, EntityFaction factio
 	,m_entityType(entityType)
 	,m_entityFaction(faction)
 {
+	m_map->GetEntityPhysicsTable(entityType).AddRow(this, faction);
 	m_debugLineThickness = g_gameConfigBlackboard.GetValue("debugDrawLineThickness", 0.03f);
 }
 
 Entity::~Entity()
 {
+	m_physicsTable->RemoveRow(m_physicsRow);
+
 	delete(m_roamDistanceMap);
 	m_roamDistanceMap = nullptr;
 
@@ -36,16 +40,69 @@ Entity::~Entity()
 	m_solidMap = nullptr;
 }
 
+//Physics
+//----------------------------------------------------------------------
+void Entity::SetPhysicsFlag(EntityPhysicsFlags flag, bool isSet)
+{
+	unsigned char& flags = m_physicsTable->m_flags[m_physicsRow];
+	flags = isSet ? (flags | flag) : (flags & ~flag);
+}
+
+void EntityPhysicsTable::AddRow(Entity* entity, EntityFaction faction)
+{
+	entity->m_physicsTable = this;
+	entity->m_physicsRow = GetNumRows();
+	m_entities.push_back(entity);
+	m_positionsX.push_back(0.f);
+	m_positionsY.push_back(0.f);
+	m_velocitiesX.push_back(0.f);
+	m_velocitiesY.push_back(0.f);
+	m_physicsRadii.push_back(0.3f);
+	m_flags.push_back(PHYSICS_FLAG_DOES_PUSH_ENTITIES | PHYSICS_FLAG_IS_PUSHED_BY_ENTITIES | PHYSICS_FLAG_IS_PUSHED_BY_WALLS | PHYSICS_FLAG_IS_HIT_BY_BULLETS);
+	m_factions.push_back(faction);
+}
+
+void EntityPhysicsTable::RemoveRow(int row)
+{
+	int lastRow = GetNumRows() - 1;
+	if (row != lastRow)
+	{
+		CopyRow(row, *this, lastRow);
+		m_entities[row]->m_physicsRow = row;
+	}
+
+	m_entities.pop_back();
+	m_positionsX.pop_back();
+	m_positionsY.pop_back();
+	m_velocitiesX.pop_back();
+	m_velocitiesY.pop_back();
+	m_physicsRadii.pop_back();
+	m_flags.pop_back();
+	m_factions.pop_back();
+}
+
+void EntityPhysicsTable::CopyRow(int row, EntityPhysicsTable const& sourceTable, int sourceRow)
+{
+	m_entities[row] = sourceTable.m_entities[sourceRow];
+	m_positionsX[row] = sourceTable.m_positionsX[sourceRow];
+	m_positionsY[row] = sourceTable.m_positionsY[sourceRow];
+	m_velocitiesX[row] = sourceTable.m_velocitiesX[sourceRow];
+	m_velocitiesY[row] = sourceTable.m_velocitiesY[sourceRow];
+	m_physicsRadii[row] = sourceTable.m_physicsRadii[sourceRow];
+	m_flags[row] = sourceTable.m_flags[sourceRow];
+	m_factions[row] = sourceTable.m_factions[sourceRow];
+}
+
 //Pathfinding
 //----------------------------------------------------------------------
 void Entity::InitPathFinding()
 {
 	if (m_solidMap && m_roamDistanceMap)
 	{
-		m_map->PopulateDistanceMapWithStationaryEntities(*m_solidMap, IntVec2(m_position), DEFAULT_HEAT_MAP_SOLID_VALUE, !m_canTraverseWater);
+		m_map->PopulateDistanceMapWithStationaryEntities(*m_solidMap, IntVec2(GetPosition()), DEFAULT_HEAT_MAP_SOLID_VALUE, !HasPhysicsFlag(PHYSICS_FLAG_CAN_TRAVERSE_WATER));
 		m_targetPos = m_map->GetRandomTraversablePosFromSolidMap(m_solidMap);
-		m_map->PopulateDistanceMapWithStationaryEntities(*m_roamDistanceMap, IntVec2(m_targetPos), DEFAULT_HEAT_MAP_SOLID_VALUE, !m_canTraverseWater);
-		m_map->GenerateEntityPathToTargetPos(m_pathToTarget, *m_roamDistanceMap, m_position);
+		m_map->PopulateDistanceMapWithStationaryEntities(*m_roamDistanceMap, IntVec2(m_targetPos), DEFAULT_HEAT_MAP_SOLID_VALUE, !HasPhysicsFlag(PHYSICS_FLAG_CAN_TRAVERSE_WATER));
+		m_map->GenerateEntityPathToTargetPos(m_pathToTarget, *m_roamDistanceMap, GetPosition());
 		m_nextWaypointPos = m_pathToTarget.back();
 		m_targetPos = m_pathToTarget.front();
 	}
@@ -54,17 +111,17 @@ void Entity::InitPathFinding()
 Vec2 const Entity::UpdateEntityPathFinding(float deltaSeconds)
 {
 	TileHeatMap* distanceMapToPlayer = m_map->m_distanceMapToPlayer;
-	if (m_canTraverseWater)
+	if (HasPhysicsFlag(PHYSICS_FLAG_CAN_TRAVERSE_WATER))
 	{
 		distanceMapToPlayer = m_map->m_amphibianDistanceMapToPlayer;
 	}
 
-	Vec2 playerPos = g_game->m_player->m_position;
+	Vec2 playerPos = g_game->m_player->GetPosition();
 	IntVec2 playerTileCoords = m_map->GetTileCoordsFromPosition(playerPos);
-	if (m_map->HasLineOfSight(m_position, playerPos, m_sightRange) && IsTileAccessible(playerTileCoords))
+	if (m_map->HasLineOfSight(GetPosition(), playerPos, m_sightRange) && IsTileAccessible(playerTileCoords))
 	{
 		m_chasingPlayerLocation = true;
-		m_map->GenerateEntityPathToTargetPos(m_pathToTarget, *distanceMapToPlayer, m_position, static_cast<int>(m_sightRange));
+		m_map->GenerateEntityPathToTargetPos(m_pathToTarget, *distanceMapToPlayer, GetPosition(), static_cast<int>(m_sightRange));
 		m_targetPos = m_pathToTarget.front();
 
 		if (IsOnTileAdjacentToPlayer())
@@ -80,19 +137,19 @@ Vec2 const Entity::UpdateEntityPathFinding(float deltaSeconds)
 	Vec2 fwrdNormal = UpdatePositionAndOrientation(deltaSeconds);
 
 	//Update waypoint position whenever entity arrives at the next one
-	if (IsOnTargetTile(m_position, m_nextWaypointPos))
+	if (IsOnTargetTile(GetPosition(), m_nextWaypointPos))
 	{
 		SetNextWaypoint(fwrdNormal);
 	}
 
 	//Update target position when arrived at target tile
-	if (IsOnTargetTile(m_position, m_targetPos) || m_pathToTarget.size() < 1)
+	if (IsOnTargetTile(GetPosition(), m_targetPos) || m_pathToTarget.size() < 1)
 	{
 		if (!m_chasingPlayerLocation)
 		{
 			m_targetPos = m_map->GetRandomTraversablePosFromSolidMap(m_solidMap);
-			m_map->PopulateDistanceMapWithStationaryEntities(*m_roamDistanceMap, IntVec2(m_targetPos), DEFAULT_HEAT_MAP_SOLID_VALUE, !m_canTraverseWater);
-			m_map->GenerateEntityPathToTargetPos(m_pathToTarget, *m_roamDistanceMap, m_position);
+			m_map->PopulateDistanceMapWithStationaryEntities(*m_roamDistanceMap, IntVec2(m_targetPos), DEFAULT_HEAT_MAP_SOLID_VALUE, !HasPhysicsFlag(PHYSICS_FLAG_CAN_TRAVERSE_WATER));
+			m_map->GenerateEntityPathToTargetPos(m_pathToTarget, *m_roamDistanceMap, GetPosition());
 			m_nextWaypointPos = m_pathToTarget.back();
 		}
 
@@ -110,23 +167,23 @@ void Entity::SetNextWaypoint(Vec2 const& fwrdNormal)
 	int nextIndex = static_cast<int>(m_pathToTarget.size() - 2);
 
 	//Raycast from center
-	if (!m_map->HasLineOfSight(m_position, m_pathToTarget[nextIndex], m_sightRange, *m_roamDistanceMap))
+	if (!m_map->HasLineOfSight(GetPosition(), m_pathToTarget[nextIndex], m_sightRange, *m_roamDistanceMap))
 		return;
 
 	Vec2 jBasis = fwrdNormal.GetRotated90Degrees();
-	Vec2 offset = jBasis * m_physicsRadius;
+	Vec2 offset = jBasis * GetPhysicsRadius();
 
 	//Raycast from left wing forward
-	if (!m_map->HasLineOfSight(m_position + offset, m_pathToTarget[nextIndex] + offset, m_sightRange, *m_roamDistanceMap))
+	if (!m_map->HasLineOfSight(GetPosition() + offset, m_pathToTarget[nextIndex] + offset, m_sightRange, *m_roamDistanceMap))
 		return;
 
 	//Raycast from right wing forward
-	if (!m_map->HasLineOfSight(m_position - offset, m_pathToTarget[nextIndex] - offset, m_sightRange, *m_roamDistanceMap))
+	if (!m_map->HasLineOfSight(GetPosition() - offset, m_pathToTarget[nextIndex] - offset, m_sightRange, *m_roamDistanceMap))
 		return;
 
 	m_pathToTarget.pop_back();
 
-	if (GetDistanceSquared2D(m_position, m_pathToTarget.back()) < (m_physicsRadius * m_physicsRadius) && m_pathToTarget.size() < 2)
+	if (GetDistanceSquared2D(GetPosition(), m_pathToTarget.back()) < (GetPhysicsRadius() * GetPhysicsRadius()) && m_pathToTarget.size() < 2)
 	{
 		m_pathToTarget.pop_back();
 	}
@@ -142,7 +199,7 @@ void Entity::RegenerateSolidMap()
 	if (m_solidMap == nullptr)
 		return;
 
-	m_map->PopulateDistanceMapWithStationaryEntities(*m_solidMap, IntVec2(m_position), DEFAULT_HEAT_MAP_SOLID_VALUE, !m_canTraverseWater);
+	m_map->PopulateDistanceMapWithStationaryEntities(*m_solidMap, IntVec2(GetPosition()), DEFAULT_HEAT_MAP_SOLID_VALUE, !HasPhysicsFlag(PHYSICS_FLAG_CAN_TRAVERSE_WATER));
 }
 
 //Update flow
@@ -157,7 +214,7 @@ void Entity::UpdateTimers(float deltaSeconds)
 Vec2 const Entity::UpdatePositionAndOrientation(float deltaSeconds)
 {
 	//Rotate towards waypoint
-	Vec2 dispToNextWaypoint = m_nextWaypointPos - m_position;
+	Vec2 dispToNextWaypoint = m_nextWaypointPos - GetPosition();
 	m_orientationDegrees = GetTurnedTowardDegrees(m_orientationDegrees, dispToNextWaypoint.GetOrientationDegrees(), m_turnSpeed * deltaSeconds);
 	Vec2 fwrdNormal = GetForwardNormal(); //update forward normal after rotation
 
@@ -166,8 +223,8 @@ Vec2 const Entity::UpdatePositionAndOrientation(float deltaSeconds)
 	//Update position if within drive apeture
 	if (angleToWaypoint <= m_driveAperture && angleToWaypoint >= -m_driveAperture)
 	{
-		m_velocity = fwrdNormal * m_moveSpeed * deltaSeconds;
-		m_position += m_velocity;
+		SetVelocity(fwrdNormal * m_moveSpeed * deltaSeconds);
+		SetPosition(GetPosition() + GetVelocity());
 	}
 
 	return fwrdNormal;
@@ -184,17 +241,17 @@ void Entity::TryShootBullet(EntityType bulletType, EntityFaction faction, Vec2 c
 			return;
 
 		//Quit if angle not close enough to player
-		Vec2 playerPos = g_game->m_player->m_position;
-		Vec2 dispToPlayer = playerPos - m_position;
+		Vec2 playerPos = g_game->m_player->GetPosition();
+		Vec2 dispToPlayer = playerPos - GetPosition();
 		float angleToPlayer = GetAngleDegreesBetweenVectors2D(dispToPlayer, fwrdNormal);
 
 		if (angleToPlayer > m_fireAperture || angleToPlayer < -m_fireAperture)
 			return;
 	}
 	
-	Vec2 bulletSpawnPos = m_position + fwrdNormal * m_bulletSpawnOffset;
+	Vec2 bulletSpawnPos = GetPosition() + fwrdNormal * m_bulletSpawnOffset;
 	Entity* bullet = m_map->SpawnNewEntity(bulletType, faction);
-	bullet->m_position = bulletSpawnPos;
+	bullet->SetPosition(bulletSpawnPos);
 	bullet->m_orientationDegrees = fwrdNormal.GetOrientationDegrees();
 
 	if (m_fireSFXAge >= SFX_PLAY_RATE)
@@ -204,17 +261,17 @@ void Entity::TryShootBullet(EntityType bulletType, EntityFaction faction, Vec2 c
 
 		switch (bulletType)
 		{
-		case ENTITY_TYPE_GOOD_BOLT: g_game->PlayGameSFX(BOLT_FIRED, m_position);
+		case ENTITY_TYPE_GOOD_BOLT: g_game->PlayGameSFX(BOLT_FIRED, GetPosition());
 			break;
-		case ENTITY_TYPE_GOOD_BULLET: g_game->PlayGameSFX(BULLET_FIRED, m_position);
+		case ENTITY_TYPE_GOOD_BULLET: g_game->PlayGameSFX(BULLET_FIRED, GetPosition());
 			break;
-		case ENTITY_TYPE_EVIL_BOLT: g_game->PlayGameSFX(BOLT_FIRED, m_position);
+		case ENTITY_TYPE_EVIL_BOLT: g_game->PlayGameSFX(BOLT_FIRED, GetPosition());
 			break;
-		case ENTITY_TYPE_EVIL_BULLET: g_game->PlayGameSFX(BULLET_FIRED, m_position);
+		case ENTITY_TYPE_EVIL_BULLET: g_game->PlayGameSFX(BULLET_FIRED, GetPosition());
 			break;
-		case ENTITY_TYPE_EVIL_SHELL: g_game->PlayGameSFX(BULLET_FIRED, m_position);
+		case ENTITY_TYPE_EVIL_SHELL: g_game->PlayGameSFX(BULLET_FIRED, GetPosition());
 			break;
-		case ENTITY_TYPE_EVIL_BOUNCING_BOLT: g_game->PlayGameSFX(BOLT_FIRED, m_position);
+		case ENTITY_TYPE_EVIL_BOUNCING_BOLT: g_game->PlayGameSFX(BOLT_FIRED, GetPosition());
 			break;
 		}
 	}
@@ -239,7 +296,7 @@ void Entity::LoseHealth(float amount)
 	m_health -= amount;
 	if (m_damageSFXAge >= SFX_PLAY_RATE)
 	{
-		g_game->PlayGameSFX(ENEMY_DAMAGED, m_position);
+		g_game->PlayGameSFX(ENEMY_DAMAGED, GetPosition());
 		m_damageSFXAge = 0.f;
 	}
 
@@ -251,10 +308,10 @@ void Entity::LoseHealth(float amount)
 
 void Entity::Die()
 {
-	m_isGarbage = true;
+	m_map->DestroyEntity(this);
 	m_isDead = true;
-	m_map->SpawnExplosion(m_position, DEATH_EXPLOSION_SIZE, DEATH_EXPLOSION_DURATION);
-	g_game->PlayGameSFX(ENEMY_KILLED, m_position);
+	m_map->SpawnExplosion(GetPosition(), DEATH_EXPLOSION_SIZE, DEATH_EXPLOSION_DURATION);
+	g_game->PlayGameSFX(ENEMY_KILLED, GetPosition());
 
 	if (m_isDebugTrackedEntity)
 	{
@@ -270,18 +327,18 @@ void Entity::DebugRender() const
 	std::vector<Vertex_PCU> debugVerts;
 
 	//Physics Ring
-	AddVertsForRing2D(debugVerts, m_position, m_physicsRadius, m_debugLineThickness, Rgba8(0, 255, 255));
+	AddVertsForRing2D(debugVerts, GetPosition(), GetPhysicsRadius(), m_debugLineThickness, Rgba8(0, 255, 255));
 
 	//Forward Vector
 	Vec2 vecFwrd = GetForwardNormal() * m_cosmeticRadius;
-	AddVertsForLineSegment2D(debugVerts, m_position, m_position + vecFwrd, m_debugLineThickness, Rgba8(255, 0, 0));
+	AddVertsForLineSegment2D(debugVerts, GetPosition(), GetPosition() + vecFwrd, m_debugLineThickness, Rgba8(255, 0, 0));
 
 	//Left Vector
 	Vec2 vecLeft = vecFwrd.GetRotated90Degrees();
-	AddVertsForLineSegment2D(debugVerts, m_position, m_position + vecLeft, m_debugLineThickness, Rgba8(0, 255, 0));
+	AddVertsForLineSegment2D(debugVerts, GetPosition(), GetPosition() + vecLeft, m_debugLineThickness, Rgba8(0, 255, 0));
 
 	//Velocity Line
-	AddVertsForLineSegment2D(debugVerts, m_position, m_position + m_velocity, m_debugLineThickness, Rgba8(255, 255, 0));
+	AddVertsForLineSegment2D(debugVerts, GetPosition(), GetPosition() + GetVelocity(), m_debugLineThickness, Rgba8(255, 255, 0));
 
 	g_renderer->BindTexture(nullptr);
 	g_renderer->DrawVertexArray(debugVerts);
@@ -290,28 +347,33 @@ void Entity::DebugRender() const
 
 void Entity::TurnTowardsPosition(Vec2 const& targetPos, float maxTurnDegrees)
 {
-	Vec2 meToTargetDisp = targetPos - m_position;
+	Vec2 meToTargetDisp = targetPos - GetPosition();
 	float orientToTarget = meToTargetDisp.GetOrientationDegrees();
 	m_orientationDegrees = GetTurnedTowardDegrees(m_orientationDegrees, orientToTarget, maxTurnDegrees);
 }
 
-void Entity::AddVertsForHealthBar(std::vector<Vertex_PCU>& verts) const
+void Entity::AddQuadInstancesForHealthBar(std::vector<QuadInstance2D>& instances) const
 {
-	Vec2 healthBarCenter(m_position.x, m_position.y + 0.35f);
-	LineSegment2 healthBarLine(healthBarCenter, Vec2::ONE_TO_ZERO, 0.5f);
-	AddVertsForLineSegment2D(verts, healthBarLine, 0.07f, Rgba8::RED);
+	//same footprint as the old 0.07 thick line segments, whose ends stick out by half the thickness
+	constexpr float HALF_LENGTH = 0.25f;
+	constexpr float HALF_THICKNESS = 0.035f;
+	Vec2 healthBarCenter(GetPosition().x, GetPosition().y + 0.35f);
+	instances.push_back(QuadInstance2D(AABB2(-HALF_LENGTH - HALF_THICKNESS, -HALF_THICKNESS, HALF_LENGTH + HALF_THICKNESS, HALF_THICKNESS), Vec2(1.f, 0.f), healthBarCenter, Rgba8::RED));
 
-	float xPos = RangeMapClamped(static_cast<float>(m_health), 0.f, static_cast<float>(m_maxHealth), healthBarLine.m_start.x, healthBarLine.m_end.x);
-	AddVertsForLineSegment2D(verts, healthBarLine.m_start, Vec2(xPos, healthBarLine.m_end.y), 0.07f, Rgba8::GREEN);
+	if (m_health <= 0)
+		return;
+
+	float fillMaxX = RangeMapClamped(static_cast<float>(m_health), 0.f, static_cast<float>(m_maxHealth), -HALF_LENGTH, HALF_LENGTH);
+	instances.push_back(QuadInstance2D(AABB2(-HALF_LENGTH - HALF_THICKNESS, -HALF_THICKNESS, fillMaxX + HALF_THICKNESS, HALF_THICKNESS), Vec2(1.f, 0.f), healthBarCenter, Rgba8::GREEN));
 }
 
 //Accessors
 //----------------------------------------------------------------------
 bool Entity::IsOnTileAdjacentToPlayer() const
 {
-	Vec2 playerPos = m_map->m_game->m_player->m_position;
+	Vec2 playerPos = m_map->m_game->m_player->GetPosition();
 	IntVec2 playerTileCoords = m_map->GetTileCoordsFromPosition(playerPos);
-	IntVec2 currentTileCoords = m_map->GetTileCoordsFromPosition(m_position);
+	IntVec2 currentTileCoords = m_map->GetTileCoordsFromPosition(GetPosition());
 	if (GetDistanceSquared2D(m_map->GetTileCenterPosFromTileCoords(playerTileCoords), m_map->GetTileCenterPosFromTileCoords(currentTileCoords)) <= 1.25f * 1.25f)
 	{
 		return true;
@@ -325,7 +387,7 @@ bool Entity::CanTravelToPlayer() const
 	if(m_solidMap == nullptr)
 		return true;
 
-	Vec2 playerPos = g_game->m_player->m_position;
+	Vec2 playerPos = g_game->m_player->GetPosition();
 	int tileIndex = m_map->GetTileIndexFromPosition(playerPos);
 	float tileSolidMapValue = m_solidMap->GetValue(tileIndex);
 
@@ -338,7 +400,16 @@ bool Entity::CanSeePlayer(float sightRange) const
 	if (!player->IsAlive())
 		return false;
 
-	return m_map->HasLineOfSight(m_position, player->m_position, sightRange);
+	return m_map->HasLineOfSight(GetPosition(), player->GetPosition(), sightRange);
+}
+
+AABB2 const Entity::GetRenderBounds() const
+{
+	//entity bounds are local and rotate with the entity, so use the distance to their furthest corner
+	float halfWidth = fmaxf(fabsf(m_entityBounds.m_mins.x), fabsf(m_entityBounds.m_maxs.x));
+	float halfHeight = fmaxf(fabsf(m_entityBounds.m_mins.y), fabsf(m_entityBounds.m_maxs.y));
+	float radius = fmaxf(Vec2(halfWidth, halfHeight).GetLength(), m_cosmeticRadius);
+	return AABB2(GetPosition() - Vec2(radius, radius), GetPosition() + Vec2(radius, radius));
 }
 
 Vec2 const Entity::GetForwardNormal() const
@@ -373,7 +444,7 @@ bool Entity::IsTileAccessible(IntVec2 const& tileCoords) const
 bool const Entity::DidChangeTile() const
 {
 	IntVec2 lastTileCoords = m_map->GetTileCoordsFromPosition(m_positionLastFrame);
-	IntVec2 currentTileCoords = m_map->GetTileCoordsFromPosition(m_position);
+	IntVec2 currentTileCoords = m_map->GetTileCoordsFromPosition(GetPosition());
 	return lastTileCoords != currentTileCoords;
 }
 
@@ -2,6 +2,8 @@
 #include "Engine/Math/Vec2.hpp"
 #include "Engine/Math/AABB2.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Core/QuadInstance2D.hpp"
+#include "Game/GameCommon.hpp"
 #include <vector>
 
 class Game;
@@ -9,6 +11,8 @@ class Texture;
 struct IntVec2;
 class TileHeatMap;
 class Map;
+class SpriteBatch2D;
+class Entity;
 
 
 enum EntityFaction : int
@@ -42,20 +46,61 @@ enum EntityType : int
 	NUM_ENTITY_TYPES
 };
 
+enum EntityPhysicsFlags : unsigned char
+{
+	PHYSICS_FLAG_NONE					= 0,
+	PHYSICS_FLAG_DOES_PUSH_ENTITIES		= 1 << 0,
+	PHYSICS_FLAG_IS_PUSHED_BY_ENTITIES	= 1 << 1,
+	PHYSICS_FLAG_IS_PUSHED_BY_WALLS		= 1 << 2,
+	PHYSICS_FLAG_IS_HIT_BY_BULLETS		= 1 << 3,
+	PHYSICS_FLAG_CAN_TRAVERSE_WATER		= 1 << 4,
+};
+
+//Hot physics state for the entities of one type on a map. The table owns it and each entity only keeps its row,
+//so the push-out and bullet loops stream over contiguous arrays instead of chasing Entity pointers.
+//Removing a row moves the last row into its place
+struct EntityPhysicsTable
+{
+	int		GetNumRows() const { return static_cast<int>(m_entities.size()); }
+	void	AddRow(Entity* entity, EntityFaction faction); //gives the entity its row, at the origin with the default radius and flags
+	void	RemoveRow(int row); //the entity moved into row is told its new index
+	void	CopyRow(int row, EntityPhysicsTable const& sourceTable, int sourceRow);
+
+	std::vector<Entity*> m_entities;
+	std::vector<float> m_positionsX;
+	std::vector<float> m_positionsY;
+	std::vector<float> m_velocitiesX;
+	std::vector<float> m_velocitiesY;
+	std::vector<float> m_physicsRadii;
+	std::vector<unsigned char> m_flags;
+	std::vector<EntityFaction> m_factions;
+};
+
 class Entity
 {
 	friend class Map;
+	friend struct EntityPhysicsTable;
 public:
 	void ReplenishHealth();
 	virtual void LoseHealth(float amount = 1.f);
 
+	//Physics state, read from and written to this entity's row in the map's EntityPhysicsTable
+	Vec2 const GetPosition() const { return Vec2(m_physicsTable->m_positionsX[m_physicsRow], m_physicsTable->m_positionsY[m_physicsRow]); }
+	void SetPosition(Vec2 const& position) { m_physicsTable->m_positionsX[m_physicsRow] = position.x; m_physicsTable->m_positionsY[m_physicsRow] = position.y; }
+	Vec2 const GetVelocity() const { return Vec2(m_physicsTable->m_velocitiesX[m_physicsRow], m_physicsTable->m_velocitiesY[m_physicsRow]); }
+	void SetVelocity(Vec2 const& velocity) { m_physicsTable->m_velocitiesX[m_physicsRow] = velocity.x; m_physicsTable->m_velocitiesY[m_physicsRow] = velocity.y; }
+	float GetPhysicsRadius() const { return m_physicsTable->m_physicsRadii[m_physicsRow]; }
+	void SetPhysicsRadius(float physicsRadius) { m_physicsTable->m_physicsRadii[m_physicsRow] = physicsRadius; }
+	bool HasPhysicsFlag(EntityPhysicsFlags flag) const { return (m_physicsTable->m_flags[m_physicsRow] & flag) != 0; }
+	void SetPhysicsFlag(EntityPhysicsFlags flag, bool isSet);
+
 protected:
 	explicit Entity(Map* const& mapOwner, EntityType entityType, EntityFaction faction, Vec2 const& startingPosition, float orientationDeg); 
 	explicit Entity(Map* const& mapOwner, EntityType entityType, EntityFaction faction);
 	virtual ~Entity();
 
 	virtual void Update(float deltaSeconds) = 0; 
-	virtual void Render() const = 0;
+	virtual void Render(SpriteBatch2D& spriteBatch) const = 0; //submits sprites, the map draws the batch once for all entities
 	virtual void DebugRender() const;
 
 	//Mutators
@@ -75,8 +120,8 @@ protected:
 	virtual Vec2 const UpdatePositionAndOrientation(float deltaSeconds); //returns fwrd Vector
 	void TryShootBullet(EntityType bulletType, EntityFaction faction, Vec2 const& fwrdNormal, bool isPlayer = false);
 
-	//for rendering health bars
-	void AddVertsForHealthBar(std::vector<Vertex_PCU>& verts) const;
+	//for rendering health bars, a red background quad and a green fill quad
+	void AddQuadInstancesForHealthBar(std::vector<QuadInstance2D>& instances) const;
 
 	//Accessors
 	//----------------------------------------------------------------------
@@ -85,6 +130,7 @@ protected:
 	bool IsTileAccessible(IntVec2 const& tileCoords) const;
 
 	Vec2 const GetForwardNormal() const;
+	virtual AABB2 const GetRenderBounds() const; //world space bounds of everything Render draws, used for culling
 	Texture* GetTexture() const;
 	virtual bool CanSeePlayer(float sightRange) const;
 	bool CanTravelToPlayer() const;
@@ -98,10 +144,6 @@ private:
 	virtual void CreateTexture() = 0;
 	bool const IsEntityBullet(EntityType entityType) const;
 
-public:
-	Vec2 m_position;
-	float m_physicsRadius = 0.3f;
-
 protected:
 	Map* m_map = nullptr;
 	EntityFaction m_entityFaction = FACTION_UNKNOWN;
@@ -109,6 +151,7 @@ protected:
 
 	//Appearance
 	Texture* m_texture = nullptr;
+	AABB2 m_textureUVs = AABB2::ZERO_TO_ONE; //sub-rect of m_texture when the image was packed into the entity atlas
 	AABB2 m_entityBounds;
 	float m_cosmeticRadius = .5f;
 	std::vector<Vertex_PCU> m_shapeVerts;
@@ -119,11 +162,14 @@ protected:
 	bool m_isDead = false;
 	bool m_isGarbage = false;
 
+	//Slots in the owning map's entity lists, for O(1) removal
+	int m_mapEntitySlot = -1;
+	int m_mapEntityTypeSlot = -1;
+
 	float m_damage = 1.f;
 	float m_fireCountdownTime = 0.f;
 
 	//Movement and orientation
-	Vec2 m_velocity;
 	Vec2 m_positionLastFrame;
 	float m_orientationDegrees = 0.f;
 	float m_moveSpeed;
@@ -132,11 +178,12 @@ protected:
 	float m_driveAperture;
 
 	//Physics
-	bool m_doesPushEntities = true;
-	bool m_isPushedByEntities = true;
-	bool m_isPushedByWalls = true;
-	bool m_isHitByBullets = true;
-	bool m_canTraverseWater = false;
+	EntityPhysicsTable* m_physicsTable = nullptr; //the owning map's table for this entity's type
+	int m_physicsRow = -1;
+
+	//AI scheduling
+	AILodTier m_aiLodTier = AI_LOD_TIER_NEAR;
+	float m_aiSecondsSinceTick = 0.f;
 
 	//Bullet firing
 	float m_fireAperture;
@@ -1,6 +1,8 @@
 #include "Game/Explosion.hpp"
 #include "Game/GameCommon.hpp"
-#include "Engine/Renderer/RendererDX11.hpp"
+#include "Game/Map.hpp"
+#include "Game/GameRenderer.hpp"
+#include "Engine/Renderer/SpriteBatch2D.hpp"
 #include "Engine/Core/VertexUtils.hpp"
 
 Explosion::Explosion(Map* const& mapOwner, Vec2 const& centerPos, AABB2 const& bounds, SpriteSheet const& spriteSheet, Rgba8 const& tint, SpriteAnimPlaybackType playbackType, int startIndex, int endIndex, float duration)
@@ -23,26 +25,17 @@ void Explosion::Update(float deltaSeconds)
 	}
 }
 
-void Explosion::Render() const
+void Explosion::Render(SpriteBatch2D& spriteBatch) const
 {
-	std::vector<Vertex_PCU> explosionVerts;
-
 	SpriteDefinition spriteDef = m_spriteAnimDef.GetSpriteDefAtTime(m_age);
-
-	AddVertsForAABB2D(explosionVerts, m_entityBounds, m_tint, spriteDef.GetUVS());
-
 	Vec2 fwrdNormal = GetForwardNormal();
-	TransformVertexArrayXY3D(explosionVerts, fwrdNormal, fwrdNormal.GetRotated90Degrees(), m_position);
-
-	g_renderer->SetBlendMode(BlendMode::ADDITIVE);
-	g_renderer->BindTexture(m_texture);
-	g_renderer->DrawVertexArray(explosionVerts);
+	spriteBatch.AddQuad(m_texture, BlendMode::ADDITIVE, ENTITY_RENDER_LAYER_EXPLOSION, m_entityBounds, fwrdNormal, fwrdNormal.GetRotated90Degrees(), GetPosition(), m_tint, spriteDef.GetUVS());
 }
 
 void Explosion::DebugRender() const
 {
 	std::vector<Vertex_PCU> debugVerts;
-	AddVertsForDisc2D(debugVerts, m_position, 0.025f, Rgba8::BLACK);
+	AddVertsForDisc2D(debugVerts, GetPosition(), 0.025f, Rgba8::BLACK);
 
 	g_renderer->SetBlendMode(BlendMode::ALPHA);
 	g_renderer->BindTexture(nullptr);
@@ -51,15 +44,15 @@ void Explosion::DebugRender() const
 
 void Explosion::Die()
 {
-	m_isGarbage = true;
+	m_map->DestroyEntity(this);
 	m_isDead = true;
 }
 
 void Explosion::UpdateGameConfigXmlData()
 {
-	m_isPushedByEntities = false;
-	m_doesPushEntities = false;
-	m_isHitByBullets = false;
+	SetPhysicsFlag(PHYSICS_FLAG_IS_PUSHED_BY_ENTITIES, false);
+	SetPhysicsFlag(PHYSICS_FLAG_DOES_PUSH_ENTITIES, false);
+	SetPhysicsFlag(PHYSICS_FLAG_IS_HIT_BY_BULLETS, false);
 }
 
 void Explosion::CreateTexture()
@@ -11,7 +11,7 @@ protected:
 	virtual ~Explosion(){}
 
 	virtual void Update(float deltaSeconds) override;
-	virtual void Render() const override;
+	virtual void Render(SpriteBatch2D& spriteBatch) const override;
 	virtual void DebugRender() const override;
 	virtual void Die() override;
 	virtual void UpdateGameConfigXmlData() override;
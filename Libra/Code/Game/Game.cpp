@@ -5,9 +5,10 @@
 #include "Game/Player.hpp"
 #include "Game/TileDefinition.hpp"
 #include "Game/MapDefinition.hpp"
+#include "Game/Benchmarks.hpp"
 
 #include <Engine/Core/ErrorWarningAssert.hpp>
-#include "Engine/Renderer/RendererDX11.hpp"
+#include "Game/GameRenderer.hpp"
 #include "Engine/Renderer/Camera.hpp"
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
@@ -27,9 +28,11 @@
 #include "Engine/Core/DevConsole.hpp"
 
 #include "Engine/Renderer/SpriteAnimDefinition.hpp"
+#include "Engine/Renderer/TextureAtlas.hpp"
 
 RandomNumberGenerator* g_rng;
 SpriteSheet* g_terrainSprites = nullptr;
+TextureAtlas* g_entityAtlas = nullptr;
 bool g_debugMode = false;
 bool g_showEntireMap = false;
 
@@ -43,7 +46,12 @@ Game::Game()
 	Texture* terrainTexture = g_renderer->CreateOrGetTextureFromFile("Data/Images/Terrain/Terrain_8x8.png");
 	g_terrainSprites = new SpriteSheet(*terrainTexture, IntVec2(8, 8));
 
+	m_attractScreenTexture = g_renderer->CreateOrGetTextureHandleAsync("Data/Images/AttractScreen.png");
+	m_gameOverScreenTexture = g_renderer->CreateOrGetTextureHandleAsync("Data/Images/YouDiedScreen.png");
+	m_gameWonScreenTexture = g_renderer->CreateOrGetTextureHandleAsync("Data/Images/VictoryScreen.jpg");
+
 	ParseGameConfigData();
+	CreateEntityAtlas();
 	LoadAllAudioAssets();
 	PlayGameMusic(ATTRACT_SCREEN);
 	CreateAllMaps();
@@ -54,6 +62,10 @@ Game::~Game()
 {
 	StopGameMusic(m_gameMusic);
 
+	g_renderer->ReleaseTexture(m_attractScreenTexture);
+	g_renderer->ReleaseTexture(m_gameOverScreenTexture);
+	g_renderer->ReleaseTexture(m_gameWonScreenTexture);
+
 	for (int mapIndex = 0; mapIndex < static_cast<int>(m_allMaps.size()); ++mapIndex)
 	{
 		delete m_allMaps[mapIndex];
@@ -67,6 +79,8 @@ Game::~Game()
 	m_screenCamera = nullptr;
 	delete g_rng;
 	g_rng = nullptr;
+	delete g_entityAtlas;
+	g_entityAtlas = nullptr;
 	
 }
 
@@ -152,49 +166,27 @@ void Game::LoadAllAudioAssets()
 	g_audioSystem->CreateOrGetSound("Data/Audio/Music/AttractMusic.mp3");
 	g_audioSystem->CreateOrGetSound("Data/Audio/Music/GameplayMusic.mp3");
 
-	m_sfxDataPathPairs.insert({ BUTTON_SELECT, "Data/Audio/SFX/Click.mp3" });
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/Click.mp3");
-
-	m_sfxDataPathPairs.insert({ PAUSE, "Data/Audio/SFX/Pause.mp3" });
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/Pause.mp3");
-
-	m_sfxDataPathPairs.insert({ UNPAUSE, "Data/Audio/SFX/Unpause.mp3" });
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/Unpause.mp3");
-
-	m_sfxDataPathPairs.insert({ BOLT_FIRED, "Data/Audio/SFX/BoltFired.wav" });
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/BoltFired.wav");
-
-	m_sfxDataPathPairs.insert({ BULLET_BOUNCE, "Data/Audio/SFX/BulletBounce.wav" });
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/BulletBounce.wav");
-
-	m_sfxDataPathPairs.insert({ BULLET_FIRED, "Data/Audio/SFX/BulletFired.wav" });
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/BulletFired.wav");
-
-	m_sfxDataPathPairs.insert({ ENEMY_DAMAGED, "Data/Audio/SFX/EnemyDamaged.wav" });
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/EnemyDamaged.wav");
-
-	m_sfxDataPathPairs.insert({ ENEMY_KILLED, "Data/Audio/SFX/EnemyDied.wav" });
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/EnemyDied.wav");
-
-	m_sfxDataPathPairs.insert({ GAME_OVER, "Data/Audio/SFX/GameOver.mp3" });
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/GameOver.mp3");
-
-	m_sfxDataPathPairs.insert({ GAME_VICTORY,"Data/Audio/SFX/GameVictory.wav" });
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/GameVictory.wav");
-
-	m_sfxDataPathPairs.insert({ NEW_LEVEL, "Data/Audio/SFX/NewLevel.mp3" });
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/NewLevel.mp3");
-
-	m_sfxDataPathPairs.insert({ PLAYER_KILLED,"Data/Audio/SFX/EnemyDied.wav" });
-
-	m_sfxDataPathPairs.insert({ PLAYER_DAMAGED, "Data/Audio/SFX/PlayerDamaged.wav" });
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerDamaged.wav");
-
-	m_sfxDataPathPairs.insert({ RESPAWN, "Data/Audio/SFX/Respawn.wav" });
-	g_audioSystem->CreateOrGetSound("Data/Audio/SFX/Respawn.wav");
+	//resolved once here so playing a sound effect is an array index instead of a path lookup
+	for (int sfxNum = 0; sfxNum < NUM_GAME_SFX; ++sfxNum)
+	{
+		m_sfxSoundIDs[sfxNum] = MISSING_SOUND_ID;
+	}
 
-	m_sfxDataPathPairs.insert({ LOOPING_FIRE, "Data/Audio/Music/LoopingFire.wav" });
-	g_audioSystem->CreateOrGetSound("Data/Audio/Music/LoopingFire.wav");
+	m_sfxSoundIDs[BUTTON_SELECT] = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/Click.mp3");
+	m_sfxSoundIDs[PAUSE] = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/Pause.mp3");
+	m_sfxSoundIDs[UNPAUSE] = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/Unpause.mp3");
+	m_sfxSoundIDs[BOLT_FIRED] = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/BoltFired.wav");
+	m_sfxSoundIDs[BULLET_BOUNCE] = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/BulletBounce.wav");
+	m_sfxSoundIDs[BULLET_FIRED] = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/BulletFired.wav");
+	m_sfxSoundIDs[ENEMY_DAMAGED] = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/EnemyDamaged.wav");
+	m_sfxSoundIDs[ENEMY_KILLED] = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/EnemyDied.wav");
+	m_sfxSoundIDs[GAME_OVER] = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/GameOver.mp3");
+	m_sfxSoundIDs[GAME_VICTORY] = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/GameVictory.wav");
+	m_sfxSoundIDs[NEW_LEVEL] = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/NewLevel.mp3");
+	m_sfxSoundIDs[PLAYER_KILLED] = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/EnemyDied.wav");
+	m_sfxSoundIDs[PLAYER_DAMAGED] = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/PlayerDamaged.wav");
+	m_sfxSoundIDs[RESPAWN] = g_audioSystem->CreateOrGetSound("Data/Audio/SFX/Respawn.wav");
+	m_sfxSoundIDs[LOOPING_FIRE] = g_audioSystem->CreateOrGetSound("Data/Audio/Music/LoopingFire.wav");
 }
 
 void Game::ParseGameConfigData()
@@ -206,6 +198,52 @@ void Game::ParseGameConfigData()
 
 	m_gameOverCountdown = g_gameConfigBlackboard.GetValue("gameOverCountdownTime", 3.f);
 	m_maxScreenShakeTrauma = g_gameConfigBlackboard.GetValue("maxScreenShakeTrauma", 10.f);
+
+	m_aiLodSettings.m_nearMargin = g_gameConfigBlackboard.GetValue("aiLodNearMargin", 2.f);
+	m_aiLodSettings.m_midRange = g_gameConfigBlackboard.GetValue("aiLodMidRange", 16.f);
+	m_aiLodSettings.m_maxCatchUpSeconds = g_gameConfigBlackboard.GetValue("aiLodMaxCatchUpSeconds", 0.5f);
+	m_aiLodSettings.m_tiers[AI_LOD_TIER_MID].m_tickIntervalSeconds = g_gameConfigBlackboard.GetValue("aiLodMidTickInterval", 0.1f);
+	m_aiLodSettings.m_tiers[AI_LOD_TIER_MID].m_maxTicksPerFrame = g_gameConfigBlackboard.GetValue("aiLodMidMaxTicksPerFrame", 8);
+	m_aiLodSettings.m_tiers[AI_LOD_TIER_FAR].m_tickIntervalSeconds = g_gameConfigBlackboard.GetValue("aiLodFarTickInterval", 0.25f);
+	m_aiLodSettings.m_tiers[AI_LOD_TIER_FAR].m_maxTicksPerFrame = g_gameConfigBlackboard.GetValue("aiLodFarMaxTicksPerFrame", 4);
+}
+
+void Game::CreateEntityAtlas()
+{
+	if (!g_gameConfigBlackboard.GetValue("entityAtlasEnabled", true))
+		return;
+
+	TextureAtlasConfig atlasConfig;
+	atlasConfig.m_pageDimensions = g_gameConfigBlackboard.GetValue("entityAtlasPageSize", IntVec2(2048, 2048));
+	atlasConfig.m_padding = g_gameConfigBlackboard.GetValue("entityAtlasPadding", 2);
+	atlasConfig.m_maxSpriteDimension = g_gameConfigBlackboard.GetValue("entityAtlasMaxSpriteSize", 512);
+	atlasConfig.m_cookedImageFolder = g_renderer->GetConfig().m_cookedTextureFolder;
+	g_entityAtlas = new TextureAtlas(atlasConfig);
+
+	//every image an entity or flame bullet draws with, so the whole entity layer can share a page
+	char const* configImagePaths[] =
+	{
+		"scorpioTexturePath", "scorpioTurretTexturePath", "leoTexturePath", "ariesTexturePath", "capricornTexturePath",
+		"aquariusTexturePath", "geminiTexturePath", "geminiTurretTexturePath", "explosionSpriteSheetTexture",
+	};
+	for (char const* configImagePath : configImagePaths)
+	{
+		std::string imageFilePath = g_gameConfigBlackboard.GetValue(configImagePath, "");
+		if (!imageFilePath.empty())
+		{
+			g_entityAtlas->AddImage(imageFilePath.c_str());
+		}
+	}
+
+	g_entityAtlas->AddImage("Data/Images/Tank/PlayerTankBase.png");
+	g_entityAtlas->AddImage("Data/Images/Tank/PlayerTankTop.png");
+	g_entityAtlas->AddImage("Data/Images/Bullets/FriendlyBullet.png");
+	g_entityAtlas->AddImage("Data/Images/Bullets/FriendlyBolt.png");
+	g_entityAtlas->AddImage("Data/Images/Bullets/EnemyBullet.png");
+	g_entityAtlas->AddImage("Data/Images/Bullets/EnemyBolt.png");
+	g_entityAtlas->AddImage("Data/Images/Bullets/EnemyShell.png");
+
+	g_entityAtlas->Build(g_renderer);
 }
 
 void Game::CreateAllMaps()
@@ -249,6 +287,18 @@ void Game::SubscribeToEvents()
 	SubscribeEventCallbackFunction("HealPlayer", HealPlayerEvent);
 	SubscribeEventCallbackFunction("ChangeTrackedLeo", ChangeTrackedLeoEvent);
 	SubscribeEventCallbackFunction("RegenerateSolidMapsForMobileEntities", RegenerateSolidMapsForMobileEntitiesEvent);
+	SubscribeEventCallbackFunction("AILodStats", AILodStatsEvent);
+	SubscribeEventCallbackFunction("RenderQueueStats", RenderQueueStatsEvent);
+#if defined(ENGINE_NULL_RENDERER)
+	SubscribeEventCallbackFunction("NullRendererStats", NullRendererStatsEvent);
+#endif
+
+	Strings aiLodTierArguments;
+	aiLodTierArguments.push_back("Tier=");
+	aiLodTierArguments.push_back("Interval=");
+	aiLodTierArguments.push_back("Budget=");
+	SubscribeEventCallbackFunction("AILodTier", aiLodTierArguments, AILodTierEvent);
+	SubscribeBenchmarkEvents();
 }
 
 //Change Map
@@ -600,7 +650,7 @@ void Game::RenderAttractMode() const
 	std::vector<Vertex_PCU> shapeVerts;
 	AddVertsForAABB2D(shapeVerts, AABB2(0.f, 0.f, m_screenDimensions.x, m_screenDimensions.y), Rgba8::WHITE);
 
-	Texture* attractTexture = g_renderer->CreateOrGetTextureFromFile("Data/Images/AttractScreen.png");
+	Texture* attractTexture = g_renderer->GetTexture(m_attractScreenTexture);
 
 	g_renderer->SetBlendMode(BlendMode::ALPHA);
 	g_renderer->BindTexture(attractTexture);
@@ -632,7 +682,7 @@ void Game::RenderGameOverMode() const
 	std::vector<Vertex_PCU> gameOverVerts;
 	AABB2 screenBounds(0.f, 0.f, m_screenDimensions.x, m_screenDimensions.y);
 	AddVertsForAABB2D(gameOverVerts, screenBounds, Rgba8::WHITE);
-	Texture* gameOverTexture = g_renderer->CreateOrGetTextureFromFile("Data/Images/YouDiedScreen.png");
+	Texture* gameOverTexture = g_renderer->GetTexture(m_gameOverScreenTexture);
 
 	g_renderer->SetBlendMode(BlendMode::ALPHA);
 	g_renderer->BindTexture(gameOverTexture);
@@ -647,7 +697,7 @@ void Game::RenderGameWonMode() const
 	std::vector<Vertex_PCU> gameWonVerts;
 	AABB2 screenBounds(0.f, 0.f, m_screenDimensions.x, m_screenDimensions.y);
 	AddVertsForAABB2D(gameWonVerts, screenBounds, Rgba8::WHITE);
-	Texture* gameWonTexture = g_renderer->CreateOrGetTextureFromFile("Data/Images/VictoryScreen.jpg");
+	Texture* gameWonTexture = g_renderer->GetTexture(m_gameWonScreenTexture);
 
 	g_renderer->SetBlendMode(BlendMode::ALPHA);
 	g_renderer->BindTexture(gameWonTexture);
@@ -739,32 +789,29 @@ void const Game::PlayGameMusic(GameMusic const& music)
 
 void const Game::PlayGameSFX(GameSFX const& sfx)
 {
-	auto found = m_sfxDataPathPairs.find(sfx);
-	if (found == m_sfxDataPathPairs.end())
+	SoundID newSound = m_sfxSoundIDs[sfx];
+	if (newSound == MISSING_SOUND_ID)
 		return;
 
-	SoundID newSound = g_audioSystem->CreateOrGetSound(found->second);
 	g_audioSystem->StartSound(newSound);
 }
 
 void const Game::PlayGameSFX(GameSFX const& sfx, Vec2 const& worldPos)
 {
-	auto found = m_sfxDataPathPairs.find(sfx);
-	if (found == m_sfxDataPathPairs.end())
+	SoundID newSound = m_sfxSoundIDs[sfx];
+	if (newSound == MISSING_SOUND_ID)
 		return;
 
-	SoundID newSound = g_audioSystem->CreateOrGetSound(found->second);
 	float balance = GetAudioBalanceFromWorldPosition(worldPos);
 	g_audioSystem->StartSound(newSound, false, 1.f, balance);
 }
 
 void const Game::PlayLoopingGameSFX(GameSFX const& sfx)
 {
-	auto foundSFX = m_sfxDataPathPairs.find(sfx);
-	if (foundSFX == m_sfxDataPathPairs.end())
+	SoundID newSound = m_sfxSoundIDs[sfx];
+	if (newSound == MISSING_SOUND_ID)
 		return;
 
-	SoundID newSound = g_audioSystem->CreateOrGetSound(foundSFX->second);
 	auto foundLoopingSFX = m_loopingSFXSoundPlaybackPairs.find(sfx);
 	if (foundLoopingSFX == m_loopingSFXSoundPlaybackPairs.end())
 	{
@@ -824,6 +871,65 @@ void Game::RegenerateSolidMapsForMobileEntities()
 	m_currentMap->RegenerateSolidMapsForMobileEntities();
 }
 
+void Game::PrintAILodStats() const
+{
+	static char const* const TIER_NAMES[NUM_AI_LOD_TIERS] = { "Near", "Mid", "Far" };
+
+	g_devConsole->AddLine(Rgba8::YELLOW, "--AI LOD tiers (last frame)--", 1.f, true);
+	for (int tierNum = 0; tierNum < NUM_AI_LOD_TIERS; ++tierNum)
+	{
+		AILodTierSettings const& tierSettings = m_aiLodSettings.m_tiers[tierNum];
+		AILodTierStats const& stats = m_currentMap->GetAILodTierStats(static_cast<AILodTier>(tierNum));
+		std::string budgetText = (tierSettings.m_maxTicksPerFrame < 0) ? std::string("none") : Stringf("%d", tierSettings.m_maxTicksPerFrame);
+		g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("%-4s interval %.2fs budget %-4s | enemies %3d ticked %3d deferred %3d | %.3fms",
+			TIER_NAMES[tierNum], tierSettings.m_tickIntervalSeconds, budgetText.c_str(), stats.m_numEntities, stats.m_numTicked, stats.m_numDeferred, stats.m_tickSeconds * 1000.0), 0.75f, true);
+	}
+}
+
+void Game::PrintRenderQueueStats() const
+{
+	RenderQueueStats const& stats = g_renderer->GetRenderQueue().GetLastStats();
+	g_devConsole->AddLine(Rgba8::YELLOW, "--Render queue (last frame)--", 1.f, true);
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("packets %d draws %d | blend changes %d shader changes %d texture changes %d",
+		stats.m_numPackets, stats.m_numDraws, stats.m_numBlendChanges, stats.m_numShaderChanges, stats.m_numTextureChanges), 0.75f, true);
+}
+
+#if defined(ENGINE_NULL_RENDERER)
+void Game::PrintNullRendererStats() const
+{
+	RendererNullStats const& lastFrame = g_renderer->GetLastFrameStats();
+	RendererNullStats const& total = g_renderer->GetTotalStats();
+	int numFrames = std::max(g_renderer->GetNumFrames(), 1);
+	g_devConsole->AddLine(Rgba8::YELLOW, "--Null renderer--", 1.f, true);
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("last frame  draws %d verts %d uploaded %.1fKB | blend %d raster %d texture %d shader %d",
+		lastFrame.m_numDrawCalls, lastFrame.m_numVertexesDrawn, static_cast<double>(lastFrame.m_numBytesUploaded) / 1024.0,
+		lastFrame.m_numBlendModeChanges, lastFrame.m_numRasterizerModeChanges, lastFrame.m_numTextureBinds, lastFrame.m_numShaderBinds), 0.75f, true);
+	g_devConsole->AddLine(DevConsole::INFO_MINOR, Stringf("%d frames   draws/frame %.1f verts/frame %.1f uploaded/frame %.1fKB",
+		g_renderer->GetNumFrames(), static_cast<double>(total.m_numDrawCalls) / numFrames, static_cast<double>(total.m_numVertexesDrawn) / numFrames,
+		static_cast<double>(total.m_numBytesUploaded) / 1024.0 / numFrames), 0.75f, true);
+}
+#endif
+
+void Game::SetAILodTierSettings(EventArgs& args)
+{
+	std::string tierName = args.GetValue("Tier", "", true);
+	AILodTier tier = NUM_AI_LOD_TIERS;
+	if (!_stricmp(tierName.c_str(), "near"))		tier = AI_LOD_TIER_NEAR;
+	else if (!_stricmp(tierName.c_str(), "mid"))	tier = AI_LOD_TIER_MID;
+	else if (!_stricmp(tierName.c_str(), "far"))	tier = AI_LOD_TIER_FAR;
+
+	if (tier == NUM_AI_LOD_TIERS)
+	{
+		g_devConsole->AddLine(DevConsole::ERROR, "AILodTier needs Tier=Near, Mid or Far", 0.75f, true);
+		return;
+	}
+
+	AILodTierSettings& tierSettings = m_aiLodSettings.m_tiers[tier];
+	tierSettings.m_tickIntervalSeconds = args.GetValue("Interval", tierSettings.m_tickIntervalSeconds, true);
+	tierSettings.m_maxTicksPerFrame = args.GetValue("Budget", tierSettings.m_maxTicksPerFrame, true);
+	PrintAILodStats();
+}
+
 bool Game::HealPlayerEvent(EventArgs& args)
 {
 	if (g_game != nullptr)
@@ -857,6 +963,51 @@ bool Game::RegenerateSolidMapsForMobileEntitiesEvent(EventArgs& args)
 	return false;
 }
 
+bool Game::AILodStatsEvent(EventArgs& args)
+{
+	UNUSED(args);
+	if (g_game != nullptr && g_game->m_currentMap != nullptr)
+	{
+		g_game->PrintAILodStats();
+		return true;
+	}
+	return false;
+}
+
+bool Game::RenderQueueStatsEvent(EventArgs& args)
+{
+	UNUSED(args);
+	if (g_game != nullptr)
+	{
+		g_game->PrintRenderQueueStats();
+		return true;
+	}
+	return false;
+}
+
+#if defined(ENGINE_NULL_RENDERER)
+bool Game::NullRendererStatsEvent(EventArgs& args)
+{
+	UNUSED(args);
+	if (g_game != nullptr)
+	{
+		g_game->PrintNullRendererStats();
+		return true;
+	}
+	return false;
+}
+#endif
+
+bool Game::AILodTierEvent(EventArgs& args)
+{
+	if (g_game != nullptr && g_game->m_currentMap != nullptr)
+	{
+		g_game->SetAILodTierSettings(args);
+		return true;
+	}
+	return false;
+}
+
 bool Game::Event_ShowGameControls(EventArgs& args)
 {
 	UNUSED(args);
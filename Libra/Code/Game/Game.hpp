@@ -4,6 +4,7 @@
 #include "Engine/Math/IntVec2.hpp"
 #include "Engine/Math/AABB2.hpp"
 #include "Engine/Core/EventSystem.hpp"
+#include "Engine/Renderer/Texture.hpp"
 #include <vector>
 #include <map>
 #include <string>
@@ -82,11 +83,18 @@ public:
 	void HealPlayer(EventArgs& args);
 	void ChangeTrackedLeo();
 	void RegenerateSolidMapsForMobileEntities();
+	void PrintAILodStats() const;
+	void PrintRenderQueueStats() const;
+#if defined(ENGINE_NULL_RENDERER)
+	void PrintNullRendererStats() const;
+#endif
+	void SetAILodTierSettings(EventArgs& args);
 
 private:
 
 	//Game Start
 	void ParseGameConfigData();
+	void CreateEntityAtlas();
 	void CreateAllMaps();
 	void SubscribeToEvents();
 
@@ -127,6 +135,12 @@ private:
 	static bool ChangeTrackedLeoEvent(EventArgs& args);
 	static bool RegenerateSolidMapsForMobileEntitiesEvent(EventArgs& args);
 	static bool Event_ShowGameControls(EventArgs& args);
+	static bool AILodStatsEvent(EventArgs& args);
+	static bool AILodTierEvent(EventArgs& args);
+	static bool RenderQueueStatsEvent(EventArgs& args);
+#if defined(ENGINE_NULL_RENDERER)
+	static bool NullRendererStatsEvent(EventArgs& args);
+#endif
 
 
 public:
@@ -151,6 +165,9 @@ public:
 	//Player
 	Entity* m_player = nullptr;
 
+	//AI scheduling, shared by every map
+	AILodSettings m_aiLodSettings;
+
 private:
 
 	//Camera
@@ -167,9 +184,14 @@ private:
 	float m_attractModeDiscRadius = 200.f;
 	float m_attractModeRingThickness = 20.f;
 
+	//Screen textures, loaded up front instead of on the first frame they show
+	TextureHandle m_attractScreenTexture;
+	TextureHandle m_gameOverScreenTexture;
+	TextureHandle m_gameWonScreenTexture;
+
 	//Audio
 	SoundPlaybackID m_gameMusic;
-	std::map<GameSFX, std::string> m_sfxDataPathPairs;
+	SoundID m_sfxSoundIDs[NUM_GAME_SFX] = {};
 	std::map<GameSFX, SoundPlaybackID> m_loopingSFXSoundPlaybackPairs;
 
 	//Timer
@@ -4,7 +4,22 @@
 #include "Engine/Math/Vec3.hpp"
 #include "Engine/Math/Vec2.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
-#include "Engine/Renderer/RendererDX11.hpp"
+#include "Game/GameRenderer.hpp"
+#include "Engine/Renderer/TextureAtlas.hpp"
+#include "Engine/Math/AABB2.hpp"
+
+Texture* GetOrCreateEntityTexture(std::string const& imageFilePath, AABB2& out_uvs)
+{
+	if (g_entityAtlas)
+	{
+		Texture* atlasTexture = g_entityAtlas->GetTextureAndUVs(imageFilePath.c_str(), out_uvs);
+		if (atlasTexture)
+			return atlasTexture;
+	}
+
+	out_uvs = AABB2::ZERO_TO_ONE;
+	return g_renderer->CreateOrGetTextureFromFile(imageFilePath.c_str());
+}
 
 void DebugDrawRing(Vec2 const& center, float radius, float thickness, Rgba8 const& color)
 {
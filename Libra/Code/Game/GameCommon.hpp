@@ -2,8 +2,16 @@
 #include "Engine/Math/Vec2.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Core/EngineCommon.hpp"
+#include "Game/EngineBuildPreferences.hpp"
+#include <string>
 
+#if defined(ENGINE_NULL_RENDERER)
+class RendererNull;
+typedef RendererNull GameRenderer;
+#else
 class RendererDX11;
+typedef RendererDX11 GameRenderer;
+#endif
 class App;
 class RandomNumberGenerator;
 class SpriteSheet;
@@ -13,8 +21,11 @@ class AudioSystem;
 class Window;
 class Game;
 class DevConsole;
+class TextureAtlas;
+class Texture;
+struct AABB2;
 
-extern RendererDX11* g_renderer;
+extern GameRenderer* g_renderer;
 extern App* g_app;
 extern RandomNumberGenerator* g_rng;
 extern InputSystem* g_inputSystem;
@@ -22,6 +33,7 @@ extern AudioSystem* g_audioSystem;
 extern Window* g_window;
 extern Game* g_game;
 extern SpriteSheet* g_terrainSprites;
+extern TextureAtlas* g_entityAtlas;
 extern DevConsole* g_devConsole;
 
 extern bool g_debugMode;
@@ -32,6 +44,9 @@ constexpr int MAX_NUM_WORM_TYPES = 4;
 constexpr int NUM_DEBUG_HEAT_MAPS = 5;
 constexpr float DEFAULT_HEAT_MAP_SOLID_VALUE = 9999.f;
 constexpr int TERRAIN_SPRITES_WIDTH = 8;
+constexpr int TILE_CHUNK_SIZE = 32; //tiles per side of a cached tile mesh chunk
+constexpr int ENTITY_GRID_CELL_SIZE = 4; //tiles per side of a render culling grid cell
+constexpr float ENTITY_GRID_MAX_RENDER_RADIUS = 1.f; //entities drawing further than this from their position skip the grid and are always tested
 
 constexpr float DEATH_EXPLOSION_SIZE = 1.f;
 constexpr float DEATH_EXPLOSION_DURATION = 1.f;
@@ -41,6 +56,44 @@ constexpr float BULLET_FIRE_EXPLOSION_DURATION = 0.5f;
 
 constexpr float SFX_PLAY_RATE = 0.2f;
 
+//Sprite batch layers for entities, higher layers draw on top
+enum EntityRenderLayer : int
+{
+	ENTITY_RENDER_LAYER_BODY,
+	ENTITY_RENDER_LAYER_BEAM,
+	ENTITY_RENDER_LAYER_TURRET,
+	ENTITY_RENDER_LAYER_OVERLAY,
+	ENTITY_RENDER_LAYER_PROJECTILE,
+	ENTITY_RENDER_LAYER_EXPLOSION,
+	NUM_ENTITY_RENDER_LAYERS,
+};
+
+//AI level of detail: enemies further from the camera and player think less often
+enum AILodTier : int
+{
+	AI_LOD_TIER_NEAR,	//on screen or just off it, ticks every frame
+	AI_LOD_TIER_MID,	//off screen but within m_midRange of the player
+	AI_LOD_TIER_FAR,
+	NUM_AI_LOD_TIERS
+};
+
+struct AILodTierSettings
+{
+	float m_tickIntervalSeconds = 0.f;
+	int m_maxTicksPerFrame = -1; //-1 for no budget
+};
+
+struct AILodSettings
+{
+	AILodTierSettings m_tiers[NUM_AI_LOD_TIERS];
+	float m_nearMargin = 2.f;			//tiles past the camera bounds still treated as on screen
+	float m_midRange = 16.f;
+	float m_maxCatchUpSeconds = 0.5f;	//cap on the delta handed to one tick, time over it carries to the next
+};
+
+//Returns the atlas page and the image's uvs on it if the image was packed, otherwise its own texture with 0-1 uvs
+Texture* GetOrCreateEntityTexture(std::string const& imageFilePath, AABB2& out_uvs);
+
 void DebugDrawRing(Vec2 const& center, float radius, float thickness, Rgba8 const& color);
 void DebugDrawLine2D(Vec2 const& start, Vec2 const& end, float thickness, Rgba8 color);
 
@@ -0,0 +1,9 @@
+#pragma once
+#include "Game/EngineBuildPreferences.hpp"
+
+//Pulls in whichever backend GameRenderer (GameCommon.hpp) resolves to
+#if defined(ENGINE_NULL_RENDERER)
+#include "Engine/Renderer/RendererNull.hpp"
+#else
+#include "Engine/Renderer/RendererDX11.hpp"
+#endif
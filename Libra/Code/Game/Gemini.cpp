@@ -1,7 +1,8 @@
 #include "Game/Gemini.hpp"
 #include "Game/Map.hpp"
 #include "Game/Game.hpp"
-#include "Engine/Renderer/RendererDX11.hpp"
+#include "Game/GameRenderer.hpp"
+#include "Engine/Renderer/SpriteBatch2D.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/VertexUtils.hpp"
 #include "Engine/Math/MathUtils.hpp"
@@ -28,50 +29,43 @@ Gemini::Gemini(Map* const& mapOwner, EntityType type, EntityFaction faction)
 
 void Gemini::Update(float deltaSeconds)
 {
-	m_positionLastFrame = m_position;
+	m_positionLastFrame = GetPosition();
 	UpdateTimers(deltaSeconds);
 	UpdateEntityPathFinding(deltaSeconds);
 }
 
-void Gemini::Render() const
+void Gemini::Render(SpriteBatch2D& spriteBatch) const
 {
 	//body
 	Vec2 fwrdNormal = GetForwardNormal();
-	std::vector<Vertex_PCU> worldVerts;
-	AddVertsForAABB2D(worldVerts, m_entityBounds, Rgba8::WHITE);
-
-	TransformVertexArrayXY3D(worldVerts, fwrdNormal, fwrdNormal.GetRotated90Degrees(), m_position);
-
-	g_renderer->SetBlendMode(BlendMode::ALPHA);
-	g_renderer->BindTexture(m_texture);
-	g_renderer->DrawVertexArray(worldVerts);
+	spriteBatch.AddQuad(m_texture, BlendMode::ALPHA, ENTITY_RENDER_LAYER_BODY, m_entityBounds, fwrdNormal, fwrdNormal.GetRotated90Degrees(), GetPosition(), Rgba8::WHITE, m_textureUVs);
 
 	//Laser
-	worldVerts.clear();
-	AddVertsForLineSegment2D(worldVerts, m_laserStartPos, m_raycastResult.m_impactPos, 0.05f, Rgba8(200, 100, 255, 200));
-	AddVertsForLineSegment2D(worldVerts, m_laserStartPos, m_raycastResult.m_impactPos, 0.1f, Rgba8(200, 0, 255, 100));
-
-	g_renderer->SetBlendMode(BlendMode::ADDITIVE);
-	g_renderer->BindTexture(nullptr);
-	g_renderer->DrawVertexArray(worldVerts);
+	std::vector<Vertex_PCU> laserVerts;
+	AddVertsForLineSegment2D(laserVerts, m_laserStartPos, m_raycastResult.m_impactPos, 0.05f, Rgba8(200, 100, 255, 200));
+	AddVertsForLineSegment2D(laserVerts, m_laserStartPos, m_raycastResult.m_impactPos, 0.1f, Rgba8(200, 0, 255, 100));
+	spriteBatch.AddVerts(nullptr, BlendMode::ADDITIVE, ENTITY_RENDER_LAYER_BEAM, laserVerts);
 	
 	//turret
-	worldVerts.clear();
 	fwrdNormal = Vec2::MakeFromPolarDegrees(m_turretOrientation);
-	AddVertsForAABB2D(worldVerts, m_turretBounds, Rgba8::WHITE);
-	TransformVertexArrayXY3D(worldVerts, fwrdNormal, fwrdNormal.GetRotated90Degrees(), m_position);
+	spriteBatch.AddQuad(m_turretTexture, BlendMode::ALPHA, ENTITY_RENDER_LAYER_TURRET, m_turretBounds, fwrdNormal, fwrdNormal.GetRotated90Degrees(), GetPosition(), Rgba8::WHITE, m_turretTextureUVs);
+}
 
-	g_renderer->SetBlendMode(BlendMode::ALPHA);
-	g_renderer->BindTexture(m_turretTexture);
-	g_renderer->DrawVertexArray(worldVerts);
+AABB2 const Gemini::GetRenderBounds() const
+{
+	//laser can reach well past the body
+	AABB2 renderBounds = Entity::GetRenderBounds();
+	renderBounds.StretchToIncludePoint(m_laserStartPos);
+	renderBounds.StretchToIncludePoint(m_raycastResult.m_impactPos);
+	return renderBounds;
 }
 
 void Gemini::Die()
 {
-	m_isGarbage = true;
+	m_map->DestroyEntity(this);
 	m_isDead = true;
-	g_game->PlayGameSFX(ENEMY_KILLED, m_position);
-	m_map->SpawnExplosion(m_position, DEATH_EXPLOSION_SIZE, DEATH_EXPLOSION_DURATION);
+	g_game->PlayGameSFX(ENEMY_KILLED, GetPosition());
+	m_map->SpawnExplosion(GetPosition(), DEATH_EXPLOSION_SIZE, DEATH_EXPLOSION_DURATION);
 
 	if (m_twinEntity && m_twinEntity->IsAlive())
 	{
@@ -81,7 +75,7 @@ void Gemini::Die()
 
 void Gemini::UpdateGameConfigXmlData()
 {
-	m_physicsRadius = g_gameConfigBlackboard.GetValue("geminiPhysicsRadius", 0.35f);
+	SetPhysicsRadius(g_gameConfigBlackboard.GetValue("geminiPhysicsRadius", 0.35f));
 	m_turnSpeed = g_gameConfigBlackboard.GetValue("geminiTurnRate", 45.f);
 	m_bulletSpawnOffset = g_gameConfigBlackboard.GetValue("geminiBulletSpawnOffset", 0.4f);
 	m_driveAperture = g_gameConfigBlackboard.GetValue("geminiDriveAperture", 45.f);
@@ -91,7 +85,7 @@ void Gemini::UpdateGameConfigXmlData()
 	m_health = m_maxHealth;
 	m_damage = g_gameConfigBlackboard.GetValue("geminiLaserDamage", 1.f);
 	m_sightRange = g_gameConfigBlackboard.GetValue("geminiSightRange", 10.f);
-	m_canTraverseWater = true;
+	SetPhysicsFlag(PHYSICS_FLAG_CAN_TRAVERSE_WATER, true);
 }
 
 Vec2 const Gemini::UpdateEntityPathFinding(float deltaSeconds)
@@ -100,7 +94,7 @@ Vec2 const Gemini::UpdateEntityPathFinding(float deltaSeconds)
 	SetNextWaypoint(fwrdNormal);
 
 	//Rotate towards waypoint
-	Vec2 dispToNextWaypoint = m_nextWaypointPos - m_position;
+	Vec2 dispToNextWaypoint = m_nextWaypointPos - GetPosition();
 	m_orientationDegrees = GetTurnedTowardDegrees(m_orientationDegrees, dispToNextWaypoint.GetOrientationDegrees(), m_turnSpeed * deltaSeconds);
 	fwrdNormal = GetForwardNormal(); //update forward normal after rotation
 
@@ -109,16 +103,16 @@ Vec2 const Gemini::UpdateEntityPathFinding(float deltaSeconds)
 	//Update position if within drive apeture
 	if (angleToWaypoint <= m_driveAperture && angleToWaypoint >= -m_driveAperture)
 	{
-		m_velocity = fwrdNormal * m_moveSpeed * deltaSeconds;
-		m_position += m_velocity;
+		SetVelocity(fwrdNormal * m_moveSpeed * deltaSeconds);
+		SetPosition(GetPosition() + GetVelocity());
 	}
 
 	//turret orientation
-	Vec2 dispToTwin = m_twinEntity->m_position - m_position;
+	Vec2 dispToTwin = m_twinEntity->GetPosition() - GetPosition();
 	float angleToTwin = dispToTwin.GetOrientationDegrees();
 	m_turretOrientation = GetTurnedTowardDegrees(m_turretOrientation, angleToTwin, 360.f);
 	Vec2 turretFwrdNormal = Vec2::MakeFromPolarDegrees(m_turretOrientation);
-	m_laserStartPos = m_position + (turretFwrdNormal * m_bulletSpawnOffset);
+	m_laserStartPos = GetPosition() + (turretFwrdNormal * m_bulletSpawnOffset);
 
 	//Raycast to twin
 	Ray2 laserRay;
@@ -130,7 +124,7 @@ Vec2 const Gemini::UpdateEntityPathFinding(float deltaSeconds)
 
 	//Raycast to player
 	Entity* player = g_game->m_player;
-	RaycastResult2D hitPlayerResult = RaycastVsDisc2D(m_position, turretFwrdNormal, m_raycastResult.m_impactDistance, player->m_position, player->m_physicsRadius);
+	RaycastResult2D hitPlayerResult = RaycastVsDisc2D(GetPosition(), turretFwrdNormal, m_raycastResult.m_impactDistance, player->GetPosition(), player->GetPhysicsRadius());
 	if (hitPlayerResult.m_didImpact)
 	{
 		player->LoseHealth(m_damage * deltaSeconds);
@@ -138,16 +132,16 @@ Vec2 const Gemini::UpdateEntityPathFinding(float deltaSeconds)
 
 
 	//Update waypoint position whenever entity arrives at the next one
-	if (IsOnTargetTile(m_position, m_nextWaypointPos))
+	if (IsOnTargetTile(GetPosition(), m_nextWaypointPos))
 	{
 		SetNextWaypoint(fwrdNormal);
 	}
 
-	if (IsOnTargetTile(m_position, m_targetPos) || m_pathToTarget.size() < 1)
+	if (IsOnTargetTile(GetPosition(), m_targetPos) || m_pathToTarget.size() < 1)
 	{
 		m_targetPos = m_map->GetRandomTraversablePosFromSolidMap(m_solidMap);
-		m_map->PopulateDistanceMapWithStationaryEntities(*m_roamDistanceMap, IntVec2(m_targetPos), DEFAULT_HEAT_MAP_SOLID_VALUE, !m_canTraverseWater);
-		m_map->GenerateEntityPathToTargetPos(m_pathToTarget, *m_roamDistanceMap, m_position);
+		m_map->PopulateDistanceMapWithStationaryEntities(*m_roamDistanceMap, IntVec2(m_targetPos), DEFAULT_HEAT_MAP_SOLID_VALUE, !HasPhysicsFlag(PHYSICS_FLAG_CAN_TRAVERSE_WATER));
+		m_map->GenerateEntityPathToTargetPos(m_pathToTarget, *m_roamDistanceMap, GetPosition());
 		m_nextWaypointPos = m_pathToTarget.back();
 	}
 
@@ -157,9 +151,9 @@ Vec2 const Gemini::UpdateEntityPathFinding(float deltaSeconds)
 void Gemini::CreateTexture()
 {
 	m_entityBounds = AABB2(-0.5f, -0.5f, 0.5f, 0.5f);
-	m_texture = g_renderer->CreateOrGetTextureFromFile(g_gameConfigBlackboard.GetValue("geminiTexturePath", "").c_str());
+	m_texture = GetOrCreateEntityTexture(g_gameConfigBlackboard.GetValue("geminiTexturePath", ""), m_textureUVs);
 	AddVertsForAABB2D(m_shapeVerts, m_entityBounds, Rgba8::WHITE);
 
 	m_turretBounds = m_entityBounds;
-	m_turretTexture = g_renderer->CreateOrGetTextureFromFile(g_gameConfigBlackboard.GetValue("geminiTurretTexturePath", "").c_str());
+	m_turretTexture = GetOrCreateEntityTexture(g_gameConfigBlackboard.GetValue("geminiTurretTexturePath", ""), m_turretTextureUVs);
 }
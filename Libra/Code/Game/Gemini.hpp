@@ -12,11 +12,12 @@ protected:
 	virtual ~Gemini() {}
 
 	virtual void Update(float deltaSeconds) override;
-	virtual void Render() const override;
+	virtual void Render(SpriteBatch2D& spriteBatch) const override;
 	virtual void Die() override;
 	virtual void UpdateGameConfigXmlData() override;
 
 	virtual Vec2 const UpdateEntityPathFinding(float deltaSeconds) override;
+	virtual AABB2 const GetRenderBounds() const override;
 	
 
 private: 
@@ -29,6 +30,7 @@ protected:
 private:
 	AABB2 m_turretBounds;
 	Texture* m_turretTexture = nullptr;
+	AABB2 m_turretTextureUVs = AABB2::ZERO_TO_ONE;
 	float m_turretOrientation;
 
 	RaycastResult2D m_raycastResult;
@@ -8,7 +8,7 @@ protected:
 	virtual ~Leo() {}
 
 	virtual void Update(float deltaSeconds) override;
-	virtual void Render() const override;
+	virtual void Render(SpriteBatch2D& spriteBatch) const override;
 	virtual void DebugRender() const override;
 	virtual void UpdateGameConfigXmlData() override;
 
@@ -16,9 +16,10 @@
 #include "Game/Explosion.hpp"
 
 #include "Engine/Renderer/Texture.hpp"
+#include "Engine/Renderer/VertexBuffer.hpp"
 #include "Engine/Core/Vertex_PCU.hpp"
 #include "Engine/Core/VertexUtils.hpp"
-#include "Engine/Renderer/RendererDX11.hpp"
+#include "Game/GameRenderer.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Input/InputSystem.hpp"
 #include "Engine/Renderer/SimpleTriangleFont.hpp"
@@ -29,12 +30,26 @@
 #include "Engine/Core/TileHeatMap.hpp"
 #include "Engine/Math/FloatRange.hpp"
 #include "Engine/Core/Image.hpp"
+#include "Engine/Core/Time.hpp"
 #include <queue>
 #include <string>
 #include <algorithm>
 
 bool g_noClipMode = false;
 
+//Indexed by TileNeighbourDirection
+static const IntVec2 TILE_NEIGHBOUR_OFFSETS[NUM_TILE_NEIGHBOURS] =
+{
+	IntVec2(0, 1),		//north
+	IntVec2(1, 0),		//east
+	IntVec2(0, -1),		//south
+	IntVec2(-1, 0),		//west
+	IntVec2(-1, 1),		//northwest
+	IntVec2(1, 1),		//northeast
+	IntVec2(1, -1),		//southeast
+	IntVec2(-1, -1),	//southwest
+};
+
 
 Map::Map(Game* const& game, int mapIndex, MapDefinition* const m_mapDefinition)
 	:m_game(game)
@@ -45,18 +60,42 @@ Map::Map(Game* const& game, int mapIndex, MapDefinition* const m_mapDefinition)
 	Texture* terrainTexture = g_renderer->CreateOrGetTextureFromFile(g_gameConfigBlackboard.GetValue("terrainSpriteSheetTexture","").c_str());
 	m_terrainSpriteSheet = new SpriteSheet(*terrainTexture, g_gameConfigBlackboard.GetValue("terrainSpriteSheetDimensions", IntVec2(8, 8)));
 
-	Texture* explosionTexture = g_renderer->CreateOrGetTextureFromFile(g_gameConfigBlackboard.GetValue("explosionSpriteSheetTexture", "").c_str());
-	m_explosionSpriteSheet = new SpriteSheet(*explosionTexture, g_gameConfigBlackboard.GetValue("explosionSpriteSheetDimensions", IntVec2(5, 5)));
+	AABB2 explosionUVs;
+	Texture* explosionTexture = GetOrCreateEntityTexture(g_gameConfigBlackboard.GetValue("explosionSpriteSheetTexture", ""), explosionUVs);
+	m_explosionSpriteSheet = new SpriteSheet(*explosionTexture, g_gameConfigBlackboard.GetValue("explosionSpriteSheetDimensions", IntVec2(5, 5)), explosionUVs);
 
 	m_startToEndDistanceMap = new TileHeatMap(m_dimensions);
 	m_debugHeatMaps[0] = m_startToEndDistanceMap;
 	SpawnTiles();
+	RebuildSolidNeighbourMasks();
+	CreateTileMeshChunks();
 }
 
 Map::~Map()
 {
 	m_tiles.clear();
 
+	for (int chunkNum = 0; chunkNum < static_cast<int>(m_tileMeshChunks.size()); ++chunkNum)
+	{
+		delete m_tileMeshChunks[chunkNum].m_vertexBuffer;
+		m_tileMeshChunks[chunkNum].m_vertexBuffer = nullptr;
+	}
+	m_tileMeshChunks.clear();
+
+	delete m_heatMapOverlay.m_vertexBuffer;
+	m_heatMapOverlay.m_vertexBuffer = nullptr;
+	delete m_tileInfoGridOverlay.m_vertexBuffer;
+	m_tileInfoGridOverlay.m_vertexBuffer = nullptr;
+	delete m_tileInfoTextOverlay.m_vertexBuffer;
+	m_tileInfoTextOverlay.m_vertexBuffer = nullptr;
+
+	for (int entityNum = 0; entityNum < static_cast<int>(m_pendingSpawnEntities.size()); ++entityNum)
+	{
+		delete m_pendingSpawnEntities[entityNum];
+	}
+	m_pendingSpawnEntities.clear();
+	m_garbageEntities.clear();
+
 	for (int entityNum = 0; entityNum < static_cast<int>(m_allEntities.size()); ++entityNum)
 	{
 		Entity* entity = m_allEntities[entityNum];
@@ -86,6 +125,7 @@ void Map::Update(float deltaSeconds)
 {
 	UpdateAndCheckOverrideTilesAge(deltaSeconds);
 	UpdateEntities(deltaSeconds);
+	RebuildDirtyTileMeshChunks();
 
 	if (g_inputSystem->WasKeyJustPressed(KEYCODE_F6))
 	{
@@ -103,20 +143,24 @@ void Map::Update(float deltaSeconds)
 	}
 	
 	UpdateGameCameraToFollowPlayer();
+	RebuildEntitySpatialGrid();
 }
 
 void Map::Render() const
 {
-	RenderTiles();
-	RenderDebugHeatMap();
-	RenderEntities();
-	RenderEntityHealthBars();
+	AABB2 visibleBounds = GetCameraWorldBounds();
+	GatherVisibleEntities(visibleBounds, m_visibleEntities);
+
+	RenderTiles(visibleBounds);
+	RenderDebugHeatMap(visibleBounds);
+	RenderEntities(m_visibleEntities);
 	RenderPauseOverlay();
-	RenderDebugTileInfo();
+	RenderDebugTileInfo(visibleBounds);
 }
 
 void Map::EndFrame()
 {
+	FlushPendingEntitySpawns();
 	DeleteGarbageEntities();
 }
 
@@ -439,9 +483,11 @@ void Map::InitHeatMaps()
 Entity* Map::SpawnNewEntity(EntityType entityType, EntityFaction faction)
 {
 	Entity* newEntity = CreateNewEntity(entityType, faction);
-	AddEntityToMap(newEntity);
+	if (newEntity != nullptr)
+	{
+		m_pendingSpawnEntities.push_back(newEntity);
+	}
 	return newEntity;
-
 }
 
 void Map::SpawnExplosion(Vec2 const& pos, float size, float duration, Rgba8 const& tint)
@@ -450,7 +496,16 @@ void Map::SpawnExplosion(Vec2 const& pos, float size, float duration, Rgba8 cons
 	AABB2 explosionBounds(-halfSize, -halfSize, halfSize, halfSize);
 	int lastIndex = m_explosionSpriteSheet->GetNumSprites() - 1;
 	Entity* newExplosion = new Explosion(this, pos, explosionBounds, *m_explosionSpriteSheet, tint, ONCE, 0, lastIndex, duration);
-	AddEntityToMap(newExplosion);
+	m_pendingSpawnEntities.push_back(newExplosion);
+}
+
+void Map::DestroyEntity(Entity* entity)
+{
+	if (entity == nullptr || entity->m_isGarbage)
+		return;
+
+	entity->m_isGarbage = true;
+	m_garbageEntities.push_back(entity);
 }
 
 void Map::SpawnInitialNpcs()
@@ -500,6 +555,9 @@ void Map::SpawnInitialNpcs()
 		initialNpcs.push_back(geminiSister);
 	}
 
+	//npcs need to be on the map before pathfinding looks for stationary entities
+	FlushPendingEntitySpawns();
+
 	std::vector<IntVec2> spawnableTileCoords = GetAllSpawnableTileCoordsForNpcs();
 
 	IntVec2 tileCoords;
@@ -510,7 +568,7 @@ void Map::SpawnInitialNpcs()
 		{
 			randomTileIndex = g_rng->RollRandomIntInRange(0, static_cast<int>(spawnableTileCoords.size() - 1));
 			tileCoords = spawnableTileCoords[randomTileIndex];
-			initialNpcs[npcNum]->m_position = GetTileCenterPosFromTileCoords(tileCoords);
+			initialNpcs[npcNum]->SetPosition(GetTileCenterPosFromTileCoords(tileCoords));
 			initialNpcs[npcNum]->InitPathFinding();
 			spawnableTileCoords.erase(spawnableTileCoords.begin() + randomTileIndex);
 		}
@@ -530,47 +588,125 @@ void Map::SpawnInitialNpcs()
 //-----------------------------------------------------------------------------------------------
 void Map::UpdateEntities(float deltaSeconds)
 {
-	for (int entityIndex = 0; entityIndex < static_cast<int>(m_allEntities.size()); ++entityIndex)
+	for (int tierNum = 0; tierNum < NUM_AI_LOD_TIERS; ++tierNum)
 	{
-		if (m_allEntities[entityIndex] != nullptr)
-		{
-			m_allEntities[entityIndex]->Update(deltaSeconds);
-		}
+		m_aiLodStats[tierNum] = AILodTierStats();
 	}
 
-	//Physics with each other
-	for (int entityIndex = 0; entityIndex < static_cast<int>(m_allEntities.size()); ++entityIndex)
+	//start from the first entity deferred last frame so tick budgets are handed out round robin
+	const int NUM_ENTITY_SLOTS = static_cast<int>(m_allEntities.size());
+	int startIndex = (m_aiScheduleStartIndex < NUM_ENTITY_SLOTS) ? m_aiScheduleStartIndex : 0;
+	m_aiScheduleStartIndex = -1;
+
+	//the camera doesn't move during entity updates, so the near tier bounds are found once for every entity
+	float nearMargin = m_game->m_aiLodSettings.m_nearMargin;
+	AABB2 nearTierBounds = GetCameraWorldBounds();
+	nearTierBounds.m_mins -= Vec2(nearMargin, nearMargin);
+	nearTierBounds.m_maxs += Vec2(nearMargin, nearMargin);
+
+	for (int entityNum = 0; entityNum < NUM_ENTITY_SLOTS; ++entityNum)
 	{
-		if (m_allEntities[entityIndex] != nullptr)
+		int entityIndex = (startIndex + entityNum) % NUM_ENTITY_SLOTS;
+		Entity* entity = m_allEntities[entityIndex];
+		if (entity == nullptr)
+			continue;
+
+		if (!IsEntityAIScheduled(entity))
 		{
-			PushEntityOutOfOverlappingEntities(m_allEntities[entityIndex]);
+			entity->Update(deltaSeconds);
+			continue;
 		}
-	}
 
-	//Wall physics
-	for (int entityIndex = 0; entityIndex < static_cast<int>(m_allEntities.size()); ++entityIndex)
-	{
-		if (m_allEntities[entityIndex] != nullptr)
+		if (!UpdateScheduledAIEntity(entity, deltaSeconds, nearTierBounds) && m_aiScheduleStartIndex < 0)
 		{
-			PushEntityOutOfSurroundingTiles(m_allEntities[entityIndex]);
+			m_aiScheduleStartIndex = entityIndex;
 		}
 	}
 
+	//Sync point: bullets and explosions spawned during update join physics this frame
+	FlushPendingEntitySpawns();
+
+	//Physics with each other
+	PushEntitiesOutOfEachOther();
+
+	//Wall physics
+	PushEntitiesOutOfSurroundingTiles();
+
 	//Bullet collision
-	for (int bulletListNum = ENTITY_TYPE_GOOD_BOLT; bulletListNum < NUM_ENTITY_TYPES - 1; ++bulletListNum)
+	for (int bulletType = ENTITY_TYPE_GOOD_BOLT; bulletType < NUM_ENTITY_TYPES - 1; ++bulletType)
 	{
-		EntityList bulletList = m_entityListByType[bulletListNum];
-		for (int bulletNum = 0; bulletNum < static_cast<int>(bulletList.size()); ++bulletNum)
+		EntityPhysicsTable& bulletTable = m_physicsTables[bulletType];
+		for (int bulletRow = 0; bulletRow < bulletTable.GetNumRows(); ++bulletRow)
 		{
-			CheckBulletCollision(bulletList[bulletNum]);
+			CheckBulletCollision(bulletTable, bulletRow);
 		}
 	}
 
+	//Sync point: explosions from bullet hits render this frame
+	FlushPendingEntitySpawns();
+}
+
+//AI scheduling
+//-----------------------------------------------------------------------------------------------
+bool Map::IsEntityAIScheduled(Entity const* entity) const
+{
+	//player, bullets and explosions always update at full rate
+	return entity->m_entityType >= ENTITY_TYPE_EVIL_SCORPIO && entity->m_entityType <= ENTITY_TYPE_EVIL_GEMINI_SISTER;
+}
+
+AILodTier Map::GetAILodTierForPosition(Vec2 const& position, AABB2 const& nearTierBounds) const
+{
+	AILodSettings const& settings = m_game->m_aiLodSettings;
+	if (position.x >= nearTierBounds.m_mins.x && position.x <= nearTierBounds.m_maxs.x
+		&& position.y >= nearTierBounds.m_mins.y && position.y <= nearTierBounds.m_maxs.y)
+	{
+		return AI_LOD_TIER_NEAR;
+	}
+
+	Vec2 playerPos = m_game->m_player->GetPosition();
+	if (GetDistanceSquared2D(position, playerPos) <= settings.m_midRange * settings.m_midRange)
+	{
+		return AI_LOD_TIER_MID;
+	}
+
+	return AI_LOD_TIER_FAR;
+}
+
+bool Map::UpdateScheduledAIEntity(Entity* entity, float deltaSeconds, AABB2 const& nearTierBounds)
+{
+	AILodSettings const& settings = m_game->m_aiLodSettings;
+	AILodTier tier = GetAILodTierForPosition(entity->GetPosition(), nearTierBounds);
+	AILodTierSettings const& tierSettings = settings.m_tiers[tier];
+	AILodTierStats& stats = m_aiLodStats[tier];
+	entity->m_aiLodTier = tier;
+	entity->m_aiSecondsSinceTick += deltaSeconds;
+	stats.m_numEntities++;
+
+	if (entity->m_aiSecondsSinceTick < tierSettings.m_tickIntervalSeconds)
+		return true;
+
+	//entities over budget keep their accumulated time and tick on a later frame, which staggers a tier across frames
+	if (tierSettings.m_maxTicksPerFrame >= 0 && stats.m_numTicked >= tierSettings.m_maxTicksPerFrame)
+	{
+		stats.m_numDeferred++;
+		return false;
+	}
+
+	//catch up on the time since the last tick so slow tiers don't fall behind. One tick covers at most m_maxCatchUpSeconds,
+	//the rest stays accumulated for the next tick instead of being dropped
+	float tickSeconds = std::min(entity->m_aiSecondsSinceTick, settings.m_maxCatchUpSeconds);
+	entity->m_aiSecondsSinceTick -= tickSeconds;
+
+	double startTime = GetCurrentTimeSeconds();
+	entity->Update(tickSeconds);
+	stats.m_tickSeconds += GetCurrentTimeSeconds() - startTime;
+	stats.m_numTicked++;
+	return true;
 }
 
 void Map::UpdateGameCameraToFollowPlayer()
 {
-	Vec2 playerPos = m_game->m_player->m_position;
+	Vec2 playerPos = m_game->m_player->GetPosition();
 	IntVec2 playerCoord = GetTileCoordsFromPosition(playerPos);
 	AABB2& cameraBounds = m_game->m_currentWorldCameraBounds;
 	int numVTilesInView = m_game->m_numberTilesInViewVertically;
@@ -600,6 +736,7 @@ void Map::UpdateAndCheckOverrideTilesAge(float deltaSeconds)
 		if (tileOverride.m_age >= tileOverride.m_overrideDuration)
 		{
 			m_tiles[tileOverride.m_tileIndex].m_tileDef = tileOverride.m_oldTileDef;
+			OnTileDefinitionChanged(tileOverride.m_tileIndex);
 			m_tileOverrides.erase(m_tileOverrides.begin() + tileNum);
 			tileNum--;
 		}
@@ -608,95 +745,67 @@ void Map::UpdateAndCheckOverrideTilesAge(float deltaSeconds)
 
 //Render Functions
 //-----------------------------------------------------------------------------------------------
-void Map::RenderTiles() const
+void Map::RenderTiles(AABB2 const& visibleBounds) const
 {
-	std::vector<Vertex_PCU> mapTileVerts;
-	const int NUM_TRIS = 2;
-	const int NUM_VERTS = 3 * NUM_TRIS;
-	mapTileVerts.reserve(NUM_VERTS * m_tiles.size());
-
-	TileDefinition const* tileDef;
-	float minX;
-	float minY;
-
-	for (int tileIndex = 0; tileIndex < static_cast<int>(m_tiles.size()); ++tileIndex)
-	{
-		Tile const& tile = m_tiles[tileIndex];
-		tileDef = tile.m_tileDef;
-		minX = static_cast<float>(tile.m_tileCoords.x);
-		minY = static_cast<float>(tile.m_tileCoords.y);
-		AddVertsForAABB2D(mapTileVerts, AABB2(minX, minY, minX + 1.f, minY + 1.f), tileDef->m_tintColor, tileDef->m_spriteSheetUVCoords.m_mins, tileDef->m_spriteSheetUVCoords.m_maxs);
-	}
-
 	g_renderer->BeginRendererEvent("Draw - Tiles");
 	g_renderer->SetBlendMode(BlendMode::ALPHA);
 	g_renderer->BindTexture(&m_terrainSpriteSheet->GetTexture());
-	g_renderer->DrawVertexArray(mapTileVerts);
+	for (int chunkNum = 0; chunkNum < static_cast<int>(m_tileMeshChunks.size()); ++chunkNum)
+	{
+		TileMeshChunk const& chunk = m_tileMeshChunks[chunkNum];
+		if (!DoAABB2sOverlap(GetTileMeshChunkBounds(chunk), visibleBounds))
+			continue;
+
+		g_renderer->DrawQuadVertexBuffer2D(chunk.m_vertexBuffer, static_cast<unsigned int>(chunk.m_numVerts));
+	}
 	g_renderer->EndRendererEvent();
 }
 
-void Map::RenderEntities() const
+void Map::RenderEntities(EntityList const& visibleEntities) const
 {
-	//Render all entities except explosions
-	g_renderer->BeginRendererEvent("Draw - Entities");
-	for (int entityTypeIndex = 0; entityTypeIndex < ENTITY_TYPE_NEUTRAL_EXPLOSION; ++entityTypeIndex)
+	//every entity submits into one batch, the render queue sorts it by layer so explosions still land on top
+	m_entitySpriteBatch.Begin();
+	for (int entityIndex = 0; entityIndex < static_cast<int>(visibleEntities.size()); ++entityIndex)
 	{
-		EntityList const& entitiesOfType = m_entityListByType[entityTypeIndex];
-
-		for (int entityIndex = 0; entityIndex < static_cast<int>(entitiesOfType.size()); ++entityIndex)
-		{
-			Entity* entity = entitiesOfType[entityIndex];
-			if (entity && entity->IsAlive())
-			{
-				entity->Render();
-				if (g_debugMode)
-				{
-					entity->DebugRender();
-				}
-			}
-		}
+		visibleEntities[entityIndex]->Render(m_entitySpriteBatch);
 	}
+
+	RenderQueue& renderQueue = g_renderer->GetRenderQueue();
+	renderQueue.Begin();
+	m_entitySpriteBatch.AddToRenderQueue(renderQueue);
+
+	g_renderer->BeginRendererEvent("Draw - Entities");
+	g_renderer->SetRasterizerMode(RasterizerMode::SOLID_CULL_NONE);
+	renderQueue.Execute(g_renderer);
+	RenderEntityHealthBars(visibleEntities); //after every sprite layer
 	g_renderer->EndRendererEvent();
-	
-	g_renderer->BeginRendererEvent("Draw - Explosions");
-	//render explosions
-	EntityList const& explosionEntities = m_entityListByType[ENTITY_TYPE_NEUTRAL_EXPLOSION];
-	for (int entityIndex = 0; entityIndex < static_cast<int>(explosionEntities.size()); ++entityIndex)
+
+	if (g_debugMode)
 	{
-		Entity* entity = explosionEntities[entityIndex];
-		if (entity && entity->IsAlive())
+		g_renderer->BeginRendererEvent("Draw - EntityDebug");
+		for (int entityIndex = 0; entityIndex < static_cast<int>(visibleEntities.size()); ++entityIndex)
 		{
-			entity->Render();
-			if (g_debugMode)
-			{
-				entity->DebugRender();
-			}
+			visibleEntities[entityIndex]->DebugRender();
 		}
+		g_renderer->EndRendererEvent();
 	}
-	g_renderer->EndRendererEvent();
 }
 
-void Map::RenderEntityHealthBars() const
+void Map::RenderEntityHealthBars(EntityList const& visibleEntities) const
 {
-	std::vector<Vertex_PCU> healthBarVerts;
-	for (int entityListNum = 0; entityListNum < ENTITY_TYPE_GOOD_BOLT; ++entityListNum)
+	m_healthBarInstances.clear();
+	for (int entityIndex = 0; entityIndex < static_cast<int>(visibleEntities.size()); ++entityIndex)
 	{
-		EntityList entityList = m_entityListByType[entityListNum];
-		for (int entityNum = 0; entityNum < static_cast<int>(entityList.size()); ++entityNum)
-		{
-			Entity* entity = entityList[entityNum];
-			if (entity && entity->IsAlive())
-			{
-				entity->AddVertsForHealthBar(healthBarVerts);
-			}
-		}
+		Entity* entity = visibleEntities[entityIndex];
+		if (entity->m_entityType >= ENTITY_TYPE_GOOD_BOLT)
+			break;
+
+		entity->AddQuadInstancesForHealthBar(m_healthBarInstances);
 	}
 
-	g_renderer->BeginRendererEvent("Draw - HealthBars");
 	g_renderer->SetBlendMode(BlendMode::ALPHA);
 	g_renderer->BindTexture(nullptr);
-	g_renderer->DrawVertexArray(healthBarVerts);
-	g_renderer->EndRendererEvent();
+	g_renderer->DrawQuadInstances2D(m_healthBarInstances);
 }
 
 void Map::RenderPauseOverlay() const
@@ -713,112 +822,328 @@ void Map::RenderPauseOverlay() const
 
 }
 
-void Map::RenderDebugTileInfo() const
+void Map::RenderDebugTileInfo(AABB2 const& visibleBounds) const
 {
 	if (!m_renderDebugTileCoords)
 		return;
 
-	BitmapFont* bitMapFont = g_renderer->CreatOrGetBitMapFontFromFile("Data/Font/SquirrelFixedFont");
-
-	std::vector<Vertex_PCU> textVerts;
-	std::vector<Vertex_PCU> gridVerts;
-	std::string text;
-	IntVec2 tileCoords;
-	Vec2 position;
-	AABB2 tileBounds;
-
-	for (int tileIndex = 0; tileIndex < static_cast<int>(m_tiles.size()); tileIndex++)
-	{
-		//Tile coordinates text
-		tileCoords = m_tiles[tileIndex].m_tileCoords;
-		position = Vec2(static_cast<float>(tileCoords.x), static_cast<float>(tileCoords.y));
-		text = std::to_string(tileCoords.x) + "," + std::to_string(tileCoords.y);
-		bitMapFont->AddVertsForText2D(textVerts, position, 0.15f, text, Rgba8::WHITE);
-
-		//Tile Index text
-		float minX = static_cast<float>(m_tiles[tileIndex].m_tileCoords.x);
-		float minY = static_cast<float>(m_tiles[tileIndex].m_tileCoords.y);
-		tileBounds = AABB2(minX, minY, minX + 1.f, minY + 1.f);
-		text = std::to_string(tileIndex);
-		position = tileBounds.GetCenterPos();
-		bitMapFont->AddVertsForCenteredText2D(textVerts, position, 0.15f, text, Rgba8::RED);
-
-		//Grid overlay
-		if (tileCoords.y % 2 == 0)
-		{
-			if (tileIndex % 2 == 0)
-			{
-				AABB2 overlaySquare(tileBounds);
-				AddVertsForAABB2D(gridVerts, overlaySquare, Rgba8(150, 150, 150, 100));
-			}
-		}
-		else if (tileCoords.x % 2 != 0)
-		{
-			AABB2 overlaySquare(tileBounds);
-			AddVertsForAABB2D(gridVerts, overlaySquare, Rgba8(150, 150, 150, 100));
-		}
+	//tile coords and indexes never change for a map, so the text is laid out once
+	if (!m_tileInfoTextOverlay.m_isBuilt)
+	{
+		BuildTileInfoOverlays();
 	}
 
+	BitmapFont* bitMapFont = g_renderer->CreatOrGetBitMapFontFromFile("Data/Font/SquirrelFixedFont");
 	g_renderer->BeginRendererEvent("Draw - TileDebug");
 	g_renderer->BindTexture(nullptr);
-	g_renderer->DrawVertexArray(gridVerts);
+	RenderTileOverlayMesh(m_tileInfoGridOverlay, visibleBounds);
 
 	g_renderer->BindTexture(&bitMapFont->GetTexture());
-	g_renderer->DrawVertexArray(textVerts);
+	RenderTileOverlayMesh(m_tileInfoTextOverlay, visibleBounds);
 	g_renderer->EndRendererEvent();
 }
 
-void Map::RenderDebugHeatMap() const
+void Map::RenderDebugHeatMap(AABB2 const& visibleBounds) const
 {
 	if (m_debugHeatMaps[m_currentHeatMapIndex] == nullptr || !m_renderHeatMap)
 		return;
 
-	std::vector<Vertex_PCU> heatMapVerts;
 	std::string debugText;
+	switch (m_currentHeatMapIndex)
+	{
+	case 0: debugText = "Distance map from entry to exit";	break;
+	case 1: debugText = "Solid map";						break;
+	case 2: debugText = "Amphibian solid map";				break;
+	case 3: debugText = "Distance map to player";			break;
+	case 4: debugText = "Entity distance map for roaming";	break;
+	}
+
+	TileHeatMap const* heatMap = m_debugHeatMaps[m_currentHeatMapIndex];
+	if (heatMap != m_heatMapOverlaySource || heatMap->GetVersion() != m_heatMapOverlayVersion || m_currentHeatMapIndex != m_heatMapOverlayIndex)
+	{
+		RebuildHeatMapOverlay(*heatMap);
+	}
+
+	g_renderer->BindTexture(nullptr);
+	RenderTileOverlayMesh(m_heatMapOverlay, visibleBounds);
+
+	m_heatMapLabel.SetFont(g_renderer->CreatOrGetBitMapFontFromFile("Data/Font/SquirrelFixedFont"));
+	m_heatMapLabel.SetText2D(debugText, Vec2(2.f, m_dimensions.y - 2.f), 0.5f, Rgba8::RED);
+	m_heatMapLabel.Render(g_renderer);
+
+	if (m_currentHeatMapIndex == 4 && m_debugTrackedLeo != nullptr)
+	{
+		m_debugTrackedLeo->DebugRenderPathFindingInfo();
+	}
+}
+
+void Map::RebuildHeatMapOverlay(TileHeatMap const& heatMap) const
+{
+	m_heatMapOverlaySource = &heatMap;
+	m_heatMapOverlayVersion = heatMap.GetVersion();
+	m_heatMapOverlayIndex = m_currentHeatMapIndex;
 
+	//the color range comes from the whole map so colors match across chunks
 	AABB2 mapBounds = AABB2(0.f, 0.f, (float)m_dimensions.x, (float)m_dimensions.y);
-	switch(m_currentHeatMapIndex)
-	{
-	case 0:
-		m_debugHeatMaps[m_currentHeatMapIndex]->AddVertsForDebugDraw(heatMapVerts, mapBounds, DEFAULT_HEAT_MAP_SOLID_VALUE);
-		debugText = "Distance map from entry to exit";
-		break;
-	case 1:
-		m_debugHeatMaps[m_currentHeatMapIndex]->AddVertsForDebugDraw(heatMapVerts, mapBounds, FloatRange(0.f, DEFAULT_HEAT_MAP_SOLID_VALUE));
-		debugText = "Solid map";
-		break;
-	case 2:
-		m_debugHeatMaps[m_currentHeatMapIndex]->AddVertsForDebugDraw(heatMapVerts, mapBounds, FloatRange(0.f, DEFAULT_HEAT_MAP_SOLID_VALUE));
-		debugText = "Amphibian solid map";
-		break;
-	case 3:
-		m_debugHeatMaps[m_currentHeatMapIndex]->AddVertsForDebugDraw(heatMapVerts, mapBounds, DEFAULT_HEAT_MAP_SOLID_VALUE);
-		debugText = "Distance map to player";
-		break;
-	case 4:
-		if (m_debugTrackedLeo == nullptr)
-			break;
+	bool isSolidMap = (m_currentHeatMapIndex == 1 || m_currentHeatMapIndex == 2);
+	FloatRange valueRange = isSolidMap ? FloatRange(0.f, DEFAULT_HEAT_MAP_SOLID_VALUE) : heatMap.GetRangeOfValues(DEFAULT_HEAT_MAP_SOLID_VALUE);
+
+	m_overlayScratchVerts.clear();
+	m_heatMapOverlay.m_chunkFirstVerts.clear();
+	for (int chunkNum = 0; chunkNum < static_cast<int>(m_tileMeshChunks.size()); ++chunkNum)
+	{
+		TileMeshChunk const& chunk = m_tileMeshChunks[chunkNum];
+		m_heatMapOverlay.m_chunkFirstVerts.push_back(static_cast<int>(m_overlayScratchVerts.size()));
+		if (isSolidMap)
+		{
+			heatMap.AddVertsForDebugDraw(m_overlayScratchVerts, mapBounds, chunk.m_tileMins, chunk.m_tileMaxs, valueRange);
+		}
 
-		m_debugHeatMaps[m_currentHeatMapIndex]->AddVertsForDebugDraw(heatMapVerts, mapBounds, DEFAULT_HEAT_MAP_SOLID_VALUE);
-		debugText = "Entity distance map for roaming";
-		break;
+		else
+		{
+			heatMap.AddVertsForDebugDraw(m_overlayScratchVerts, mapBounds, chunk.m_tileMins, chunk.m_tileMaxs, valueRange, DEFAULT_HEAT_MAP_SOLID_VALUE);
+		}
 	}
 
-	g_renderer->BindTexture(nullptr);
-	g_renderer->DrawVertexArray(heatMapVerts);
+	UploadTileOverlayMesh(m_heatMapOverlay, m_overlayScratchVerts);
+}
 
-	std::vector<Vertex_PCU> textVerts;
+void Map::BuildTileInfoOverlays() const
+{
 	BitmapFont* bitMapFont = g_renderer->CreatOrGetBitMapFontFromFile("Data/Font/SquirrelFixedFont");
-	Vec2 textPos(2.f, m_dimensions.y - 2.f);
-	bitMapFont->AddVertsForText2D(textVerts, textPos, 0.5f, debugText, Rgba8::RED);
 
-	g_renderer->BindTexture(&bitMapFont->GetTexture());
-	g_renderer->DrawVertexArray(textVerts);
+	std::vector<Vertex_PCU2D> textVerts;
+	std::vector<Vertex_PCU2D> gridVerts;
+	m_tileInfoTextOverlay.m_chunkFirstVerts.clear();
+	m_tileInfoGridOverlay.m_chunkFirstVerts.clear();
+	for (int chunkNum = 0; chunkNum < static_cast<int>(m_tileMeshChunks.size()); ++chunkNum)
+	{
+		TileMeshChunk const& chunk = m_tileMeshChunks[chunkNum];
+		m_tileInfoTextOverlay.m_chunkFirstVerts.push_back(static_cast<int>(textVerts.size()));
+		m_tileInfoGridOverlay.m_chunkFirstVerts.push_back(static_cast<int>(gridVerts.size()));
+		for (int tileY = chunk.m_tileMins.y; tileY < chunk.m_tileMaxs.y; ++tileY)
+		{
+			for (int tileX = chunk.m_tileMins.x; tileX < chunk.m_tileMaxs.x; ++tileX)
+			{
+				int tileIndex = GetTileIndexFromTileCoords(IntVec2(tileX, tileY));
+				IntVec2 tileCoords = m_tiles[tileIndex].m_tileCoords;
+				float minX = static_cast<float>(tileCoords.x);
+				float minY = static_cast<float>(tileCoords.y);
+				AABB2 tileBounds(minX, minY, minX + 1.f, minY + 1.f);
+
+				//Tile coordinates text
+				std::string text = std::to_string(tileCoords.x) + "," + std::to_string(tileCoords.y);
+				bitMapFont->AddVertsForText2D(textVerts, tileBounds.m_mins, 0.15f, text, Rgba8::WHITE);
+
+				//Tile Index text
+				bitMapFont->AddVertsForCenteredText2D(textVerts, tileBounds.GetCenterPos(), 0.15f, std::to_string(tileIndex), Rgba8::RED);
+
+				//Grid overlay
+				bool isShaded = (tileCoords.y % 2 == 0) ? (tileIndex % 2 == 0) : (tileCoords.x % 2 != 0);
+				if (isShaded)
+				{
+					AddVertsForAABB2D(gridVerts, tileBounds, Rgba8(150, 150, 150, 100));
+				}
+			}
+		}
+	}
 
-	if (m_currentHeatMapIndex == 4 && m_debugTrackedLeo != nullptr)
+	UploadTileOverlayMesh(m_tileInfoTextOverlay, textVerts);
+	UploadTileOverlayMesh(m_tileInfoGridOverlay, gridVerts);
+}
+
+void Map::UploadTileOverlayMesh(TileOverlayMesh& overlayMesh, std::vector<Vertex_PCU2D> const& verts) const
+{
+	overlayMesh.m_chunkFirstVerts.push_back(static_cast<int>(verts.size()));
+	overlayMesh.m_isBuilt = true;
+	if (verts.empty())
+		return;
+
+	unsigned int numBytes = static_cast<unsigned int>(verts.size() * sizeof(Vertex_PCU2D));
+	if (overlayMesh.m_vertexBuffer == nullptr)
 	{
-		m_debugTrackedLeo->DebugRenderPathFindingInfo();
+		overlayMesh.m_vertexBuffer = g_renderer->CreateVertexBuffer(numBytes, sizeof(Vertex_PCU2D));
+	}
+	g_renderer->CopyCPUToGPU(verts.data(), numBytes, overlayMesh.m_vertexBuffer);
+}
+
+void Map::RenderTileOverlayMesh(TileOverlayMesh const& overlayMesh, AABB2 const& visibleBounds) const
+{
+	if (overlayMesh.m_vertexBuffer == nullptr)
+		return;
+
+	//visible chunks next to each other in the buffer are drawn together
+	int runFirstVert = 0;
+	int runEndVert = 0;
+	for (int chunkNum = 0; chunkNum < static_cast<int>(m_tileMeshChunks.size()); ++chunkNum)
+	{
+		if (!DoAABB2sOverlap(GetTileMeshChunkBounds(m_tileMeshChunks[chunkNum]), visibleBounds))
+			continue;
+
+		int chunkFirstVert = overlayMesh.m_chunkFirstVerts[chunkNum];
+		int chunkEndVert = overlayMesh.m_chunkFirstVerts[chunkNum + 1];
+		if (chunkFirstVert != runEndVert)
+		{
+			if (runEndVert > runFirstVert)
+			{
+				g_renderer->DrawQuadVertexBuffer2D(overlayMesh.m_vertexBuffer, static_cast<unsigned int>(runEndVert - runFirstVert), static_cast<unsigned int>(runFirstVert));
+			}
+			runFirstVert = chunkFirstVert;
+		}
+		runEndVert = chunkEndVert;
+	}
+
+	if (runEndVert > runFirstVert)
+	{
+		g_renderer->DrawQuadVertexBuffer2D(overlayMesh.m_vertexBuffer, static_cast<unsigned int>(runEndVert - runFirstVert), static_cast<unsigned int>(runFirstVert));
+	}
+}
+
+AABB2 const Map::GetTileMeshChunkBounds(TileMeshChunk const& chunk) const
+{
+	return AABB2(static_cast<float>(chunk.m_tileMins.x), static_cast<float>(chunk.m_tileMins.y), static_cast<float>(chunk.m_tileMaxs.x), static_cast<float>(chunk.m_tileMaxs.y));
+}
+
+//Culling
+//-----------------------------------------------------------------------------------------------
+AABB2 const Map::GetCameraWorldBounds() const
+{
+	if (g_showEntireMap)
+	{
+		return m_game->m_fullMapCameraBounds;
+	}
+
+	return m_game->m_currentWorldCameraBounds;
+}
+
+void Map::GetTileRangeInBounds(AABB2 const& bounds, IntVec2& out_tileMins, IntVec2& out_tileMaxs) const
+{
+	out_tileMins.x = std::max(static_cast<int>(floorf(bounds.m_mins.x)), 0);
+	out_tileMins.y = std::max(static_cast<int>(floorf(bounds.m_mins.y)), 0);
+	out_tileMaxs.x = std::min(static_cast<int>(ceilf(bounds.m_maxs.x)), m_dimensions.x);
+	out_tileMaxs.y = std::min(static_cast<int>(ceilf(bounds.m_maxs.y)), m_dimensions.y);
+}
+
+int Map::GetEntityGridCellIndex(Vec2 const& position) const
+{
+	IntVec2 const& cellDims = m_entitySpatialGrid.m_cellDimensions;
+	int cellX = std::clamp(static_cast<int>(floorf(position.x)) / ENTITY_GRID_CELL_SIZE, 0, cellDims.x - 1);
+	int cellY = std::clamp(static_cast<int>(floorf(position.y)) / ENTITY_GRID_CELL_SIZE, 0, cellDims.y - 1);
+	return cellY * cellDims.x + cellX;
+}
+
+void Map::RebuildEntitySpatialGrid()
+{
+	EntitySpatialGrid& grid = m_entitySpatialGrid;
+	grid.m_cellDimensions.x = (m_dimensions.x + ENTITY_GRID_CELL_SIZE - 1) / ENTITY_GRID_CELL_SIZE;
+	grid.m_cellDimensions.y = (m_dimensions.y + ENTITY_GRID_CELL_SIZE - 1) / ENTITY_GRID_CELL_SIZE;
+	int numCells = grid.m_cellDimensions.x * grid.m_cellDimensions.y;
+
+	grid.m_cellStarts.assign(numCells + 1, 0);
+	grid.m_cellEntities.clear();
+	grid.m_oversizedEntities.clear();
+	grid.m_entityCellIndices.assign(m_allEntities.size(), -1);
+
+	//counting sort by cell, first pass counts entities per cell
+	for (int entityIndex = 0; entityIndex < static_cast<int>(m_allEntities.size()); ++entityIndex)
+	{
+		Entity* entity = m_allEntities[entityIndex];
+		if (entity == nullptr || !entity->IsAlive())
+			continue;
+
+		AABB2 renderBounds = entity->GetRenderBounds();
+		Vec2 halfDims = (renderBounds.m_maxs - renderBounds.m_mins) * 0.5f;
+		if (halfDims.x > ENTITY_GRID_MAX_RENDER_RADIUS || halfDims.y > ENTITY_GRID_MAX_RENDER_RADIUS)
+		{
+			grid.m_oversizedEntities.push_back(entity);
+			continue;
+		}
+
+		int cellIndex = GetEntityGridCellIndex(entity->GetPosition());
+		grid.m_entityCellIndices[entityIndex] = cellIndex;
+		grid.m_cellStarts[cellIndex + 1]++;
+	}
+
+	for (int cellIndex = 0; cellIndex < numCells; ++cellIndex)
+	{
+		grid.m_cellStarts[cellIndex + 1] += grid.m_cellStarts[cellIndex];
+	}
+
+	//second pass scatters entities into their cell's range
+	grid.m_cellEntities.resize(grid.m_cellStarts[numCells]);
+	grid.m_cellCursors.assign(grid.m_cellStarts.begin(), grid.m_cellStarts.end() - 1);
+	for (int entityIndex = 0; entityIndex < static_cast<int>(m_allEntities.size()); ++entityIndex)
+	{
+		int cellIndex = grid.m_entityCellIndices[entityIndex];
+		if (cellIndex < 0)
+			continue;
+
+		grid.m_cellEntities[grid.m_cellCursors[cellIndex]++] = m_allEntities[entityIndex];
+	}
+
+	grid.m_isDirty = false;
+}
+
+void Map::GatherVisibleEntities(AABB2 const& visibleBounds, EntityList& out_visibleEntities) const
+{
+	out_visibleEntities.clear();
+	EntitySpatialGrid const& grid = m_entitySpatialGrid;
+
+	if (grid.m_isDirty)
+	{
+		//spawned or removed since the last update, grid can hold stale pointers so test everything
+		for (int entityIndex = 0; entityIndex < static_cast<int>(m_allEntities.size()); ++entityIndex)
+		{
+			Entity* entity = m_allEntities[entityIndex];
+			if (entity && entity->IsAlive() && DoAABB2sOverlap(entity->GetRenderBounds(), visibleBounds))
+			{
+				out_visibleEntities.push_back(entity);
+			}
+		}
+	}
+	else
+	{
+		//entities sit in the cell of their position, so widen the query by the largest render radius the grid allows
+		AABB2 queryBounds(visibleBounds.m_mins - Vec2(ENTITY_GRID_MAX_RENDER_RADIUS, ENTITY_GRID_MAX_RENDER_RADIUS), visibleBounds.m_maxs + Vec2(ENTITY_GRID_MAX_RENDER_RADIUS, ENTITY_GRID_MAX_RENDER_RADIUS));
+		int cellMinX = GetEntityGridCellIndex(queryBounds.m_mins) % grid.m_cellDimensions.x;
+		int cellMinY = GetEntityGridCellIndex(queryBounds.m_mins) / grid.m_cellDimensions.x;
+		int cellMaxX = GetEntityGridCellIndex(queryBounds.m_maxs) % grid.m_cellDimensions.x;
+		int cellMaxY = GetEntityGridCellIndex(queryBounds.m_maxs) / grid.m_cellDimensions.x;
+
+		for (int cellY = cellMinY; cellY <= cellMaxY; ++cellY)
+		{
+			for (int cellX = cellMinX; cellX <= cellMaxX; ++cellX)
+			{
+				int cellIndex = cellY * grid.m_cellDimensions.x + cellX;
+				for (int cellEntityIndex = grid.m_cellStarts[cellIndex]; cellEntityIndex < grid.m_cellStarts[cellIndex + 1]; ++cellEntityIndex)
+				{
+					Entity* entity = grid.m_cellEntities[cellEntityIndex];
+					if (entity->IsAlive() && DoAABB2sOverlap(entity->GetRenderBounds(), visibleBounds))
+					{
+						out_visibleEntities.push_back(entity);
+					}
+				}
+			}
+		}
+
+		for (int entityIndex = 0; entityIndex < static_cast<int>(grid.m_oversizedEntities.size()); ++entityIndex)
+		{
+			Entity* entity = grid.m_oversizedEntities[entityIndex];
+			if (entity->IsAlive() && DoAABB2sOverlap(entity->GetRenderBounds(), visibleBounds))
+			{
+				out_visibleEntities.push_back(entity);
+			}
+		}
 	}
+
+	//keep the same draw order as walking the per type lists
+	std::sort(out_visibleEntities.begin(), out_visibleEntities.end(), [](Entity const* a, Entity const* b)
+		{
+			if (a->m_entityType != b->m_entityType)
+				return a->m_entityType < b->m_entityType;
+
+			return a->m_mapEntityTypeSlot < b->m_mapEntityTypeSlot;
+		});
 }
 
 //Entity Management
@@ -850,57 +1175,107 @@ Entity* Map::CreateNewEntity(EntityType entityType, EntityFaction faction)
 
 void Map::AddEntityToMap(Entity* entity)
 {
-	AddEntityToList(entity, m_allEntities);
-	AddEntityToList(entity, m_entityListByType[entity->m_entityType]);
+	EntityType entityType = entity->m_entityType;
+	if (entity->m_map != this)
+	{
+		//the physics row moves with the entity, its old map's table is left without it
+		EntityPhysicsTable* oldTable = entity->m_physicsTable;
+		int oldRow = entity->m_physicsRow;
+		EntityPhysicsTable& newTable = m_physicsTables[entityType];
+		newTable.AddRow(entity, entity->m_entityFaction);
+		newTable.CopyRow(entity->m_physicsRow, *oldTable, oldRow);
+		oldTable->RemoveRow(oldRow);
+	}
+
+	entity->m_mapEntitySlot = AddEntityToList(entity, m_allEntities, m_freeEntitySlots);
+	entity->m_mapEntityTypeSlot = AddEntityToList(entity, m_entityListByType[entityType], m_freeEntitySlotsByType[entityType]);
 	entity->m_map = this;
+	m_entitySpatialGrid.m_isDirty = true;
 }
 
-void Map::AddEntityToList(Entity* entity, EntityList& entityList)
+int Map::AddEntityToList(Entity* entity, EntityList& entityList, std::vector<int>& freeSlots)
 {
-	for (int listIndex = 0; listIndex < static_cast<int>(entityList.size()); ++listIndex)
+	if (!freeSlots.empty())
 	{
-		if (entityList[listIndex] == nullptr)
-		{
-			entityList[listIndex] = entity;
-			return;
-		}
+		int slotIndex = freeSlots.back();
+		freeSlots.pop_back();
+		entityList[slotIndex] = entity;
+		return slotIndex;
 	}
 
 	entityList.push_back(entity);
+	return static_cast<int>(entityList.size()) - 1;
 }
 
 void Map::RemoveEntityFromMap(Entity* entity)
 {
-	RemoveEntityFromList(entity, m_allEntities);
-	if (entity != nullptr)
+	if (entity == nullptr)
+		return;
+
+	EntityType entityType = entity->m_entityType;
+	RemoveEntityFromList(entity, m_allEntities, m_freeEntitySlots, entity->m_mapEntitySlot);
+	RemoveEntityFromList(entity, m_entityListByType[entityType], m_freeEntitySlotsByType[entityType], entity->m_mapEntityTypeSlot);
+	entity->m_mapEntitySlot = -1;
+	entity->m_mapEntityTypeSlot = -1;
+	m_entitySpatialGrid.m_isDirty = true;
+}
+
+void Map::RemoveEntityFromList(Entity* entity, EntityList& entityList, std::vector<int>& freeSlots, int slotIndex)
+{
+	if (slotIndex < 0 || slotIndex >= static_cast<int>(entityList.size()) || entityList[slotIndex] != entity)
+		return;
+
+	entityList[slotIndex] = nullptr;
+	freeSlots.push_back(slotIndex);
+}
+
+//Never below doubling, an exact reserve every flush would reallocate for each small batch of spawns
+static void ReserveEntityListForSpawns(EntityList& entityList, int numNewSlots)
+{
+	size_t requiredCapacity = entityList.size() + static_cast<size_t>(numNewSlots > 0 ? numNewSlots : 0);
+	if (requiredCapacity > entityList.capacity())
 	{
-		RemoveEntityFromList(entity, m_entityListByType[entity->m_entityType]);
+		entityList.reserve(requiredCapacity > entityList.capacity() * 2 ? requiredCapacity : entityList.capacity() * 2);
 	}
 }
 
-void Map::RemoveEntityFromList(Entity* entity, EntityList& entityList)
+void Map::FlushPendingEntitySpawns()
 {
-	for (int listIndex = 0; listIndex < static_cast<int>(entityList.size()); ++listIndex)
+	const int NUM_PENDING = static_cast<int>(m_pendingSpawnEntities.size());
+	if (NUM_PENDING == 0)
+		return;
+
+	//Grow every list the spawns land in once, for whatever its free slots can't absorb
+	int numPendingByType[NUM_ENTITY_TYPES] = {};
+	for (int entityNum = 0; entityNum < NUM_PENDING; ++entityNum)
 	{
-		if (entityList[listIndex] == entity)
-		{
-			entityList[listIndex] = nullptr;
-			return;
-		}
+		numPendingByType[m_pendingSpawnEntities[entityNum]->m_entityType]++;
+	}
+
+	ReserveEntityListForSpawns(m_allEntities, NUM_PENDING - static_cast<int>(m_freeEntitySlots.size()));
+	for (int entityType = 0; entityType < NUM_ENTITY_TYPES; ++entityType)
+	{
+		ReserveEntityListForSpawns(m_entityListByType[entityType], numPendingByType[entityType] - static_cast<int>(m_freeEntitySlotsByType[entityType].size()));
 	}
+
+	for (int entityNum = 0; entityNum < NUM_PENDING; ++entityNum)
+	{
+		AddEntityToMap(m_pendingSpawnEntities[entityNum]);
+	}
+
+	m_pendingSpawnEntities.clear();
 }
 
 void Map::DeleteGarbageEntities()
 {
-	for (int entityNum = 0; entityNum < static_cast<int>(m_allEntities.size()); ++entityNum)
+	for (int entityNum = 0; entityNum < static_cast<int>(m_garbageEntities.size()); ++entityNum)
 	{
-		Entity* entity = m_allEntities[entityNum];
-		if (entity != nullptr && entity->IsGarbage())
-		{
-			RemoveEntityFromMap(entity);
-			delete entity;
-		}
+		Entity* entity = m_garbageEntities[entityNum];
+		RemoveEntityFromMap(entity);
+		delete entity;
 	}
+
+	m_garbageEntities.clear();
 }
 
 void Map::KillAllBulletsOnMap()
@@ -912,7 +1287,7 @@ void Map::KillAllBulletsOnMap()
 		{
 			if (bulletList[bulletNum] != nullptr)
 			{
-				bulletList[bulletNum]->m_isGarbage = true;
+				DestroyEntity(bulletList[bulletNum]);
 			}
 		}
 	}
@@ -933,7 +1308,7 @@ void Map::ResetPlayer()
 	Player* player = dynamic_cast<Player*>(g_game->m_player);
 	if (player != nullptr)
 	{
-		player->m_position = GetTileCenterPosFromTileCoords(m_startCoord);
+		player->SetPosition(GetTileCenterPosFromTileCoords(m_startCoord));
 		g_game->m_player->m_isDead = false;
 	}
 	
@@ -948,96 +1323,264 @@ void Map::RespawnPlayer()
 
 //Physics
 //-----------------------------------------------------------------------------------------------
-void Map::PushEntityOutOfOverlappingEntities(Entity* entity)
+void EntityPushLanes::Clear()
+{
+	m_contactIndices.clear();
+	m_centersAX.clear();
+	m_centersAY.clear();
+	m_radiiA.clear();
+	m_centersBX.clear();
+	m_centersBY.clear();
+	m_radiiB.clear();
+	m_boxMinsX.clear();
+	m_boxMinsY.clear();
+	m_boxMaxsX.clear();
+	m_boxMaxsY.clear();
+}
+
+static void AddPushLane(EntityPushLanes& lanes, int contactNum, EntityPhysicsTable const& tableA, int rowA)
+{
+	lanes.m_contactIndices.push_back(contactNum);
+	lanes.m_centersAX.push_back(tableA.m_positionsX[rowA]);
+	lanes.m_centersAY.push_back(tableA.m_positionsY[rowA]);
+	lanes.m_radiiA.push_back(tableA.m_physicsRadii[rowA]);
+}
+
+static void AddPushLaneDiscB(EntityPushLanes& lanes, EntityPhysicsTable const& tableB, int rowB)
+{
+	lanes.m_centersBX.push_back(tableB.m_positionsX[rowB]);
+	lanes.m_centersBY.push_back(tableB.m_positionsY[rowB]);
+	lanes.m_radiiB.push_back(tableB.m_physicsRadii[rowB]);
+}
+
+//Contacts are found against positions at the start of the pass, in the order the per-entity loop used to push them.
+//Each one is scheduled a wave after the last contact touching either of its discs, so every disc still takes its pushes in order
+void Map::PushEntitiesOutOfEachOther()
 {
-	if (entity == nullptr || !entity->m_doesPushEntities)
+	m_physicsContacts.clear();
+	for (int entityType = 0; entityType < NUM_ENTITY_TYPES; ++entityType)
+	{
+		const int NUM_ROWS = m_physicsTables[entityType].GetNumRows();
+		for (int entityRow = 0; entityRow < NUM_ROWS; ++entityRow)
+		{
+			AddEntityPhysicsContacts(static_cast<EntityType>(entityType), entityRow);
+		}
+	}
+
+	const int NUM_CONTACTS = static_cast<int>(m_physicsContacts.size());
+	if (NUM_CONTACTS == 0)
 		return;
 
-	for (int entityNum = 0; entityNum < static_cast<int>(m_allEntities.size()); ++entityNum)
+	for (int entityType = 0; entityType < NUM_ENTITY_TYPES; ++entityType)
 	{
-		Entity* otherEntity = m_allEntities[entityNum];
-		if (otherEntity == nullptr || entity == otherEntity)
-			continue;
+		m_physicsRowWaves[entityType].assign(m_physicsTables[entityType].GetNumRows(), -1);
+	}
+
+	for (int contactNum = 0; contactNum < NUM_CONTACTS; ++contactNum)
+	{
+		EntityPhysicsContact& contact = m_physicsContacts[contactNum];
+		int& lastWaveA = m_physicsRowWaves[contact.m_typeA][contact.m_rowA];
+		int& lastWaveB = m_physicsRowWaves[contact.m_typeB][contact.m_rowB];
+		contact.m_wave = std::max(lastWaveA, lastWaveB) + 1;
+		lastWaveA = contact.m_wave;
+		lastWaveB = contact.m_wave;
+	}
+
+	std::stable_sort(m_physicsContacts.begin(), m_physicsContacts.end(), [](EntityPhysicsContact const& contactA, EntityPhysicsContact const& contactB) { return contactA.m_wave < contactB.m_wave; });
+
+	int firstContactNum = 0;
+	while (firstContactNum < NUM_CONTACTS)
+	{
+		int wave = m_physicsContacts[firstContactNum].m_wave;
+		m_mutualPushLanes.Clear();
+		m_fixedPushLanes.Clear();
+
+		int contactNum = firstContactNum;
+		for (; contactNum < NUM_CONTACTS && m_physicsContacts[contactNum].m_wave == wave; ++contactNum)
+		{
+			EntityPhysicsContact const& contact = m_physicsContacts[contactNum];
+			EntityPushLanes& lanes = contact.m_isMutual ? m_mutualPushLanes : m_fixedPushLanes;
+			AddPushLane(lanes, contactNum, m_physicsTables[contact.m_typeA], contact.m_rowA);
+			AddPushLaneDiscB(lanes, m_physicsTables[contact.m_typeB], contact.m_rowB);
+		}
+
+		firstContactNum = contactNum;
+		PushDiscsOutOfEachOtherBatch2D(m_mutualPushLanes.m_centersAX.data(), m_mutualPushLanes.m_centersAY.data(), m_mutualPushLanes.m_radiiA.data(),
+			m_mutualPushLanes.m_centersBX.data(), m_mutualPushLanes.m_centersBY.data(), m_mutualPushLanes.m_radiiB.data(), m_mutualPushLanes.GetNumLanes());
+		PushDiscsOutOfFixedDiscsBatch2D(m_fixedPushLanes.m_centersAX.data(), m_fixedPushLanes.m_centersAY.data(), m_fixedPushLanes.m_radiiA.data(),
+			m_fixedPushLanes.m_centersBX.data(), m_fixedPushLanes.m_centersBY.data(), m_fixedPushLanes.m_radiiB.data(), m_fixedPushLanes.GetNumLanes());
+
+		for (int laneNum = 0; laneNum < m_mutualPushLanes.GetNumLanes(); ++laneNum)
+		{
+			EntityPhysicsContact const& contact = m_physicsContacts[m_mutualPushLanes.m_contactIndices[laneNum]];
+			EntityPhysicsTable& tableA = m_physicsTables[contact.m_typeA];
+			EntityPhysicsTable& tableB = m_physicsTables[contact.m_typeB];
+			tableA.m_positionsX[contact.m_rowA] = m_mutualPushLanes.m_centersAX[laneNum];
+			tableA.m_positionsY[contact.m_rowA] = m_mutualPushLanes.m_centersAY[laneNum];
+			tableB.m_positionsX[contact.m_rowB] = m_mutualPushLanes.m_centersBX[laneNum];
+			tableB.m_positionsY[contact.m_rowB] = m_mutualPushLanes.m_centersBY[laneNum];
+		}
+
+		for (int laneNum = 0; laneNum < m_fixedPushLanes.GetNumLanes(); ++laneNum)
+		{
+			EntityPhysicsContact const& contact = m_physicsContacts[m_fixedPushLanes.m_contactIndices[laneNum]];
+			EntityPhysicsTable& tableA = m_physicsTables[contact.m_typeA];
+			tableA.m_positionsX[contact.m_rowA] = m_fixedPushLanes.m_centersAX[laneNum];
+			tableA.m_positionsY[contact.m_rowA] = m_fixedPushLanes.m_centersAY[laneNum];
+		}
+	}
+}
+
+void Map::AddEntityPhysicsContacts(EntityType entityType, int entityRow)
+{
+	EntityPhysicsTable const& table = m_physicsTables[entityType];
+	unsigned char flags = table.m_flags[entityRow];
+	if ((flags & PHYSICS_FLAG_DOES_PUSH_ENTITIES) == 0)
+		return;
+
+	const unsigned char INTERACTING_FLAGS = PHYSICS_FLAG_DOES_PUSH_ENTITIES | PHYSICS_FLAG_IS_PUSHED_BY_ENTITIES;
+	bool isPushedByEntities = (flags & PHYSICS_FLAG_IS_PUSHED_BY_ENTITIES) != 0;
+	float radius = table.m_physicsRadii[entityRow];
+	Vec2 position(table.m_positionsX[entityRow], table.m_positionsY[entityRow]);
+
+	for (int otherType = 0; otherType < NUM_ENTITY_TYPES; ++otherType)
+	{
+		EntityPhysicsTable const& otherTable = m_physicsTables[otherType];
+		const int NUM_OTHER_ROWS = otherTable.GetNumRows();
 
-		if (DoDiscsOverlap(entity->m_position, entity->m_physicsRadius, otherEntity->m_position, otherEntity->m_physicsRadius))
+		//batch overlap scan jumps straight to the next touching row
+		int otherRow = GetFirstOverlappingDiscIndexBatch2D(position, radius, otherTable.m_positionsX.data(), otherTable.m_positionsY.data(), otherTable.m_physicsRadii.data(), 0, NUM_OTHER_ROWS);
+		for (; otherRow >= 0; otherRow = GetFirstOverlappingDiscIndexBatch2D(position, radius, otherTable.m_positionsX.data(), otherTable.m_positionsY.data(), otherTable.m_physicsRadii.data(), otherRow + 1, NUM_OTHER_ROWS))
 		{
-			if (entity->m_isPushedByEntities && otherEntity->m_doesPushEntities)
+			unsigned char otherFlags = otherTable.m_flags[otherRow];
+			if ((otherType == entityType && otherRow == entityRow) || (otherFlags & INTERACTING_FLAGS) == 0)
+				continue;
+
+			EntityPhysicsContact contact;
+			bool otherIsPushedByEntities = (otherFlags & PHYSICS_FLAG_IS_PUSHED_BY_ENTITIES) != 0;
+			if (isPushedByEntities && (otherFlags & PHYSICS_FLAG_DOES_PUSH_ENTITIES))
 			{
-				if (otherEntity->m_isPushedByEntities)
-				{
-					PushDiscsOutOfEachOther2D(entity->m_position, entity->m_physicsRadius, otherEntity->m_position, otherEntity->m_physicsRadius);
-				}
+				contact.m_typeA = entityType;
+				contact.m_rowA = entityRow;
+				contact.m_typeB = static_cast<EntityType>(otherType);
+				contact.m_rowB = otherRow;
+				contact.m_isMutual = otherIsPushedByEntities;
+			}
 
-				else
-				{
-					PushDiscOutOfFixedDisc2D(entity->m_position, entity->m_physicsRadius, otherEntity->m_position, otherEntity->m_physicsRadius);
-				}
+			else if (otherIsPushedByEntities)
+			{
+				contact.m_typeA = static_cast<EntityType>(otherType);
+				contact.m_rowA = otherRow;
+				contact.m_typeB = entityType;
+				contact.m_rowB = entityRow;
 			}
 
-			else if (otherEntity->m_isPushedByEntities)
+			else
 			{
-				PushDiscOutOfFixedDisc2D(otherEntity->m_position, otherEntity->m_physicsRadius, entity->m_position, entity->m_physicsRadius);
+				continue;
 			}
-			
+
+			m_physicsContacts.push_back(contact);
 		}
 	}
 }
 
-void Map::PushEntityOutOfSurroundingTiles(Entity* entity)
+//One batch per neighbour direction, each disc still meets the solid neighbours of its starting tile in TILE_NEIGHBOUR_OFFSETS order
+void Map::PushEntitiesOutOfSurroundingTiles()
 {
-	if (entity == nullptr || !entity->m_isPushedByWalls)
-		return;
+	m_wallContacts.clear();
+	for (int entityType = 0; entityType < NUM_ENTITY_TYPES; ++entityType)
+	{
+		EntityPhysicsTable const& table = m_physicsTables[entityType];
+		for (int entityRow = 0; entityRow < table.GetNumRows(); ++entityRow)
+		{
+			unsigned char flags = table.m_flags[entityRow];
+			if ((flags & PHYSICS_FLAG_IS_PUSHED_BY_WALLS) == 0)
+				continue;
 
-	Vec2& position = entity->m_position;
-	IntVec2 posCoords = IntVec2(static_cast<int>(floorf(position.x)), static_cast<int>(floorf(position.y)));
-	
-	std::vector<IntVec2> surroundingTilesCoords;
-	surroundingTilesCoords.reserve(8);
-	surroundingTilesCoords.push_back(posCoords + IntVec2::NORTH); //north Tile
-	surroundingTilesCoords.push_back(posCoords + IntVec2::EAST); //east Tile
-	surroundingTilesCoords.push_back(posCoords + IntVec2::SOUTH); //south Tile
-	surroundingTilesCoords.push_back(posCoords + IntVec2::WEST); //west Tile
-	surroundingTilesCoords.push_back(IntVec2(posCoords.x - 1, posCoords.y + 1)); //northwest Tile
-	surroundingTilesCoords.push_back(IntVec2(posCoords.x + 1, posCoords.y + 1)); //northeast Tile
-	surroundingTilesCoords.push_back(IntVec2(posCoords.x + 1, posCoords.y - 1)); //southeast Tile
-	surroundingTilesCoords.push_back(IntVec2(posCoords.x - 1, posCoords.y - 1)); //southwest Tile
-
-	for (int tileIndex = 0; tileIndex < static_cast<int>(surroundingTilesCoords.size()); ++tileIndex)
-	{
-		IntVec2 tileCoords = surroundingTilesCoords[tileIndex];
-		
-		if (!IsTileInBounds(tileCoords))
-			continue;
+			TileTraversalClass traversalClass = (flags & PHYSICS_FLAG_CAN_TRAVERSE_WATER) ? TRAVERSAL_CLASS_AMPHIBIOUS : TRAVERSAL_CLASS_LAND;
+			EntityWallContact contact;
+			contact.m_type = static_cast<EntityType>(entityType);
+			contact.m_row = entityRow;
+			contact.m_tileCoords = IntVec2(static_cast<int>(floorf(table.m_positionsX[entityRow])), static_cast<int>(floorf(table.m_positionsY[entityRow])));
+			contact.m_solidNeighbours = GetSolidNeighbourMask(contact.m_tileCoords, traversalClass);
+			if (contact.m_solidNeighbours != 0)
+			{
+				m_wallContacts.push_back(contact);
+			}
+		}
+	}
+
+	const int NUM_CONTACTS = static_cast<int>(m_wallContacts.size());
+	for (int neighbourNum = 0; neighbourNum < NUM_TILE_NEIGHBOURS; ++neighbourNum)
+	{
+		EntityPushLanes& lanes = m_fixedPushLanes;
+		lanes.Clear();
+		for (int contactNum = 0; contactNum < NUM_CONTACTS; ++contactNum)
+		{
+			EntityWallContact const& contact = m_wallContacts[contactNum];
+			if ((contact.m_solidNeighbours & (1 << neighbourNum)) == 0)
+				continue;
+
+			float minX = static_cast<float>(contact.m_tileCoords.x + TILE_NEIGHBOUR_OFFSETS[neighbourNum].x);
+			float minY = static_cast<float>(contact.m_tileCoords.y + TILE_NEIGHBOUR_OFFSETS[neighbourNum].y);
+			AddPushLane(lanes, contactNum, m_physicsTables[contact.m_type], contact.m_row);
+			lanes.m_boxMinsX.push_back(minX);
+			lanes.m_boxMinsY.push_back(minY);
+			lanes.m_boxMaxsX.push_back(minX + 1.f);
+			lanes.m_boxMaxsY.push_back(minY + 1.f);
+		}
 
-		if (!IsTileSolid(tileCoords, !entity->m_canTraverseWater))
+		if (lanes.GetNumLanes() == 0)
 			continue;
 
-		AABB2 tileBounds = GetTileBoundsFromTileCoords(tileCoords);
-		PushDiscOutOfFixedAABB2D(position, entity->m_physicsRadius, tileBounds);
+		PushDiscsOutOfFixedAABBsBatch2D(lanes.m_centersAX.data(), lanes.m_centersAY.data(), lanes.m_radiiA.data(), lanes.m_boxMinsX.data(), lanes.m_boxMinsY.data(), lanes.m_boxMaxsX.data(), lanes.m_boxMaxsY.data(), lanes.GetNumLanes());
+		for (int laneNum = 0; laneNum < lanes.GetNumLanes(); ++laneNum)
+		{
+			EntityWallContact const& contact = m_wallContacts[lanes.m_contactIndices[laneNum]];
+			EntityPhysicsTable& table = m_physicsTables[contact.m_type];
+			table.m_positionsX[contact.m_row] = lanes.m_centersAX[laneNum];
+			table.m_positionsY[contact.m_row] = lanes.m_centersAY[laneNum];
+		}
 	}
 }
 
-void Map::CheckBulletCollision(Entity* bullet)
+void Map::CheckBulletCollision(EntityPhysicsTable& bulletTable, int bulletRow)
 {
-	if (bullet == nullptr || !bullet->IsAlive())
+	Entity* bullet = bulletTable.m_entities[bulletRow];
+	if (!bullet->IsAlive())
 		return;
 
-	Vec2& bulletPos = bullet->m_position;
+	EntityFaction bulletFaction = bulletTable.m_factions[bulletRow];
+	float bulletRadius = bulletTable.m_physicsRadii[bulletRow];
+	Vec2 bulletPos(bulletTable.m_positionsX[bulletRow], bulletTable.m_positionsY[bulletRow]);
 
-	//reverse for loop starting from index below where bullets start and working its way through all non-bullet entities. ends with player
-	for (int entityListNum = ENTITY_TYPE_GOOD_BOLT - 1; entityListNum >= 0; --entityListNum) 
+	//reverse for loop starting from type below where bullets start and working its way through all non-bullet entities. ends with player
+	for (int entityType = ENTITY_TYPE_GOOD_BOLT - 1; entityType >= 0; --entityType) 
 	{
-		EntityList entityList = m_entityListByType[entityListNum];
-		for (int entityNum = 0; entityNum < static_cast<int>(entityList.size()); ++entityNum)
+		EntityPhysicsTable& table = m_physicsTables[entityType];
+		int lastRow = table.GetNumRows();
+		bool checksShield = (entityType == ENTITY_TYPE_EVIL_ARIES);
+		int entityRow = 0;
+
+		//shield checks reach beyond the physics disc, so only the other types can skip ahead with the batch overlap scan
+		for (; entityRow < lastRow; ++entityRow)
 		{
-			Entity* entity = entityList[entityNum];
-			if (entity == nullptr || !entity->m_isHitByBullets || !entity->IsAlive())
+			if (!checksShield)
+			{
+				entityRow = GetFirstOverlappingDiscIndexBatch2D(bulletPos, bulletRadius, table.m_positionsX.data(), table.m_positionsY.data(), table.m_physicsRadii.data(), entityRow, lastRow);
+				if (entityRow < 0)
+					break;
+			}
+
+			Entity* entity = table.m_entities[entityRow];
+			if ((table.m_flags[entityRow] & PHYSICS_FLAG_IS_HIT_BY_BULLETS) == 0 || !entity->IsAlive())
 				continue;
 
-			if (entity->m_entityFaction == bullet->m_entityFaction)
+			if (table.m_factions[entityRow] == bulletFaction)
 				continue;
 
-			if (entityListNum == ENTITY_TYPE_EVIL_ARIES)
+			if (checksShield)
 			{
 				Aries* aries = dynamic_cast<Aries*>(entity);
 				if (aries != nullptr && aries->DidBulletHitShield(bulletPos))
@@ -1045,8 +1588,9 @@ void Map::CheckBulletCollision(Entity* bullet)
 					Bullet* bulletCast = dynamic_cast<Bullet*>(bullet);
 					if (bulletCast != nullptr)
 					{
-						Vec2 shieldNormal = (bulletPos - aries->m_position).GetNormalized();
-						PushDiscOutOfFixedDisc2D(bulletPos, aries->m_velocity.GetLength(), aries->m_position, aries->m_physicsRadius);
+						Vec2 shieldNormal = (bulletPos - aries->GetPosition()).GetNormalized();
+						PushDiscOutOfFixedDisc2D(bulletPos, aries->GetVelocity().GetLength(), aries->GetPosition(), aries->GetPhysicsRadius());
+						bullet->SetPosition(bulletPos);
 						bulletCast->BounceOffSurfaceNormal(shieldNormal);
 						m_game->PlayGameSFX(BULLET_BOUNCE, bulletPos);
 					}
@@ -1055,10 +1599,10 @@ void Map::CheckBulletCollision(Entity* bullet)
 				}
 			}
 
-			if (DoDiscsOverlap(bullet->m_position, bullet->m_physicsRadius, entity->m_position, entity->m_physicsRadius))
+			Vec2 entityPos(table.m_positionsX[entityRow], table.m_positionsY[entityRow]);
+			if (DoDiscsOverlap(bulletPos, bulletRadius, entityPos, table.m_physicsRadii[entityRow]))
 			{
 				entity->LoseHealth(bullet->m_damage);
-
 				if (bullet->m_entityType == ENTITY_TYPE_GOOD_FLAME_BULLET)
 				{
 					bullet->m_damage = 0.f;
@@ -1090,6 +1634,7 @@ void Map::UpdateTrackedLeo()
 	m_debugTrackedLeo = nullptr;
 	m_debugLeoRoamDistanceMap = nullptr;
 	m_debugHeatMaps[4] = nullptr;
+	m_heatMapOverlaySource = nullptr; //a new leo's map can reuse the old one's address
 
 	EntityList leoList = m_entityListByType[ENTITY_TYPE_EVIL_LEO];
 	for (int leoNum = 0; leoNum < static_cast<int>(leoList.size()); ++leoNum)
@@ -1190,7 +1735,7 @@ void Map::PopulateDistanceMapWithStationaryEntities(TileHeatMap& out_distanceMap
 		if (scorpio == nullptr || !scorpio->IsAlive())
 			continue;
 
-		IntVec2 coords = GetTileCoordsFromPosition(scorpio->m_position);
+		IntVec2 coords = GetTileCoordsFromPosition(scorpio->GetPosition());
 		scorpioCoords.push_back(coords);
 	}
 
@@ -1392,7 +1937,7 @@ void Map::RegenerateSolidMapsForMobileEntities()
 		}
 	}
 
- 	IntVec2 playerTileCoords = GetTileCoordsFromPosition(m_game->m_player->m_position);
+ 	IntVec2 playerTileCoords = GetTileCoordsFromPosition(m_game->m_player->GetPosition());
  	PopulateDistanceMapWithStationaryEntities(*m_distanceMapToPlayer, playerTileCoords, DEFAULT_HEAT_MAP_SOLID_VALUE);
  	PopulateDistanceMapWithStationaryEntities(*m_amphibianDistanceMapToPlayer, playerTileCoords, DEFAULT_HEAT_MAP_SOLID_VALUE, false);
 }
@@ -1424,8 +1969,162 @@ void Map::AddOverrideTileAtPos(Vec2 const& pos, std::string const& tileDefName,
 
 	m_tiles[tileIndex].m_tileDef = overrideTileDef;
 	m_tileOverrides.push_back(newTileOverride);
+	OnTileDefinitionChanged(tileIndex);
+}
+
+//Tile caches
+//-----------------------------------------------------------------------------------------------
+//FNV-1a over the raw vertex bytes, Vertex_PCU2D has no padding
+static uint64_t GetTileMeshVertsHash(std::vector<Vertex_PCU2D> const& verts)
+{
+	uint64_t hash = 14695981039346656037ull;
+	unsigned char const* bytes = reinterpret_cast<unsigned char const*>(verts.data());
+	size_t numBytes = verts.size() * sizeof(Vertex_PCU2D);
+	for (size_t byteNum = 0; byteNum < numBytes; ++byteNum)
+	{
+		hash = (hash ^ bytes[byteNum]) * 1099511628211ull;
+	}
+	return hash;
+}
+
+void Map::OnTileDefinitionChanged(int tileIndex)
+{
+	UpdateSolidNeighbourMasksAroundTile(tileIndex);
+
+	IntVec2 tileCoords = m_tiles[tileIndex].m_tileCoords;
+	int chunkIndex = (tileCoords.y / TILE_CHUNK_SIZE) * m_tileMeshChunkDimensions.x + (tileCoords.x / TILE_CHUNK_SIZE);
+	m_tileMeshChunks[chunkIndex].m_isDirty = true;
+}
+
+void Map::CreateTileMeshChunks()
+{
+	m_tileMeshChunkDimensions.x = (m_dimensions.x + TILE_CHUNK_SIZE - 1) / TILE_CHUNK_SIZE;
+	m_tileMeshChunkDimensions.y = (m_dimensions.y + TILE_CHUNK_SIZE - 1) / TILE_CHUNK_SIZE;
+	m_tileMeshChunks.resize(m_tileMeshChunkDimensions.x * m_tileMeshChunkDimensions.y);
+
+	for (int chunkY = 0; chunkY < m_tileMeshChunkDimensions.y; ++chunkY)
+	{
+		for (int chunkX = 0; chunkX < m_tileMeshChunkDimensions.x; ++chunkX)
+		{
+			TileMeshChunk& chunk = m_tileMeshChunks[chunkY * m_tileMeshChunkDimensions.x + chunkX];
+			chunk.m_tileMins = IntVec2(chunkX * TILE_CHUNK_SIZE, chunkY * TILE_CHUNK_SIZE);
+			chunk.m_tileMaxs.x = (chunk.m_tileMins.x + TILE_CHUNK_SIZE < m_dimensions.x) ? chunk.m_tileMins.x + TILE_CHUNK_SIZE : m_dimensions.x;
+			chunk.m_tileMaxs.y = (chunk.m_tileMins.y + TILE_CHUNK_SIZE < m_dimensions.y) ? chunk.m_tileMins.y + TILE_CHUNK_SIZE : m_dimensions.y;
+
+			int numTiles = (chunk.m_tileMaxs.x - chunk.m_tileMins.x) * (chunk.m_tileMaxs.y - chunk.m_tileMins.y);
+			chunk.m_vertexBuffer = g_renderer->CreateVertexBuffer(numTiles * NUM_VERTS_PER_QUAD_2D * sizeof(Vertex_PCU2D), sizeof(Vertex_PCU2D));
+			chunk.m_isDirty = true;
+		}
+	}
+
+	m_tileMeshScratchVerts.reserve(TILE_CHUNK_SIZE * TILE_CHUNK_SIZE * NUM_VERTS_PER_QUAD_2D);
+	RebuildDirtyTileMeshChunks();
+}
+
+void Map::RebuildDirtyTileMeshChunks()
+{
+	for (int chunkNum = 0; chunkNum < static_cast<int>(m_tileMeshChunks.size()); ++chunkNum)
+	{
+		TileMeshChunk& chunk = m_tileMeshChunks[chunkNum];
+		if (!chunk.m_isDirty)
+			continue;
+
+		m_tileMeshScratchVerts.clear();
+		AddVertsForTileMeshChunk(m_tileMeshScratchVerts, chunkNum);
+		chunk.m_numVerts = static_cast<int>(m_tileMeshScratchVerts.size());
+		chunk.m_uploadedVertsHash = GetTileMeshVertsHash(m_tileMeshScratchVerts);
+		g_renderer->CopyCPUToGPU(m_tileMeshScratchVerts.data(), static_cast<unsigned int>(chunk.m_numVerts * sizeof(Vertex_PCU2D)), chunk.m_vertexBuffer);
+		chunk.m_isDirty = false;
+	}
+}
+
+void Map::AddVertsForTileMeshChunk(std::vector<Vertex_PCU2D>& verts, int chunkIndex) const
+{
+	TileMeshChunk const& chunk = m_tileMeshChunks[chunkIndex];
+	for (int tileY = chunk.m_tileMins.y; tileY < chunk.m_tileMaxs.y; ++tileY)
+	{
+		for (int tileX = chunk.m_tileMins.x; tileX < chunk.m_tileMaxs.x; ++tileX)
+		{
+			TileDefinition const* tileDef = m_tiles[GetTileIndexFromTileCoords(tileX, tileY)].m_tileDef;
+			float minX = static_cast<float>(tileX);
+			float minY = static_cast<float>(tileY);
+			AddVertsForAABB2D(verts, AABB2(minX, minY, minX + 1.f, minY + 1.f), tileDef->m_tintColor, tileDef->m_spriteSheetUVCoords);
+		}
+	}
+}
+
+bool Map::IsTileMeshChunkCurrent(int chunkIndex, std::vector<Vertex_PCU2D>& scratchVerts) const
+{
+	TileMeshChunk const& chunk = m_tileMeshChunks[chunkIndex];
+	if (chunk.m_isDirty)
+		return true; //rebuilt at the end of this update anyway
+
+	scratchVerts.clear();
+	AddVertsForTileMeshChunk(scratchVerts, chunkIndex);
+	return static_cast<int>(scratchVerts.size()) == chunk.m_numVerts && GetTileMeshVertsHash(scratchVerts) == chunk.m_uploadedVertsHash;
+}
+
+//Solid neighbour masks
+//-----------------------------------------------------------------------------------------------
+unsigned char Map::GetSolidNeighbourMask(IntVec2 const& tileCoords, TileTraversalClass traversalClass) const
+{
+	if (!IsTileInBounds(tileCoords))
+		return ComputeSolidNeighbourMask(tileCoords, traversalClass);
+
+	return m_solidNeighbourMasks[traversalClass][GetTileIndexFromTileCoords(tileCoords)];
+}
+
+void Map::RebuildSolidNeighbourMasks()
+{
+	int numTiles = static_cast<int>(m_tiles.size());
+	for (int traversalClass = 0; traversalClass < NUM_TRAVERSAL_CLASSES; ++traversalClass)
+	{
+		std::vector<unsigned char>& masks = m_solidNeighbourMasks[traversalClass];
+		masks.resize(numTiles);
+		for (int tileIndex = 0; tileIndex < numTiles; ++tileIndex)
+		{
+			masks[tileIndex] = ComputeSolidNeighbourMask(m_tiles[tileIndex].m_tileCoords, static_cast<TileTraversalClass>(traversalClass));
+		}
+	}
+}
+
+void Map::UpdateSolidNeighbourMasksAroundTile(int tileIndex)
+{
+	//a tile only appears in the masks of the 3x3 block around it
+	IntVec2 changedCoords = m_tiles[tileIndex].m_tileCoords;
+	for (int offsetY = -1; offsetY <= 1; ++offsetY)
+	{
+		for (int offsetX = -1; offsetX <= 1; ++offsetX)
+		{
+			IntVec2 tileCoords(changedCoords.x + offsetX, changedCoords.y + offsetY);
+			if (!IsTileInBounds(tileCoords))
+				continue;
+
+			int neighbourIndex = GetTileIndexFromTileCoords(tileCoords);
+			for (int traversalClass = 0; traversalClass < NUM_TRAVERSAL_CLASSES; ++traversalClass)
+			{
+				m_solidNeighbourMasks[traversalClass][neighbourIndex] = ComputeSolidNeighbourMask(tileCoords, static_cast<TileTraversalClass>(traversalClass));
+			}
+		}
+	}
 }
 
+unsigned char Map::ComputeSolidNeighbourMask(IntVec2 const& tileCoords, TileTraversalClass traversalClass) const
+{
+	bool treatWaterAsSolid = (traversalClass == TRAVERSAL_CLASS_LAND);
+	unsigned char mask = 0;
+	for (int neighbourNum = 0; neighbourNum < NUM_TILE_NEIGHBOURS; ++neighbourNum)
+	{
+		IntVec2 neighbourCoords = tileCoords + TILE_NEIGHBOUR_OFFSETS[neighbourNum];
+
+		//out of bounds tiles are never pushed against
+		if (IsTileInBounds(neighbourCoords) && IsTileSolid(neighbourCoords, treatWaterAsSolid))
+		{
+			mask |= static_cast<unsigned char>(1 << neighbourNum);
+		}
+	}
+	return mask;
+}
 
 //Tile Accessors
 //-----------------------------------------------------------------------------------------------
@@ -3,6 +3,10 @@
 #include "Engine/Math/AABB2.hpp"
 #include "Game/Entity.hpp"
 #include "Game/GameCommon.hpp"
+#include "Engine/Renderer/SpriteBatch2D.hpp"
+#include "Engine/Renderer/TextMesh.hpp"
+#include "Engine/Core/Vertex_PCU2D.hpp"
+#include <cstdint>
 #include <vector>
 
 class Game;
@@ -14,6 +18,7 @@ struct Vec2;
 struct RaycastResult2D;
 struct Ray2;
 class SpriteSheet;
+class VertexBuffer;
 class TileHeatMap;
 class TileHeatMap;
 struct MapDefinition;
@@ -21,6 +26,110 @@ struct TileDefinition;
 
 typedef std::vector<Entity*> EntityList;
 
+//Wall push-out classes; land entities treat water as solid, amphibians do not
+enum TileTraversalClass : int
+{
+	TRAVERSAL_CLASS_LAND,
+	TRAVERSAL_CLASS_AMPHIBIOUS,
+	NUM_TRAVERSAL_CLASSES
+};
+
+//Bit order of the per-tile solid neighbour masks, also the order walls are pushed against
+enum TileNeighbourDirection : int
+{
+	NEIGHBOUR_NORTH,
+	NEIGHBOUR_EAST,
+	NEIGHBOUR_SOUTH,
+	NEIGHBOUR_WEST,
+	NEIGHBOUR_NORTHWEST,
+	NEIGHBOUR_NORTHEAST,
+	NEIGHBOUR_SOUTHEAST,
+	NEIGHBOUR_SOUTHWEST,
+	NUM_TILE_NEIGHBOURS
+};
+
+//Uniform grid bucketing entities by position, rebuilt after each update so rendering only visits on-screen cells.
+//Entities in cell c are m_cellEntities[m_cellStarts[c], m_cellStarts[c + 1])
+struct EntitySpatialGrid
+{
+	IntVec2 m_cellDimensions;
+	std::vector<int> m_cellStarts;
+	EntityList m_cellEntities;
+	EntityList m_oversizedEntities; //render bounds reach past ENTITY_GRID_MAX_RENDER_RADIUS, always tested
+	std::vector<int> m_entityCellIndices; //scratch, cell of each m_allEntities slot while rebuilding
+	std::vector<int> m_cellCursors; //scratch
+	bool m_isDirty = true; //entities added or removed since the last rebuild
+};
+
+//One push of the entity pass: disc A is pushed out of disc B, and B is pushed back as well when the push is mutual
+struct EntityPhysicsContact
+{
+	EntityType m_typeA = ENTITY_TYPE_UNKNOWN;
+	int m_rowA = -1;
+	EntityType m_typeB = ENTITY_TYPE_UNKNOWN;
+	int m_rowB = -1;
+	bool m_isMutual = false;
+	int m_wave = 0; //no disc is in two contacts of one wave, so a wave goes through the batch kernels in one call
+};
+
+//A wall-pushed row and the solid neighbours of the tile it started the wall pass on
+struct EntityWallContact
+{
+	EntityType m_type = ENTITY_TYPE_UNKNOWN;
+	int m_row = -1;
+	IntVec2 m_tileCoords;
+	unsigned char m_solidNeighbours = 0;
+};
+
+//Lanes gathered from the physics tables for one batch push call. Lane i pushes disc A out of disc B, or out of box i for walls
+struct EntityPushLanes
+{
+	void Clear();
+	int GetNumLanes() const { return static_cast<int>(m_contactIndices.size()); }
+
+	std::vector<int> m_contactIndices; //into the contact list the lanes were gathered from
+	std::vector<float> m_centersAX;
+	std::vector<float> m_centersAY;
+	std::vector<float> m_radiiA;
+	std::vector<float> m_centersBX;
+	std::vector<float> m_centersBY;
+	std::vector<float> m_radiiB;
+	std::vector<float> m_boxMinsX;
+	std::vector<float> m_boxMinsY;
+	std::vector<float> m_boxMaxsX;
+	std::vector<float> m_boxMaxsY;
+};
+
+//Per frame AI scheduler counters for one level of detail tier
+struct AILodTierStats
+{
+	int m_numEntities = 0;
+	int m_numTicked = 0;
+	int m_numDeferred = 0; //due this frame but over the tier's tick budget
+	double m_tickSeconds = 0.0;
+};
+
+//Persistent GPU mesh for a TILE_CHUNK_SIZE square block of tiles, rebuilt only when one of its tiles changes
+//4 Vertex_PCU2D per tile drawn through the renderer's shared quad index buffer
+struct TileMeshChunk
+{
+	VertexBuffer* m_vertexBuffer = nullptr;
+	IntVec2 m_tileMins;
+	IntVec2 m_tileMaxs; //exclusive
+	int m_numVerts = 0;
+	uint64_t m_uploadedVertsHash = 0; //of the last upload, lets a debug check find chunks that missed a rebuild
+	bool m_isDirty = true;
+};
+
+//Debug overlay mesh kept on the GPU between frames, laid out chunk by chunk in m_tileMeshChunks order
+//so drawing it can skip off screen chunks the same way RenderTiles does
+struct TileOverlayMesh
+{
+	VertexBuffer* m_vertexBuffer = nullptr;
+	std::vector<int> m_chunkFirstVerts; //one entry per chunk plus the total at the end
+	bool m_isBuilt = false;
+};
+
 struct TileTypeOverride
 {
 	TileDefinition const* m_oldTileDef;
@@ -42,12 +151,14 @@ public:
 	void EndFrame();
 
 	//Entity Management
-	Entity* SpawnNewEntity(EntityType entityType, EntityFaction faction);
+	Entity* SpawnNewEntity(EntityType entityType, EntityFaction faction); //queued, joins the map at the next sync point
 	void SpawnExplosion(Vec2 const& pos, float size, float duration, Rgba8 const& tint = Rgba8::WHITE);
+	void DestroyEntity(Entity* entity); //marks as garbage, deleted at end of frame
 	void AddEntityToMap(Entity* entity);
 	void RemoveEntityFromMap(Entity* entity);
 	void SpawnInitialNpcs();
 	void KillAllBulletsOnMap();
+	EntityPhysicsTable& GetEntityPhysicsTable(EntityType entityType) { return m_physicsTables[entityType]; }
 
 	//Player Management
 	void ResetPlayer();
@@ -57,6 +168,9 @@ public:
 	void AddOverrideTileAtPos(Vec2 const& pos, std::string const& tileDefName, float duration);
 	void UpdateAndCheckOverrideTilesAge(float deltaSeconds);
 
+	//Solid neighbour masks
+	unsigned char GetSolidNeighbourMask(IntVec2 const& tileCoords, TileTraversalClass traversalClass) const;
+
 	//Tile index
 	int GetTileIndexFromTileCoords(IntVec2 const& tileCoords) const;
 	int GetTileIndexFromTileCoords(int tileCoordX, int tileCoordY) const;
@@ -87,6 +201,16 @@ public:
 	void RotateThroughDebugHeatMaps();
 	void UpdateTrackedLeo();
 
+	//AI scheduling
+	AILodTierStats const& GetAILodTierStats(AILodTier tier) const { return m_aiLodStats[tier]; }
+
+	//Tile caches
+	int GetNumTileMeshChunks() const { return static_cast<int>(m_tileMeshChunks.size()); }
+	void AddVertsForTileMeshChunk(std::vector<Vertex_PCU2D>& verts, int chunkIndex) const;
+	bool IsTileMeshChunkCurrent(int chunkIndex, std::vector<Vertex_PCU2D>& scratchVerts) const; //rebuilds into scratchVerts and compares with the last upload
+	void MarkTileMeshChunkDirty(int chunkIndex) { m_tileMeshChunks[chunkIndex].m_isDirty = true; }
+	void RebuildDirtyTileMeshChunks();
+
 private:
 	//Creation and Initialization
 	void SpawnTiles();
@@ -94,30 +218,54 @@ private:
 	void SpawnBunkerAreas();
 	void SpawnWorms();
 	void InitHeatMaps();
+	void RebuildSolidNeighbourMasks();
+	void UpdateSolidNeighbourMasksAroundTile(int tileIndex);
+	void CreateTileMeshChunks();
+	void OnTileDefinitionChanged(int tileIndex);
+	unsigned char ComputeSolidNeighbourMask(IntVec2 const& tileCoords, TileTraversalClass traversalClass) const;
 	
 	//Update
 	void UpdateEntities(float deltaSeconds);
 	void UpdateGameCameraToFollowPlayer();
 	void CheckIfPlayerDied();
 
+	//AI scheduling
+	bool IsEntityAIScheduled(Entity const* entity) const;
+	AILodTier GetAILodTierForPosition(Vec2 const& position, AABB2 const& nearTierBounds) const; //nearTierBounds is the camera bounds grown by the near margin
+	bool UpdateScheduledAIEntity(Entity* entity, float deltaSeconds, AABB2 const& nearTierBounds); //false if the entity was due but over its tier budget
+
 	//Render
-	void RenderTiles() const;
-	void RenderEntities() const;
-	void RenderEntityHealthBars() const;
+	void RenderTiles(AABB2 const& visibleBounds) const;
+	void RenderEntities(EntityList const& visibleEntities) const;
+	void RenderEntityHealthBars(EntityList const& visibleEntities) const;
 	void RenderPauseOverlay() const;
-	void RenderDebugTileInfo() const; //Debug for showing tile coords and tile index. WARNING! it is super taxing on performance
-	void RenderDebugHeatMap() const;
+	void RenderDebugTileInfo(AABB2 const& visibleBounds) const; //Debug for showing tile coords and tile index of on screen tiles
+	void RenderDebugHeatMap(AABB2 const& visibleBounds) const;
+	void RebuildHeatMapOverlay(TileHeatMap const& heatMap) const;
+	void BuildTileInfoOverlays() const;
+	void UploadTileOverlayMesh(TileOverlayMesh& overlayMesh, std::vector<Vertex_PCU2D> const& verts) const;
+	void RenderTileOverlayMesh(TileOverlayMesh const& overlayMesh, AABB2 const& visibleBounds) const;
+	AABB2 const GetTileMeshChunkBounds(TileMeshChunk const& chunk) const;
+
+	//Culling
+	AABB2 const GetCameraWorldBounds() const;
+	void GetTileRangeInBounds(AABB2 const& bounds, IntVec2& out_tileMins, IntVec2& out_tileMaxs) const; //maxs exclusive, clamped to the map
+	void RebuildEntitySpatialGrid();
+	int GetEntityGridCellIndex(Vec2 const& position) const;
+	void GatherVisibleEntities(AABB2 const& visibleBounds, EntityList& out_visibleEntities) const;
 
 	//Entity Management
 	Entity* CreateNewEntity(EntityType entityType, EntityFaction faction);
-	void AddEntityToList(Entity* entity, EntityList& entityList);
-	void RemoveEntityFromList(Entity* entity, EntityList& entityList);
+	int AddEntityToList(Entity* entity, EntityList& entityList, std::vector<int>& freeSlots);
+	void RemoveEntityFromList(Entity* entity, EntityList& entityList, std::vector<int>& freeSlots, int slotIndex);
+	void FlushPendingEntitySpawns();
 	void DeleteGarbageEntities();
 
 	//Physics
-	void PushEntityOutOfOverlappingEntities(Entity* entity);
-	void PushEntityOutOfSurroundingTiles(Entity* entity);
-	void CheckBulletCollision(Entity* bullet);
+	void PushEntitiesOutOfEachOther();
+	void AddEntityPhysicsContacts(EntityType entityType, int entityRow);
+	void PushEntitiesOutOfSurroundingTiles();
+	void CheckBulletCollision(EntityPhysicsTable& bulletTable, int bulletRow);
 
 	//Helper Functions
 	//-----------------------------------------------------------------------------------------------
@@ -154,8 +302,44 @@ public:
 	TileHeatMap* m_amphibianDistanceMapToPlayer = nullptr;
 
 private:
+	//Entity command buffer, flushed at sync points in UpdateEntities and EndFrame
+	EntityList m_pendingSpawnEntities;
+	EntityList m_garbageEntities;
+	std::vector<int> m_freeEntitySlots;
+	std::vector<int> m_freeEntitySlotsByType[NUM_ENTITY_TYPES];
+
+	//Physics
+	EntityPhysicsTable m_physicsTables[NUM_ENTITY_TYPES]; //owns position, velocity and radius of every entity made for this map, by type
+	std::vector<EntityPhysicsContact> m_physicsContacts; //push-out scratch from here down, reused every frame
+	std::vector<int> m_physicsRowWaves[NUM_ENTITY_TYPES]; //last wave each row was in while scheduling contacts
+	std::vector<EntityWallContact> m_wallContacts;
+	EntityPushLanes m_mutualPushLanes;
+	EntityPushLanes m_fixedPushLanes;
+	EntitySpatialGrid m_entitySpatialGrid;
+	std::vector<unsigned char> m_solidNeighbourMasks[NUM_TRAVERSAL_CLASSES]; //one byte per tile, bit n set if neighbour TileNeighbourDirection n is solid and in bounds
+
+	//AI scheduling
+	AILodTierStats m_aiLodStats[NUM_AI_LOD_TIERS];
+	int m_aiScheduleStartIndex = 0;
+
 	//Rendering
 	SpriteSheet* m_terrainSpriteSheet = nullptr;
+	std::vector<TileMeshChunk> m_tileMeshChunks;
+	IntVec2 m_tileMeshChunkDimensions;
+	std::vector<Vertex_PCU2D> m_tileMeshScratchVerts; //reused when rebuilding a chunk
+	mutable EntityList m_visibleEntities; //cleared and refilled every Render, kept to reuse its allocation
+	mutable SpriteBatch2D m_entitySpriteBatch; //refilled every Render, kept to reuse its allocations
+	mutable std::vector<QuadInstance2D> m_healthBarInstances;
+
+	//Debug overlays, built on first use and rebuilt only when their source heat map changes
+	mutable TileOverlayMesh m_heatMapOverlay;
+	mutable TileHeatMap const* m_heatMapOverlaySource = nullptr;
+	mutable unsigned int m_heatMapOverlayVersion = 0;
+	mutable int m_heatMapOverlayIndex = -1;
+	mutable TileOverlayMesh m_tileInfoGridOverlay;
+	mutable TileOverlayMesh m_tileInfoTextOverlay;
+	mutable std::vector<Vertex_PCU2D> m_overlayScratchVerts;
+	mutable TextMesh m_heatMapLabel;
 	bool m_renderDebugTileCoords = false;
 	int m_mapIndex = -1;
 
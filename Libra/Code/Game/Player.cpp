@@ -3,7 +3,8 @@
 #include "Game/Game.hpp"
 #include "Game/Map.hpp"
 
-#include "Engine/Renderer/RendererDX11.hpp"
+#include "Game/GameRenderer.hpp"
+#include "Engine/Renderer/SpriteBatch2D.hpp"
 #include "Engine/Input/InputSystem.hpp"
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Core/VertexUtils.hpp"
@@ -21,11 +22,11 @@ Player::Player(Map* const& mapOwner, EntityFaction faction, Vec2 const& starting
 void Player::Update(float deltaSeconds)
 {
 	UpdateTimers(deltaSeconds);
-	m_isPushedByWalls = !g_noClipMode;
+	SetPhysicsFlag(PHYSICS_FLAG_IS_PUSHED_BY_WALLS, !g_noClipMode);
 
 	CheckInput(deltaSeconds);
 
-	if (IsOnTargetTile(m_position, m_map->m_endCoord))
+	if (IsOnTargetTile(GetPosition(), m_map->m_endCoord))
 	{
 		g_game->GoToNextMap();
 		return;
@@ -33,51 +34,35 @@ void Player::Update(float deltaSeconds)
 
 	if (DidChangeTile())
 	{
-		IntVec2 tileCoords = m_map->GetTileCoordsFromPosition(m_position);
+		IntVec2 tileCoords = m_map->GetTileCoordsFromPosition(GetPosition());
 		m_map->PopulateDistanceMapWithStationaryEntities(*m_map->m_distanceMapToPlayer, tileCoords, DEFAULT_HEAT_MAP_SOLID_VALUE);
 		m_map->PopulateDistanceMapWithStationaryEntities(*m_map->m_amphibianDistanceMapToPlayer, tileCoords, DEFAULT_HEAT_MAP_SOLID_VALUE, false);
 	}
 
-	m_positionLastFrame = m_position;
+	m_positionLastFrame = GetPosition();
 }
 
-void Player::Render() const
+void Player::Render(SpriteBatch2D& spriteBatch) const
 {
-
 	Vec2 fwrdNormal = GetForwardNormal();
-	std::vector<Vertex_PCU> worldVerts;
-	AddVertsForAABB2D(worldVerts, m_entityBounds, Rgba8::WHITE);
-	
-	TransformVertexArrayXY3D(worldVerts, fwrdNormal, fwrdNormal.GetRotated90Degrees(), m_position);
-
-	g_renderer->SetBlendMode(BlendMode::ALPHA);
-	g_renderer->BindTexture(m_texture);
-	g_renderer->DrawVertexArray(worldVerts);
+	spriteBatch.AddQuad(m_texture, BlendMode::ALPHA, ENTITY_RENDER_LAYER_BODY, m_entityBounds, fwrdNormal, fwrdNormal.GetRotated90Degrees(), GetPosition(), Rgba8::WHITE, m_textureUVs);
 
 	fwrdNormal.RotateDegrees(m_turretRelativeOffset);
-	worldVerts.clear();
-	AddVertsForAABB2D(worldVerts, m_turretBounds, Rgba8::WHITE);
-	TransformVertexArrayXY3D(worldVerts, fwrdNormal, fwrdNormal.GetRotated90Degrees(), m_position);
-
-	g_renderer->SetBlendMode(BlendMode::ALPHA);
-	g_renderer->BindTexture(m_turretTexture);
-	g_renderer->DrawVertexArray(worldVerts);
+	spriteBatch.AddQuad(m_turretTexture, BlendMode::ALPHA, ENTITY_RENDER_LAYER_TURRET, m_turretBounds, fwrdNormal, fwrdNormal.GetRotated90Degrees(), GetPosition(), Rgba8::WHITE, m_turretTextureUVs);
 	
 	std::vector<Vertex_PCU> shapeVerts;
 
 	if (g_noClipMode)
 	{
-		AddVertsForRing2D(shapeVerts, m_position, 0.4f, m_debugLineThickness, Rgba8::BLACK);
+		AddVertsForRing2D(shapeVerts, GetPosition(), 0.4f, m_debugLineThickness, Rgba8::BLACK);
 	}
 
 	if (m_isInvincible)
 	{
-		AddVertsForRing2D(shapeVerts, m_position, 0.45f, m_debugLineThickness, Rgba8(255, 255, 255, 150));
+		AddVertsForRing2D(shapeVerts, GetPosition(), 0.45f, m_debugLineThickness, Rgba8(255, 255, 255, 150));
 	}
 
-	g_renderer->SetBlendMode(BlendMode::ALPHA);
-	g_renderer->BindTexture(nullptr);
-	g_renderer->DrawVertexArray(shapeVerts);
+	spriteBatch.AddVerts(nullptr, BlendMode::ALPHA, ENTITY_RENDER_LAYER_OVERLAY, shapeVerts);
 }
 
 void Player::DebugRender() const
@@ -85,28 +70,28 @@ void Player::DebugRender() const
 	Vec2 vecFwrd = GetForwardNormal() * m_cosmeticRadius;
 	//Turret forward Vector
 	Vec2 turretFwrd = vecFwrd.GetRotatedDegrees(m_turretRelativeOffset);
-	DebugDrawLine2D(m_position, m_position + turretFwrd, m_debugLineThickness * 2.5f, Rgba8::BLUE);
+	DebugDrawLine2D(GetPosition(), GetPosition() + turretFwrd, m_debugLineThickness * 2.5f, Rgba8::BLUE);
 
 	//Physics Ring
-	DebugDrawRing(m_position, m_physicsRadius, m_debugLineThickness, Rgba8(0, 255, 255));
+	DebugDrawRing(GetPosition(), GetPhysicsRadius(), m_debugLineThickness, Rgba8(0, 255, 255));
 
 	//Forward Vector
-	DebugDrawLine2D(m_position, m_position + vecFwrd, m_debugLineThickness, Rgba8::RED);
+	DebugDrawLine2D(GetPosition(), GetPosition() + vecFwrd, m_debugLineThickness, Rgba8::RED);
 
 	//Left Vector
 	Vec2 vecLeft = vecFwrd.GetRotated90Degrees();
-	DebugDrawLine2D(m_position, m_position + vecLeft, m_debugLineThickness, Rgba8::GREEN);
+	DebugDrawLine2D(GetPosition(), GetPosition() + vecLeft, m_debugLineThickness, Rgba8::GREEN);
 
 	//Velocity Line
-	DebugDrawLine2D(m_position, m_position + m_velocity, m_debugLineThickness, Rgba8(255, 255, 0));
+	DebugDrawLine2D(GetPosition(), GetPosition() + GetVelocity(), m_debugLineThickness, Rgba8(255, 255, 0));
 
 	//Turret Goal Direction
 	Vec2 turretGoalDirection = vecFwrd.GetRotatedDegrees(m_turretGoalOrientationDegrees);
-	DebugDrawLine2D(m_position + turretGoalDirection, m_position + turretGoalDirection * 1.25f, m_debugLineThickness * 2.5f, Rgba8::BLUE);
+	DebugDrawLine2D(GetPosition() + turretGoalDirection, GetPosition() + turretGoalDirection * 1.25f, m_debugLineThickness * 2.5f, Rgba8::BLUE);
 
 	//Goal Direction
 	Vec2 goalDirection = Vec2::MakeFromPolarDegrees(m_goalOrientationDegrees);
-	DebugDrawLine2D(m_position + goalDirection * 0.5f, m_position + goalDirection * 0.75f, m_debugLineThickness, Rgba8::RED);
+	DebugDrawLine2D(GetPosition() + goalDirection * 0.5f, GetPosition() + goalDirection * 0.75f, m_debugLineThickness, Rgba8::RED);
 }
 
 void Player::LoseHealth(float amount)
@@ -120,7 +105,7 @@ void Player::LoseHealth(float amount)
 
 		if (m_damageSFXAge >= SFX_PLAY_RATE)
 		{
-			g_game->PlayGameSFX(PLAYER_DAMAGED, m_position);
+			g_game->PlayGameSFX(PLAYER_DAMAGED, GetPosition());
 			m_damageSFXAge = 0.f;
 		}
 	}
@@ -135,13 +120,13 @@ void Player::Die()
 {
 	m_isDead = true;
 	g_game->m_inGameOverCountdownMode = true;
-	m_map->SpawnExplosion(m_position, DEATH_EXPLOSION_SIZE, DEATH_EXPLOSION_DURATION);
-	g_game->PlayGameSFX(PLAYER_KILLED, m_position);
+	m_map->SpawnExplosion(GetPosition(), DEATH_EXPLOSION_SIZE, DEATH_EXPLOSION_DURATION);
+	g_game->PlayGameSFX(PLAYER_KILLED, GetPosition());
 }
 
 void Player::UpdateGameConfigXmlData()
 {
-	m_physicsRadius = g_gameConfigBlackboard.GetValue("playerPhysicsRadius", 0.3f);
+	SetPhysicsRadius(g_gameConfigBlackboard.GetValue("playerPhysicsRadius", 0.3f));
 	m_maxHealth = g_gameConfigBlackboard.GetValue("playerStartingHealth", 10.f);
 	m_health = m_maxHealth;
 	m_moveSpeed = g_gameConfigBlackboard.GetValue("playerDriveSpeed", 1.5f);
@@ -155,11 +140,11 @@ void Player::UpdateGameConfigXmlData()
 void Player::CreateTexture()
 {
 	m_entityBounds = AABB2(-0.5f, -0.5f, 0.5f, 0.5f);
-	m_texture = g_renderer->CreateOrGetTextureFromFile("Data/Images/Tank/PlayerTankBase.png");
+	m_texture = GetOrCreateEntityTexture("Data/Images/Tank/PlayerTankBase.png", m_textureUVs);
 	AddVertsForAABB2D(m_shapeVerts, m_entityBounds, Rgba8::WHITE);
 
 	m_turretBounds = m_entityBounds;
-	m_turretTexture = g_renderer->CreateOrGetTextureFromFile("Data/Images/Tank/PlayerTankTop.png");
+	m_turretTexture = GetOrCreateEntityTexture("Data/Images/Tank/PlayerTankTop.png", m_turretTextureUVs);
 }
 
 void Player::CheckInput(float deltaSeconds)
@@ -207,8 +192,8 @@ void Player::CheckKeyboardInput(float deltaSeconds)
 		m_goalOrientationDegrees = moveIntentions.GetOrientationDegrees();
 		m_orientationDegrees = GetTurnedTowardDegrees(m_orientationDegrees, m_goalOrientationDegrees, m_turnSpeed * deltaSeconds);
 
-		m_velocity = fwrdNormal * m_moveSpeed;
-		m_position += m_velocity * deltaSeconds;
+		SetVelocity(fwrdNormal * m_moveSpeed);
+		SetPosition(GetPosition() + GetVelocity() * deltaSeconds);
 	}
 	
 	Vec2 turretGoalDirection = Vec2::ZERO;
@@ -307,8 +292,8 @@ void Player::CheckControllerInput(float deltaSeconds)
 	}
 
 	Vec2 fwrdNormal = Vec2::MakeFromPolarDegrees(m_orientationDegrees);
-	m_velocity = fwrdNormal * magnitude * m_moveSpeed;
-	m_position += m_velocity * deltaSeconds;
+	SetVelocity(fwrdNormal * magnitude * m_moveSpeed);
+	SetPosition(GetPosition() + GetVelocity() * deltaSeconds);
 	
 	magnitude = rightStick.GetMagnitude();
 
@@ -19,7 +19,7 @@ protected:
 	virtual ~Player() {}
 
 	virtual void Update(float deltaSeconds) override;
-	virtual void Render() const override;
+	virtual void Render(SpriteBatch2D& spriteBatch) const override;
 	virtual void DebugRender() const override;
 	virtual void LoseHealth(float amount) override;
 	virtual void Die() override;
@@ -40,6 +40,7 @@ private:
 private:
 	AABB2 m_turretBounds;
 	Texture* m_turretTexture = nullptr;
+	AABB2 m_turretTextureUVs = AABB2::ZERO_TO_ONE;
 	float m_turretTurnSpeed;
 	float m_goalOrientationDegrees;
 	float m_turretGoalOrientationDegrees;
@@ -3,7 +3,8 @@
 #include "Game/Map.hpp"
 #include "Game/Game.hpp"
 #include "Game/Player.hpp"
-#include "Engine/Renderer/RendererDX11.hpp"
+#include "Game/GameRenderer.hpp"
+#include "Engine/Renderer/SpriteBatch2D.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/VertexUtils.hpp"
 #include "Engine/Math/MathUtils.hpp"
@@ -13,8 +14,8 @@ Scorpio::Scorpio(Map* const& mapOwner, EntityFaction faction)
 	:Entity(mapOwner, ENTITY_TYPE_EVIL_SCORPIO, faction)
 {
 	UpdateGameConfigXmlData();
-	m_isPushedByEntities = false;
-	m_isPushedByWalls = false;
+	SetPhysicsFlag(PHYSICS_FLAG_IS_PUSHED_BY_ENTITIES, false);
+	SetPhysicsFlag(PHYSICS_FLAG_IS_PUSHED_BY_WALLS, false);
 	CreateTexture();
 }
 
@@ -25,7 +26,7 @@ void Scorpio::Update(float deltaSeconds)
 	if (CanSeePlayer(m_sightRange))
 	{
 		m_chasingPlayerLocation = true;
-		Vec2 dispToPlayer = g_game->m_player->m_position - m_position;
+		Vec2 dispToPlayer = g_game->m_player->GetPosition() - GetPosition();
 		float orientToPlayer = (dispToPlayer).GetOrientationDegrees();
 		m_orientationDegrees = GetTurnedTowardDegrees(m_orientationDegrees, orientToPlayer, m_turretTurnSpeed * deltaSeconds);
 
@@ -38,7 +39,7 @@ void Scorpio::Update(float deltaSeconds)
 		m_orientationDegrees += m_turretTurnSpeed * deltaSeconds;
 	}
 
-	m_laserRay.m_startPos = m_position;
+	m_laserRay.m_startPos = GetPosition();
 	m_laserRay.m_fwrdNormal = GetForwardNormal();
 	m_laserRay.m_maxLength = m_laserMaxLength;
 
@@ -50,49 +51,31 @@ void Scorpio::Update(float deltaSeconds)
 	}
 	else
 	{
-		m_laserHitPos = m_position + (m_laserRay.m_fwrdNormal * m_laserMaxLength);
+		m_laserHitPos = GetPosition() + (m_laserRay.m_fwrdNormal * m_laserMaxLength);
 		m_laserLengthFraction = 1.f;
 	}
 
 }
 
-void Scorpio::Render() const
+void Scorpio::Render(SpriteBatch2D& spriteBatch) const
 {
-	Verts worldVerts;
-	AddVertsForAABB2D(worldVerts, m_entityBounds, Rgba8::WHITE);
+	spriteBatch.AddQuad(m_texture, BlendMode::ALPHA, ENTITY_RENDER_LAYER_BODY, m_entityBounds, Vec2::ZERO_TO_ONE, Vec2::ONE_TO_ZERO, GetPosition(), Rgba8::WHITE, m_textureUVs);
 
-	TransformVertexArrayXY3D(worldVerts, Vec2::ZERO_TO_ONE, Vec2::ONE_TO_ZERO, m_position);
-
-	g_renderer->SetBlendMode(BlendMode::ALPHA);
-	g_renderer->SetRasterizerMode(RasterizerMode::SOLID_CULL_NONE);
-	g_renderer->BindTexture(m_texture);
-	g_renderer->DrawVertexArray(worldVerts);
-
-	Vec2 fwrdNormal = GetForwardNormal();
-
-	worldVerts.clear();
+	Verts laserVerts;
 	unsigned char alphaByte = static_cast<unsigned char>(Lerp(255.f, 0.f, m_laserLengthFraction));
-	AddVertsForLineSegment2D(worldVerts, m_position, m_laserHitPos, 0.05f, Rgba8::RED, Rgba8(255, 0,0, alphaByte));
+	AddVertsForLineSegment2D(laserVerts, GetPosition(), m_laserHitPos, 0.05f, Rgba8::RED, Rgba8(255, 0,0, alphaByte));
+	spriteBatch.AddVerts(nullptr, BlendMode::ALPHA, ENTITY_RENDER_LAYER_BEAM, laserVerts);
 
-	g_renderer->SetBlendMode(BlendMode::ALPHA);
-	g_renderer->BindTexture(nullptr);
-	g_renderer->DrawVertexArray(worldVerts);
-
-	worldVerts.clear();
-	AddVertsForAABB2D(worldVerts, m_turretBounds, Rgba8::WHITE);
-	TransformVertexArrayXY3D(worldVerts, fwrdNormal, fwrdNormal.GetRotated90Degrees(), m_position);
-
-	g_renderer->SetBlendMode(BlendMode::ALPHA);
-	g_renderer->BindTexture(m_turretTexture);
-	g_renderer->DrawVertexArray(worldVerts);
+	Vec2 fwrdNormal = GetForwardNormal();
+	spriteBatch.AddQuad(m_turretTexture, BlendMode::ALPHA, ENTITY_RENDER_LAYER_TURRET, m_turretBounds, fwrdNormal, fwrdNormal.GetRotated90Degrees(), GetPosition(), Rgba8::WHITE, m_turretTextureUVs);
 }
 
 void Scorpio::Die()
 {
-	m_isGarbage = true;
+	m_map->DestroyEntity(this);
 	m_isDead = true;
-	g_game->PlayGameSFX(ENEMY_KILLED, m_position);
-	m_map->SpawnExplosion(m_position, DEATH_EXPLOSION_SIZE, DEATH_EXPLOSION_DURATION);
+	g_game->PlayGameSFX(ENEMY_KILLED, GetPosition());
+	m_map->SpawnExplosion(GetPosition(), DEATH_EXPLOSION_SIZE, DEATH_EXPLOSION_DURATION);
 
 	//Update entities solid map now that this scorpio is no longer blocking travel
 	FireEvent("RegenerateSolidMapsForMobileEntities");
@@ -100,7 +83,7 @@ void Scorpio::Die()
 
 void Scorpio::UpdateGameConfigXmlData()
 {
-	m_physicsRadius = g_gameConfigBlackboard.GetValue("scorpioPhysicsRadius", 0.4f);
+	SetPhysicsRadius(g_gameConfigBlackboard.GetValue("scorpioPhysicsRadius", 0.4f));
 	m_turretTurnSpeed = g_gameConfigBlackboard.GetValue("scorpioTurretTurnRate", 30.f);
 	m_sightRange = g_gameConfigBlackboard.GetValue("scorpioSightRange", 10.f);
 	m_laserMaxLength = m_sightRange;
@@ -116,9 +99,9 @@ void Scorpio::UpdateGameConfigXmlData()
 void Scorpio::CreateTexture()
 {
 	m_entityBounds = AABB2(-0.5f, -0.5f, 0.5f, 0.5f);
-	m_texture = g_renderer->CreateOrGetTextureFromFile(g_gameConfigBlackboard.GetValue("scorpioTexturePath", "").c_str());
+	m_texture = GetOrCreateEntityTexture(g_gameConfigBlackboard.GetValue("scorpioTexturePath", ""), m_textureUVs);
 	AddVertsForAABB2D(m_shapeVerts, m_entityBounds, Rgba8::WHITE);
 
 	m_turretBounds = m_entityBounds;
-	m_turretTexture = g_renderer->CreateOrGetTextureFromFile(g_gameConfigBlackboard.GetValue("scorpioTurretTexturePath", "").c_str());
+	m_turretTexture = GetOrCreateEntityTexture(g_gameConfigBlackboard.GetValue("scorpioTurretTexturePath", ""), m_turretTextureUVs);
 }
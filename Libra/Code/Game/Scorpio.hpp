@@ -11,7 +11,7 @@ protected:
 	virtual ~Scorpio() {}
 
 	virtual void Update(float deltaSeconds) override;
-	virtual void Render() const override;
+	virtual void Render(SpriteBatch2D& spriteBatch) const override;
 	virtual void Die() override;
 	virtual void UpdateGameConfigXmlData() override;
 
@@ -21,6 +21,7 @@ private:
 private:
 	AABB2 m_turretBounds;
 	Texture* m_turretTexture = nullptr;
+	AABB2 m_turretTextureUVs = AABB2::ZERO_TO_ONE;
 	Vec2 m_laserHitPos;
 	Ray2 m_laserRay;
 	float m_laserMaxLength;
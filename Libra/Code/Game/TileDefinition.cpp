@@ -1,6 +1,6 @@
 #include "Game/TileDefinition.hpp"
 #include "Game/GameCommon.hpp"
-#include "Engine/Renderer/RendererDX11.hpp"
+#include "Game/GameRenderer.hpp"
 #include "Engine/Renderer/Texture.hpp"
 #include "Engine/Renderer/SpriteSheet.hpp"
 #include "Engine/Core/ErrorWarningAssert.hpp"